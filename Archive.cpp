@@ -0,0 +1,120 @@
+#include "Archive.hpp"
+#include "data_path.hpp"
+#include "Load.hpp"
+
+#include <cassert>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+Archive::Archive(std::string const &filename) : file(filename) {
+	if (file.size < sizeof(Header)) {
+		throw std::runtime_error("Archive '" + filename + "' is too small to have a header.");
+	}
+	std::memcpy(&header, file.data, sizeof(Header));
+	if (std::string(header.magic, 4) != "arc0") {
+		throw std::runtime_error("Archive '" + filename + "' has the wrong magic number (expected 'arc0').");
+	}
+	if (header.slot_count == 0 || (header.slot_count & (header.slot_count - 1)) != 0 || header.slot_count <= header.entry_count) {
+		throw std::runtime_error("Archive '" + filename + "' has a bad slot count.");
+	}
+
+	size_t slots_offset = sizeof(Header);
+	size_t entries_offset = slots_offset + size_t(header.slot_count) * sizeof(Slot);
+	size_t names_offset = entries_offset + size_t(header.entry_count) * sizeof(Entry);
+	if (file.size < names_offset + header.names_size) {
+		throw std::runtime_error("Archive '" + filename + "' is too small for its index.");
+	}
+	slots = reinterpret_cast< Slot const * >(file.data + slots_offset);
+	entries = reinterpret_cast< Entry const * >(file.data + entries_offset);
+	names = file.data + names_offset;
+
+	//check everything once here, so find() doesn't have to:
+	// (each entry in exactly one slot, so -- with more slots than entries -- some slot is empty and every probe ends)
+	std::vector< bool > slotted(header.entry_count, false);
+	for (uint32_t s = 0; s < header.slot_count; ++s) {
+		if (slots[s].entry == EmptySlot) continue;
+		if (slots[s].entry >= header.entry_count) {
+			throw std::runtime_error("Archive '" + filename + "' has an out-of-range slot.");
+		}
+		if (slotted[slots[s].entry]) {
+			throw std::runtime_error("Archive '" + filename + "' has an entry in more than one slot.");
+		}
+		slotted[slots[s].entry] = true;
+	}
+	for (uint32_t e = 0; e < header.entry_count; ++e) {
+		if (!slotted[e]) {
+			throw std::runtime_error("Archive '" + filename + "' has an entry in no slot.");
+		}
+	}
+	for (uint32_t e = 0; e < header.entry_count; ++e) {
+		Entry const &entry = entries[e];
+		if (!(entry.name_begin <= entry.name_end && entry.name_end <= header.names_size)) {
+			throw std::runtime_error("Archive '" + filename + "' has an entry with an out-of-range name.");
+		}
+		if (!(entry.offset <= file.size && entry.size <= file.size - entry.offset) || entry.offset % Alignment != 0) {
+			throw std::runtime_error("Archive '" + filename + "' has an entry with out-of-range (or misaligned) data.");
+		}
+	}
+}
+
+bool Archive::find(std::string const &name, View *view) const {
+	assert(view);
+	uint64_t h = hash(name);
+	uint32_t mask = header.slot_count - 1;
+	for (uint32_t s = uint32_t(h) & mask; slots[s].entry != EmptySlot; s = (s + 1) & mask) {
+		if (slots[s].hash != h) continue;
+		Entry const &entry = entries[slots[s].entry];
+		if (name.size() == entry.name_end - entry.name_begin
+		 && std::memcmp(name.data(), names + entry.name_begin, name.size()) == 0) {
+			view->data = file.data + entry.offset;
+			view->size = size_t(entry.size);
+			return true;
+		}
+	}
+	return false;
+}
+
+Archive const *Archive::data() {
+	static std::unique_ptr< Archive > archive = []() -> std::unique_ptr< Archive > {
+		std::string path = data_path("assets.pak");
+		if (!std::ifstream(path, std::ios::binary)) return nullptr; //(no archive is fine)
+		return std::unique_ptr< Archive >(new Archive(path));
+	}();
+	return archive.get();
+}
+
+uint64_t Archive::hash(std::string const &name) {
+	//64-bit FNV-1a:
+	uint64_t h = 0xcbf29ce484222325ULL;
+	for (char c : name) {
+		h ^= uint8_t(c);
+		h *= 0x100000001b3ULL;
+	}
+	return h;
+}
+
+bool find_data_file(std::string const &path, Archive::View *view) {
+	Archive const *archive = Archive::data();
+	if (!archive) return false;
+	static std::string const prefix = data_path("");
+	if (path.compare(0, prefix.size(), prefix) != 0) return false;
+	return archive->find(path.substr(prefix.size()), view);
+}
+
+std::string read_data_file(std::string const &path) {
+	Archive::View view;
+	if (find_data_file(path, &view)) {
+		count_load_bytes_read(view.size);
+		return std::string(view.data, view.size);
+	}
+	std::ifstream file(path, std::ios::binary);
+	if (!file) {
+		throw std::runtime_error("Failed to open '" + path + "'.");
+	}
+	std::string ret((std::istreambuf_iterator< char >(file)), std::istreambuf_iterator< char >());
+	count_load_bytes_read(ret.size());
+	return ret;
+}
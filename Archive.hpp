@@ -0,0 +1,84 @@
+#pragma once
+
+/*
+ * An Archive packs many data files into one, so loading opens (and maps) one file instead of many.
+ * The game looks for 'assets.pak' next to the executable; when it is there, files asked for by their
+ *  data_path() (chunk files, sprite images, shader sources) are read out of it instead of from disk.
+ *
+ * Make (or remake, after changing any of the files in it) the archive with:
+ *   dist/pack-assets dist/assets.pak dist/shader.vert dist/shader.frag dist/test_scene.pnct ...
+ * (files are stored under their paths relative to the archive's directory, so these are 'shader.vert', ...)
+ *
+ * Layout (little-endian, like the chunk files):
+ *   Header
+ *   Slot[slot_count] -- hash table of names (64-bit FNV-1a, linear probing; slot_count is a power of two)
+ *   Entry[entry_count]
+ *   char[names_size] -- names, not '\0'-terminated
+ *   file data, each starting at a multiple of Alignment (from the start of the archive)
+ *
+ */
+
+#include "MappedFile.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+struct Archive {
+	//map 'filename' and check its index; throws if it can't be opened or isn't a valid archive:
+	explicit Archive(std::string const &filename);
+
+	struct View {
+		char const *data = nullptr;
+		size_t size = 0;
+	};
+
+	//look up a file by the name it was packed under (e.g., "test_scene.pnct"):
+	bool find(std::string const &name, View *view) const;
+
+	//the archive next to the executable (data_path("assets.pak")), or null if there is none:
+	// (opened the first time this is called; throws if it exists but isn't valid)
+	static Archive const *data();
+
+	//---- format ----
+	enum : uint32_t { Alignment = 64 };
+
+	struct Header {
+		char magic[4] = {'a', 'r', 'c', '0'};
+		uint32_t slot_count = 0;
+		uint32_t entry_count = 0;
+		uint32_t names_size = 0;
+	};
+	static_assert(sizeof(Header) == 16, "Header is packed.");
+
+	struct Slot {
+		uint64_t hash = 0;
+		uint32_t entry = EmptySlot;
+		uint32_t padding = 0;
+	};
+	static_assert(sizeof(Slot) == 16, "Slot is packed.");
+	enum : uint32_t { EmptySlot = 0xffffffff };
+
+	struct Entry {
+		uint64_t offset = 0; //from the start of the archive
+		uint64_t size = 0;
+		uint32_t name_begin = 0, name_end = 0; //in names
+	};
+	static_assert(sizeof(Entry) == 24, "Entry is packed.");
+
+	static uint64_t hash(std::string const &name);
+
+	//---- internals ----
+	MappedFile file;
+	Header header;
+	Slot const *slots = nullptr;
+	Entry const *entries = nullptr;
+	char const *names = nullptr;
+};
+
+//If 'path' is a data_path() that was packed into Archive::data(), point 'view' at it:
+bool find_data_file(std::string const &path, Archive::View *view);
+
+//Read a whole data file (e.g., shader source) -- from Archive::data() if it was packed, from disk otherwise:
+// note: will throw if file fails to read.
+std::string read_data_file(std::string const &path);
@@ -2,21 +2,16 @@
 
 #include "gl_compile_program.hpp"
 #include "gl_errors.hpp"
-#include <fstream>
 #include "data_path.hpp"
+#include "Archive.hpp"
 
 // Scene::Drawable::Pipeline lit_color_texture_program_pipeline;
 
 
 BloomProgram::BloomProgram() {
   //Compile vertex and fragment shaders using the convenient 'gl_compile_program' helper function:
-  std::ifstream vertex_fs(data_path("bloom.vert"));
-  std::string vert_content( 
-      (std::istreambuf_iterator<char>(vertex_fs)), std::istreambuf_iterator<char>() );
-
-  std::ifstream fragment_fs(data_path("bloom.frag"));
-  std::string frag_content( 
-      (std::istreambuf_iterator<char>(fragment_fs)), std::istreambuf_iterator<char>() );
+  std::string vert_content = read_data_file(data_path("bloom.vert"));
+  std::string frag_content = read_data_file(data_path("bloom.frag"));
 
   program = gl_compile_program(
     //vertex shader:
@@ -28,6 +23,12 @@ BloomProgram::BloomProgram() {
   //As you can see above, adjacent strings in C/C++ are concatenated.
   // this is very useful for writing long shader programs inline.
 
+  //IMG always samples from GL_TEXTURE0 and FRAME from GL_TEXTURE1:
+  glUseProgram(program);
+  glUniform1i(glGetUniformLocation(program, "IMG"), 0);
+  glUniform1i(glGetUniformLocation(program, "FRAME"), 1);
+  glUseProgram(0);
+
 /*
   //look up the locations of vertex attributes:
   Position_vec4 = glGetAttribLocation(program, "Position");
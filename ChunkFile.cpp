@@ -0,0 +1,155 @@
+#include "ChunkFile.hpp"
+#include "Archive.hpp"
+#include "Load.hpp"
+#include "read_write_chunk.hpp"
+
+#include <zlib.h>
+
+#include <cstring>
+#include <future>
+
+ChunkFile::Stats ChunkFile::stats;
+
+ChunkFile::ChunkFile(std::string const &filename_) : filename(filename_) {
+	//packed into the asset archive?
+	Archive::View view;
+	if (find_data_file(filename, &view)) {
+		data = view.data;
+		size = view.size;
+		stats.archived_files += 1;
+	} else {
+		file.reset(new MappedFile(filename));
+		data = file->data;
+		size = file->size;
+	}
+	count_load_bytes_read(size);
+
+	stats.files += 1;
+	stats.mapped_bytes += size;
+
+	inflate_chunks();
+}
+
+ChunkFile::ChunkFile(std::string const &filename_, char const *data_, size_t size_) : filename(filename_), data(data_), size(size_) {
+	stats.files += 1;
+	stats.mapped_bytes += size;
+
+	inflate_chunks();
+}
+
+//same header as in read_write_chunk.hpp:
+struct ChunkHeader {
+	char magic[4] = {'\0', '\0', '\0', '\0'};
+	uint32_t size = 0;
+};
+static_assert(sizeof(ChunkHeader) == 8, "header is packed");
+
+void ChunkFile::inflate_chunks() {
+	//find compressed chunks (read_bytes() complains about anything malformed, so just stop there):
+	std::vector< size_t > offsets;
+	for (size_t at = 0; size - at >= sizeof(ChunkHeader); ) {
+		ChunkHeader header;
+		std::memcpy(&header, data + at, sizeof(header));
+		uint32_t stored = header.size & ~ChunkCompressed;
+		if (size - at - sizeof(header) < stored) break;
+		if (header.size & ChunkCompressed) offsets.emplace_back(at);
+		at += sizeof(header) + stored;
+	}
+	if (offsets.empty()) return;
+
+	//make room for each one, so inflating doesn't touch the map:
+	std::vector< std::vector< uint64_t > * > outs;
+	for (size_t at : offsets) {
+		outs.emplace_back(&inflated[at]);
+	}
+
+	auto inflate_chunk = [this](size_t at, std::vector< uint64_t > *out) {
+		ChunkHeader header;
+		std::memcpy(&header, data + at, sizeof(header));
+		std::string magic(header.magic, 4);
+		uint32_t stored = header.size & ~ChunkCompressed;
+		uint32_t raw = 0;
+		if (stored < sizeof(raw)) {
+			throw std::runtime_error("Compressed chunk '" + magic + "' in '" + filename + "' is too small.");
+		}
+		std::memcpy(&raw, data + at + sizeof(header), sizeof(raw));
+
+		out->resize((raw + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+		uLongf length = raw;
+		int ret = uncompress(reinterpret_cast< Bytef * >(out->data()), &length,
+			reinterpret_cast< Bytef const * >(data + at + sizeof(header) + sizeof(raw)), uLong(stored - sizeof(raw)));
+		if (ret != Z_OK || length != raw) {
+			throw std::runtime_error("Failed to inflate chunk '" + magic + "' in '" + filename + "'.");
+		}
+
+		stats.compressed_chunks += 1;
+		stats.compressed_bytes += stored;
+		stats.inflated_bytes += raw;
+	};
+
+	//big chunks get their own threads, this thread does the rest:
+	//(different files are already inflated in parallel when they are loaded in the background; see Load.hpp)
+	const uint32_t BigChunk = 64 * 1024;
+	std::vector< std::future< void > > big;
+	for (size_t i = 0; i < offsets.size(); ++i) {
+		ChunkHeader header;
+		std::memcpy(&header, data + offsets[i], sizeof(header));
+		if ((header.size & ~ChunkCompressed) >= BigChunk) {
+			big.emplace_back(std::async(std::launch::async, inflate_chunk, offsets[i], outs[i]));
+		} else {
+			inflate_chunk(offsets[i], outs[i]);
+		}
+	}
+	for (auto &f : big) {
+		f.get(); //(rethrows)
+	}
+}
+
+void const *ChunkFile::read_bytes(std::string const &magic, size_t element_size, size_t element_align, size_t *bytes) {
+	assert(magic.size() == 4);
+	assert(bytes);
+
+	ChunkHeader header;
+	if (size - offset < sizeof(header)) {
+		throw std::runtime_error("Failed to read chunk header in '" + filename + "'");
+	}
+	std::memcpy(&header, data + offset, sizeof(header));
+	if (std::string(header.magic, 4) != magic) {
+		throw std::runtime_error("Unexpected magic number in chunk in '" + filename + "' (expected '" + magic + "')");
+	}
+	uint32_t stored = header.size & ~ChunkCompressed;
+	if (size - offset - sizeof(header) < stored) {
+		throw std::runtime_error("Failed to read chunk data of '" + magic + "' in '" + filename + "'.");
+	}
+
+	char const *at = data + offset + sizeof(header);
+	if (header.size & ChunkCompressed) {
+		//already inflated by inflate_chunks():
+		auto f = inflated.find(offset);
+		assert(f != inflated.end());
+		offset += sizeof(header) + stored;
+		uint32_t raw = 0;
+		std::memcpy(&raw, at, sizeof(raw));
+		if (raw % element_size != 0) {
+			throw std::runtime_error("Size of chunk '" + magic + "' in '" + filename + "' not divisible by element size");
+		}
+		*bytes = raw;
+		return (raw == 0 ? nullptr : f->second.data());
+	}
+	if (header.size % element_size != 0) {
+		throw std::runtime_error("Size of chunk '" + magic + "' in '" + filename + "' not divisible by element size");
+	}
+
+	offset += sizeof(header) + header.size;
+	*bytes = header.size;
+
+	if (header.size == 0) return nullptr;
+	if (reinterpret_cast< uintptr_t >(at) % element_align != 0) {
+		//chunks follow each other without padding, so one after an odd-sized chunk may need a copy:
+		copies.emplace_back((header.size + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+		std::memcpy(copies.back().data(), at, header.size);
+		stats.copied_bytes += header.size;
+		return copies.back().data();
+	}
+	return at;
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+/*
+ * ChunkFile maps a whole chunk file (the format written by write_chunk in read_write_chunk.hpp)
+ *  into memory (or finds it in the asset archive; see Archive.hpp) and hands out typed,
+ *  bounds-checked views of its chunks without copying them.
+ *
+ * Usage:
+ *   ChunkFile file(filename);
+ *   ChunkFile::Span< Vertex > vertices = file.read< Vertex >("pnct");
+ *   ChunkFile::Span< char > strings = file.read< char >("str0");
+ *   if (!file.at_end()) { ...trailing data... }
+ *
+ * Chunks are read in file order, with the same checks (and errors) as read_chunk.
+ * Spans point into the mapping, so they are only valid while the ChunkFile is alive.
+ * (The rare chunk whose data isn't aligned for its type is copied into memory owned by the ChunkFile.)
+ *
+ * Compressed chunks (see read_write_chunk.hpp) are all inflated when the file is opened,
+ *  the big ones in parallel, into memory owned by the ChunkFile; read() then looks the same.
+ *
+ */
+
+#include "MappedFile.hpp"
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+struct ChunkFile {
+	//map 'filename' (or find it in the asset archive; see Archive.hpp); throws if it can't be opened or mapped:
+	explicit ChunkFile(std::string const &filename);
+	//..or read chunks from memory that outlives the ChunkFile ('filename' is just for error messages):
+	ChunkFile(std::string const &filename, char const *data, size_t size);
+	ChunkFile(ChunkFile const &) = delete;
+	ChunkFile &operator=(ChunkFile const &) = delete;
+
+	template< typename T >
+	struct Span {
+		Span() = default;
+		Span(T const *data_, size_t size_) : ptr(data_), count(size_) { }
+
+		T const *data() const { return ptr; }
+		size_t size() const { return count; }
+		bool empty() const { return count == 0; }
+		T const *begin() const { return ptr; }
+		T const *end() const { return ptr + count; }
+
+		T const &operator[](size_t i) const {
+			assert(i < count);
+			return ptr[i];
+		}
+		T const &at(size_t i) const {
+			if (i >= count) throw std::out_of_range("ChunkFile::Span index out of range");
+			return ptr[i];
+		}
+		//elements [begin,end); throws if that isn't a valid range:
+		Span subspan(size_t begin_, size_t end_) const {
+			if (!(begin_ <= end_ && end_ <= count)) throw std::out_of_range("ChunkFile::Span subspan out of range");
+			return Span(ptr + begin_, end_ - begin_);
+		}
+
+	private:
+		T const *ptr = nullptr;
+		size_t count = 0;
+	};
+
+	//view the next chunk as an array of T, checking its magic number and that its size is a multiple of sizeof(T):
+	template< typename T >
+	Span< T > read(std::string const &magic) {
+		static_assert(std::is_trivially_copyable< T >::value, "Chunk elements are plain old data.");
+		static_assert(alignof(T) <= alignof(uint64_t), "Chunk elements are at most 8-byte aligned.");
+		size_t bytes = 0;
+		void const *at = read_bytes(magic, sizeof(T), alignof(T), &bytes);
+		return Span< T >(reinterpret_cast< T const * >(at), bytes / sizeof(T));
+	}
+
+	//is everything read?
+	bool at_end() const { return offset == size; }
+	//magic number of the next chunk (empty if there isn't a whole header left):
+	std::string next_magic() const { return (size - offset < 8 ? std::string() : std::string(data + offset, 4)); }
+
+	std::string filename;
+
+	//totals over all ChunkFiles so far (e.g., for load-time reports; atomic so files can be opened on any thread):
+	struct Stats {
+		std::atomic< uint32_t > files{0};
+		std::atomic< uint64_t > mapped_bytes{0};
+		std::atomic< uint64_t > copied_bytes{0}; //chunks that had to be copied for alignment
+		std::atomic< uint32_t > archived_files{0}; //files found in the asset archive
+		std::atomic< uint32_t > compressed_chunks{0};
+		std::atomic< uint64_t > compressed_bytes{0}; //size of compressed chunks as stored...
+		std::atomic< uint64_t > inflated_bytes{0}; //...and once inflated
+	};
+	static Stats stats;
+
+	//---- internals ----
+	void const *read_bytes(std::string const &magic, size_t element_size, size_t element_align, size_t *bytes);
+	void inflate_chunks();
+
+	std::unique_ptr< MappedFile > file; //(null when reading from the archive or memory)
+	char const *data = nullptr; //the chunks (null for empty files)
+	size_t size = 0;
+	size_t offset = 0; //next chunk header
+	std::vector< std::vector< uint64_t > > copies; //storage for misaligned chunks
+	std::map< size_t, std::vector< uint64_t > > inflated; //storage for compressed chunks, by header offset
+};
@@ -1,6 +1,7 @@
 #include "DrawLines.hpp"
 #include "PathFont.hpp"
 #include "ColorProgram.hpp"
+#include "RenderCommands.hpp"
 
 #include "gl_errors.hpp"
 
@@ -137,28 +138,33 @@ DrawLines::~DrawLines() {
 
 	//based on DrawSprites.cpp :
 
+	//(re-used so the arena keeps its memory between batches of lines)
+	static RenderCommands commands;
+	commands.clear();
+
 	//upload vertices to vertex_buffer:
-	glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer); //set vertex_buffer as current
-	glBufferData(GL_ARRAY_BUFFER, attribs.size() * sizeof(attribs[0]), attribs.data(), GL_STREAM_DRAW); //upload attribs array
-	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	GLsizeiptr bytes = attribs.size() * sizeof(attribs[0]);
+	commands.add(RenderCommands::BufferData{ GL_ARRAY_BUFFER, vertex_buffer, GL_STREAM_DRAW, bytes }, attribs.data(), bytes);
 
 	//set color_program as current program:
-	glUseProgram(color_program->program);
+	commands.add(RenderCommands::UseProgram{ color_program->program });
 
 	//upload OBJECT_TO_CLIP to the proper uniform location:
-	glUniformMatrix4fv(color_program->OBJECT_TO_CLIP_mat4, 1, GL_FALSE, glm::value_ptr(world_to_clip));
+	commands.uniform(color_program->OBJECT_TO_CLIP_mat4, world_to_clip);
 
 	//use the mapping vertex_buffer_for_color_program to fetch vertex data:
-	glBindVertexArray(vertex_buffer_for_color_program);
+	commands.add(RenderCommands::BindVertexArray{ vertex_buffer_for_color_program });
 
 	//run the OpenGL pipeline:
-	glDrawArrays(GL_LINES, 0, GLsizei(attribs.size()));
+	commands.add(RenderCommands::DrawArrays{ GL_LINES, 0, GLsizei(attribs.size()) });
 
 	//reset vertex array to none:
-	glBindVertexArray(0);
+	commands.add(RenderCommands::BindVertexArray{ 0 });
 
 	//reset current program to none:
-	glUseProgram(0);
+	commands.add(RenderCommands::UseProgram{ 0 });
+
+	commands.execute();
 }
 
 
@@ -2,6 +2,7 @@
 
 #include "ColorTextureProgram.hpp"
 #include "Load.hpp"
+#include "RenderCommands.hpp"
 
 #include "GL.hpp"
 #include "gl_errors.hpp"
@@ -224,34 +225,38 @@ DrawSprites::~DrawSprites() {
 
 	//based on base0's PongMode::draw()
 
+	//(re-used so the arena keeps its memory between batches of sprites)
+	static RenderCommands commands;
+	commands.clear();
+
 	//upload vertices to vertex_buffer:
-	glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer); //set vertex_buffer as current
-	glBufferData(GL_ARRAY_BUFFER, attribs.size() * sizeof(attribs[0]), attribs.data(), GL_STREAM_DRAW); //upload attribs array
-	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	GLsizeiptr bytes = attribs.size() * sizeof(attribs[0]);
+	commands.add(RenderCommands::BufferData{ GL_ARRAY_BUFFER, vertex_buffer, GL_STREAM_DRAW, bytes }, attribs.data(), bytes);
 
 	//set color_texture_program as current program:
-	glUseProgram(color_texture_program->program);
+	commands.add(RenderCommands::UseProgram{ color_texture_program->program });
 
 	//upload OBJECT_TO_CLIP to the proper uniform location:
-	glUniformMatrix4fv(color_texture_program->OBJECT_TO_CLIP_mat4, 1, GL_FALSE, glm::value_ptr(to_clip));
+	commands.uniform(color_texture_program->OBJECT_TO_CLIP_mat4, to_clip);
 
 	//use the mapping vertex_buffer_for_color_texture_program to fetch vertex data:
-	glBindVertexArray(vertex_buffer_for_color_texture_program);
+	commands.add(RenderCommands::BindVertexArray{ vertex_buffer_for_color_texture_program });
 
 	//bind the sprite texture to location zero:
-	glActiveTexture(GL_TEXTURE0);
-	glBindTexture(GL_TEXTURE_2D, atlas.tex);
+	commands.add(RenderCommands::BindTexture{ 0, GL_TEXTURE_2D, atlas.tex });
 
 	//run the OpenGL pipeline:
-	glDrawArrays(GL_TRIANGLES, 0, GLsizei(attribs.size()));
+	commands.add(RenderCommands::DrawArrays{ GL_TRIANGLES, 0, GLsizei(attribs.size()) });
 
 	//unbind the sprite texture:
-	glBindTexture(GL_TEXTURE_2D, 0);
+	commands.add(RenderCommands::BindTexture{ 0, GL_TEXTURE_2D, 0 });
 
 	//reset vertex array to none:
-	glBindVertexArray(0);
+	commands.add(RenderCommands::BindVertexArray{ 0 });
 
 	//reset current program to none:
-	glUseProgram(0);
+	commands.add(RenderCommands::UseProgram{ 0 });
+
+	commands.execute();
 }
 
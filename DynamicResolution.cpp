@@ -0,0 +1,54 @@
+#include "DynamicResolution.hpp"
+
+#include <SDL.h>
+
+#include <algorithm>
+#include <cmath>
+
+void DynamicResolution::begin() {
+	cpu_begin = SDL_GetPerformanceCounter();
+	gpu_timer.begin();
+}
+
+void DynamicResolution::end() {
+	gpu_timer.end();
+	uint64_t now = SDL_GetPerformanceCounter();
+	float ticks_to_ms = 1000.0f / float(SDL_GetPerformanceFrequency());
+
+	//exponential moving averages smooth out single-frame spikes:
+	auto smooth = [](float &average, float sample) {
+		average = (average == 0.0f ? sample : average + 0.1f * (sample - average));
+	};
+	smooth(cpu_ms, float(now - cpu_begin) * ticks_to_ms);
+	if (last_end != 0) smooth(frame_ms, float(now - last_end) * ticks_to_ms);
+	last_end = now;
+	if (gpu_timer.milliseconds > 0.0f) smooth(gpu_ms, gpu_timer.milliseconds);
+
+	frames_since_change += 1;
+
+	if (!enabled) {
+		scale = max_scale;
+		return;
+	}
+
+	//GPU results lag a few frames, so give each change time to show up in the measurements:
+	if (frames_since_change < 2 * GLTimer::Depth || gpu_ms == 0.0f) return;
+
+	//pixel cost goes as scale^2, so this scale would just fit the budget:
+	float fit = scale * std::sqrt(target_ms / gpu_ms);
+
+	float wanted = scale;
+	if (gpu_ms > target_ms) {
+		//over budget -- unless drawing is bound by the CPU, where fewer pixels won't help:
+		if (cpu_ms < target_ms) wanted = fit;
+	} else if (gpu_ms < 0.8f * target_ms) {
+		//comfortably under budget -- creep back up (slowly, to avoid oscillating):
+		wanted = std::min(fit, scale + 2.0f / ScaleSteps);
+	}
+
+	wanted = std::round(std::max(min_scale, std::min(max_scale, wanted)) * ScaleSteps) / ScaleSteps;
+	if (wanted != scale) {
+		scale = wanted;
+		frames_since_change = 0;
+	}
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+/*
+ * DynamicResolution picks the scale at which a Scene draws its offscreen first pass
+ *  (Scene::resolution_scale) so that drawing stays within a frame time budget.
+ *
+ * Call begin() just before drawing and end() just after. The GPU time in between
+ *  (timestamp queries, read a few frames late) and the CPU time (SDL's performance counter)
+ *  are smoothed, and the scale is moved toward whatever would make the GPU time fit the budget.
+ *
+ */
+
+#include "gl_timer.hpp"
+
+#include <cstdint>
+
+struct DynamicResolution {
+	//configuration:
+	bool enabled = true;
+	float target_ms = 14.0f; //GPU budget for drawing (leaves headroom in a 60Hz frame)
+	float min_scale = 0.5f;
+	float max_scale = 1.0f;
+
+	//current scale (a multiple of 1/ScaleSteps, so render target sizes don't change every frame):
+	float scale = 1.0f;
+
+	void begin();
+	void end();
+
+	//smoothed measurements:
+	float gpu_ms = 0.0f; //between begin() and end() on the GPU
+	float cpu_ms = 0.0f; //between begin() and end() on the CPU
+	float frame_ms = 0.0f; //between successive end()s on the CPU (includes waiting for vsync)
+
+	//internals:
+	enum : uint32_t { ScaleSteps = 32 };
+	GLTimer gpu_timer;
+	uint64_t cpu_begin = 0;
+	uint64_t last_end = 0;
+	uint32_t frames_since_change = 0;
+};
@@ -0,0 +1,2167 @@
+//This file was generated from GL.hpp by make-GL-null.py -- edit that instead.
+// (see GL-null.hpp for what it is for)
+
+#include "GL.hpp"
+#include "GL-null.hpp"
+
+#include <cstddef>
+#include <vector>
+
+char const * const GLNull::FunctionNames[] = {
+	"glCullFace",
+	"glFrontFace",
+	"glHint",
+	"glLineWidth",
+	"glPointSize",
+	"glPolygonMode",
+	"glScissor",
+	"glTexParameterf",
+	"glTexParameterfv",
+	"glTexParameteri",
+	"glTexParameteriv",
+	"glTexImage1D",
+	"glTexImage2D",
+	"glDrawBuffer",
+	"glClear",
+	"glClearColor",
+	"glClearStencil",
+	"glClearDepth",
+	"glStencilMask",
+	"glColorMask",
+	"glDepthMask",
+	"glDisable",
+	"glEnable",
+	"glFinish",
+	"glFlush",
+	"glBlendFunc",
+	"glLogicOp",
+	"glStencilFunc",
+	"glStencilOp",
+	"glDepthFunc",
+	"glPixelStoref",
+	"glPixelStorei",
+	"glReadBuffer",
+	"glReadPixels",
+	"glGetBooleanv",
+	"glGetDoublev",
+	"glGetError",
+	"glGetFloatv",
+	"glGetIntegerv",
+	"glGetString",
+	"glGetTexImage",
+	"glGetTexParameterfv",
+	"glGetTexParameteriv",
+	"glGetTexLevelParameterfv",
+	"glGetTexLevelParameteriv",
+	"glIsEnabled",
+	"glDepthRange",
+	"glViewport",
+	"glDrawArrays",
+	"glDrawElements",
+	"glGetPointerv",
+	"glPolygonOffset",
+	"glCopyTexImage1D",
+	"glCopyTexImage2D",
+	"glCopyTexSubImage1D",
+	"glCopyTexSubImage2D",
+	"glTexSubImage1D",
+	"glTexSubImage2D",
+	"glBindTexture",
+	"glDeleteTextures",
+	"glGenTextures",
+	"glIsTexture",
+	"glDrawRangeElements",
+	"glTexImage3D",
+	"glTexSubImage3D",
+	"glCopyTexSubImage3D",
+	"glActiveTexture",
+	"glSampleCoverage",
+	"glCompressedTexImage3D",
+	"glCompressedTexImage2D",
+	"glCompressedTexImage1D",
+	"glCompressedTexSubImage3D",
+	"glCompressedTexSubImage2D",
+	"glCompressedTexSubImage1D",
+	"glGetCompressedTexImage",
+	"glBlendFuncSeparate",
+	"glMultiDrawArrays",
+	"glMultiDrawElements",
+	"glPointParameterf",
+	"glPointParameterfv",
+	"glPointParameteri",
+	"glPointParameteriv",
+	"glBlendColor",
+	"glBlendEquation",
+	"glGenQueries",
+	"glDeleteQueries",
+	"glIsQuery",
+	"glBeginQuery",
+	"glEndQuery",
+	"glGetQueryiv",
+	"glGetQueryObjectiv",
+	"glGetQueryObjectuiv",
+	"glBindBuffer",
+	"glDeleteBuffers",
+	"glGenBuffers",
+	"glIsBuffer",
+	"glBufferData",
+	"glBufferSubData",
+	"glGetBufferSubData",
+	"glMapBuffer",
+	"glUnmapBuffer",
+	"glGetBufferParameteriv",
+	"glGetBufferPointerv",
+	"glBlendEquationSeparate",
+	"glDrawBuffers",
+	"glStencilOpSeparate",
+	"glStencilFuncSeparate",
+	"glStencilMaskSeparate",
+	"glAttachShader",
+	"glBindAttribLocation",
+	"glCompileShader",
+	"glCreateProgram",
+	"glCreateShader",
+	"glDeleteProgram",
+	"glDeleteShader",
+	"glDetachShader",
+	"glDisableVertexAttribArray",
+	"glEnableVertexAttribArray",
+	"glGetActiveAttrib",
+	"glGetActiveUniform",
+	"glGetAttachedShaders",
+	"glGetAttribLocation",
+	"glGetProgramiv",
+	"glGetProgramInfoLog",
+	"glGetShaderiv",
+	"glGetShaderInfoLog",
+	"glGetShaderSource",
+	"glGetUniformLocation",
+	"glGetUniformfv",
+	"glGetUniformiv",
+	"glGetVertexAttribdv",
+	"glGetVertexAttribfv",
+	"glGetVertexAttribiv",
+	"glGetVertexAttribPointerv",
+	"glIsProgram",
+	"glIsShader",
+	"glLinkProgram",
+	"glShaderSource",
+	"glUseProgram",
+	"glUniform1f",
+	"glUniform2f",
+	"glUniform3f",
+	"glUniform4f",
+	"glUniform1i",
+	"glUniform2i",
+	"glUniform3i",
+	"glUniform4i",
+	"glUniform1fv",
+	"glUniform2fv",
+	"glUniform3fv",
+	"glUniform4fv",
+	"glUniform1iv",
+	"glUniform2iv",
+	"glUniform3iv",
+	"glUniform4iv",
+	"glUniformMatrix2fv",
+	"glUniformMatrix3fv",
+	"glUniformMatrix4fv",
+	"glValidateProgram",
+	"glVertexAttrib1d",
+	"glVertexAttrib1dv",
+	"glVertexAttrib1f",
+	"glVertexAttrib1fv",
+	"glVertexAttrib1s",
+	"glVertexAttrib1sv",
+	"glVertexAttrib2d",
+	"glVertexAttrib2dv",
+	"glVertexAttrib2f",
+	"glVertexAttrib2fv",
+	"glVertexAttrib2s",
+	"glVertexAttrib2sv",
+	"glVertexAttrib3d",
+	"glVertexAttrib3dv",
+	"glVertexAttrib3f",
+	"glVertexAttrib3fv",
+	"glVertexAttrib3s",
+	"glVertexAttrib3sv",
+	"glVertexAttrib4Nbv",
+	"glVertexAttrib4Niv",
+	"glVertexAttrib4Nsv",
+	"glVertexAttrib4Nub",
+	"glVertexAttrib4Nubv",
+	"glVertexAttrib4Nuiv",
+	"glVertexAttrib4Nusv",
+	"glVertexAttrib4bv",
+	"glVertexAttrib4d",
+	"glVertexAttrib4dv",
+	"glVertexAttrib4f",
+	"glVertexAttrib4fv",
+	"glVertexAttrib4iv",
+	"glVertexAttrib4s",
+	"glVertexAttrib4sv",
+	"glVertexAttrib4ubv",
+	"glVertexAttrib4uiv",
+	"glVertexAttrib4usv",
+	"glVertexAttribPointer",
+	"glUniformMatrix2x3fv",
+	"glUniformMatrix3x2fv",
+	"glUniformMatrix2x4fv",
+	"glUniformMatrix4x2fv",
+	"glUniformMatrix3x4fv",
+	"glUniformMatrix4x3fv",
+	"glColorMaski",
+	"glGetBooleani_v",
+	"glGetIntegeri_v",
+	"glEnablei",
+	"glDisablei",
+	"glIsEnabledi",
+	"glBeginTransformFeedback",
+	"glEndTransformFeedback",
+	"glBindBufferRange",
+	"glBindBufferBase",
+	"glTransformFeedbackVaryings",
+	"glGetTransformFeedbackVarying",
+	"glClampColor",
+	"glBeginConditionalRender",
+	"glEndConditionalRender",
+	"glVertexAttribIPointer",
+	"glGetVertexAttribIiv",
+	"glGetVertexAttribIuiv",
+	"glVertexAttribI1i",
+	"glVertexAttribI2i",
+	"glVertexAttribI3i",
+	"glVertexAttribI4i",
+	"glVertexAttribI1ui",
+	"glVertexAttribI2ui",
+	"glVertexAttribI3ui",
+	"glVertexAttribI4ui",
+	"glVertexAttribI1iv",
+	"glVertexAttribI2iv",
+	"glVertexAttribI3iv",
+	"glVertexAttribI4iv",
+	"glVertexAttribI1uiv",
+	"glVertexAttribI2uiv",
+	"glVertexAttribI3uiv",
+	"glVertexAttribI4uiv",
+	"glVertexAttribI4bv",
+	"glVertexAttribI4sv",
+	"glVertexAttribI4ubv",
+	"glVertexAttribI4usv",
+	"glGetUniformuiv",
+	"glBindFragDataLocation",
+	"glGetFragDataLocation",
+	"glUniform1ui",
+	"glUniform2ui",
+	"glUniform3ui",
+	"glUniform4ui",
+	"glUniform1uiv",
+	"glUniform2uiv",
+	"glUniform3uiv",
+	"glUniform4uiv",
+	"glTexParameterIiv",
+	"glTexParameterIuiv",
+	"glGetTexParameterIiv",
+	"glGetTexParameterIuiv",
+	"glClearBufferiv",
+	"glClearBufferuiv",
+	"glClearBufferfv",
+	"glClearBufferfi",
+	"glGetStringi",
+	"glIsRenderbuffer",
+	"glBindRenderbuffer",
+	"glDeleteRenderbuffers",
+	"glGenRenderbuffers",
+	"glRenderbufferStorage",
+	"glGetRenderbufferParameteriv",
+	"glIsFramebuffer",
+	"glBindFramebuffer",
+	"glDeleteFramebuffers",
+	"glGenFramebuffers",
+	"glCheckFramebufferStatus",
+	"glFramebufferTexture1D",
+	"glFramebufferTexture2D",
+	"glFramebufferTexture3D",
+	"glFramebufferRenderbuffer",
+	"glGetFramebufferAttachmentParameteriv",
+	"glGenerateMipmap",
+	"glBlitFramebuffer",
+	"glRenderbufferStorageMultisample",
+	"glFramebufferTextureLayer",
+	"glMapBufferRange",
+	"glFlushMappedBufferRange",
+	"glBindVertexArray",
+	"glDeleteVertexArrays",
+	"glGenVertexArrays",
+	"glIsVertexArray",
+	"glDrawArraysInstanced",
+	"glDrawElementsInstanced",
+	"glTexBuffer",
+	"glPrimitiveRestartIndex",
+	"glCopyBufferSubData",
+	"glGetUniformIndices",
+	"glGetActiveUniformsiv",
+	"glGetActiveUniformName",
+	"glGetUniformBlockIndex",
+	"glGetActiveUniformBlockiv",
+	"glGetActiveUniformBlockName",
+	"glUniformBlockBinding",
+	"glDrawElementsBaseVertex",
+	"glDrawRangeElementsBaseVertex",
+	"glDrawElementsInstancedBaseVertex",
+	"glMultiDrawElementsBaseVertex",
+	"glProvokingVertex",
+	"glFenceSync",
+	"glIsSync",
+	"glDeleteSync",
+	"glClientWaitSync",
+	"glWaitSync",
+	"glGetInteger64v",
+	"glGetSynciv",
+	"glGetInteger64i_v",
+	"glGetBufferParameteri64v",
+	"glFramebufferTexture",
+	"glTexImage2DMultisample",
+	"glTexImage3DMultisample",
+	"glGetMultisamplefv",
+	"glSampleMaski",
+	"glBindFragDataLocationIndexed",
+	"glGetFragDataIndex",
+	"glGenSamplers",
+	"glDeleteSamplers",
+	"glIsSampler",
+	"glBindSampler",
+	"glSamplerParameteri",
+	"glSamplerParameteriv",
+	"glSamplerParameterf",
+	"glSamplerParameterfv",
+	"glSamplerParameterIiv",
+	"glSamplerParameterIuiv",
+	"glGetSamplerParameteriv",
+	"glGetSamplerParameterIiv",
+	"glGetSamplerParameterfv",
+	"glGetSamplerParameterIuiv",
+	"glQueryCounter",
+	"glGetQueryObjecti64v",
+	"glGetQueryObjectui64v",
+	"glVertexAttribDivisor",
+	"glVertexAttribP1ui",
+	"glVertexAttribP1uiv",
+	"glVertexAttribP2ui",
+	"glVertexAttribP2uiv",
+	"glVertexAttribP3ui",
+	"glVertexAttribP3uiv",
+	"glVertexAttribP4ui",
+	"glVertexAttribP4uiv",
+};
+uint32_t const GLNull::FunctionCount = uint32_t(sizeof(GLNull::FunctionNames) / sizeof(GLNull::FunctionNames[0]));
+
+GLNull::GLNull() : calls(FunctionCount, 0) {
+}
+
+void GLNull::reset() {
+	calls.assign(FunctionCount, 0);
+	total = binds = uniforms = draws = vertices = uploaded_bytes = 0;
+	trace.clear();
+}
+
+GLNull gl_null;
+
+static GLuint next_name = 0; //last object name handed out by glGen* / glCreate*
+
+static void call(uint32_t function) {
+	gl_null.calls[function] += 1;
+	gl_null.total += 1;
+	if (gl_null.tracing) gl_null.trace.emplace_back(uint16_t(function));
+}
+
+//memory handed out by glMap*:
+static void *scratch(size_t bytes) {
+	static std::vector< char > memory;
+	if (memory.size() < bytes) memory.resize(bytes);
+	return memory.data();
+}
+
+//values for glGet*v (up to four of them); returns false (leaving 'data' alone) for anything else:
+static bool get(GLenum pname, GLint *data) {
+	switch (pname) {
+		case GL_VIEWPORT: case GL_SCISSOR_BOX: data[0] = data[1] = 0; data[2] = data[3] = 1; return true;
+		case GL_DEPTH_FUNC: *data = GL_LESS; return true;
+		case GL_DEPTH_WRITEMASK: *data = GL_TRUE; return true;
+		case GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT: *data = 256; return true;
+		case GL_MAX_TEXTURE_SIZE: *data = 16384; return true;
+		case GL_MAX_UNIFORM_BLOCK_SIZE: *data = 65536; return true;
+		case GL_MAX_TEXTURE_BUFFER_SIZE: *data = 1 << 27; return true;
+		case GL_DRAW_FRAMEBUFFER_BINDING: case GL_READ_FRAMEBUFFER_BINDING: *data = 0; return true;
+		default: return false;
+	}
+}
+
+void init_GL() {
+	//nothing to look up
+}
+
+extern "C" {
+
+void APIENTRY glCullFace (GLenum mode) { (void)mode; call(0); }
+void APIENTRY glFrontFace (GLenum mode) { (void)mode; call(1); }
+void APIENTRY glHint (GLenum target, GLenum mode) { (void)target; (void)mode; call(2); }
+void APIENTRY glLineWidth (GLfloat width) { (void)width; call(3); }
+void APIENTRY glPointSize (GLfloat size) { (void)size; call(4); }
+void APIENTRY glPolygonMode (GLenum face, GLenum mode) { (void)face; (void)mode; call(5); }
+void APIENTRY glScissor (GLint x, GLint y, GLsizei width, GLsizei height) { (void)x; (void)y; (void)width; (void)height; call(6); }
+void APIENTRY glTexParameterf (GLenum target, GLenum pname, GLfloat param) { (void)target; (void)pname; (void)param; call(7); }
+void APIENTRY glTexParameterfv (GLenum target, GLenum pname, const GLfloat *params) { (void)target; (void)pname; (void)params; call(8); }
+void APIENTRY glTexParameteri (GLenum target, GLenum pname, GLint param) { (void)target; (void)pname; (void)param; call(9); }
+void APIENTRY glTexParameteriv (GLenum target, GLenum pname, const GLint *params) { (void)target; (void)pname; (void)params; call(10); }
+void APIENTRY glTexImage1D (GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) { (void)target; (void)level; (void)internalformat; (void)width; (void)border; (void)format; (void)type; (void)pixels; call(11); }
+void APIENTRY glTexImage2D (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) { (void)target; (void)level; (void)internalformat; (void)width; (void)height; (void)border; (void)format; (void)type; (void)pixels; call(12); }
+void APIENTRY glDrawBuffer (GLenum buf) { (void)buf; call(13); }
+void APIENTRY glClear (GLbitfield mask) { (void)mask; call(14); }
+void APIENTRY glClearColor (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) { (void)red; (void)green; (void)blue; (void)alpha; call(15); }
+void APIENTRY glClearStencil (GLint s) { (void)s; call(16); }
+void APIENTRY glClearDepth (GLdouble depth) { (void)depth; call(17); }
+void APIENTRY glStencilMask (GLuint mask) { (void)mask; call(18); }
+void APIENTRY glColorMask (GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) { (void)red; (void)green; (void)blue; (void)alpha; call(19); }
+void APIENTRY glDepthMask (GLboolean flag) { (void)flag; call(20); }
+void APIENTRY glDisable (GLenum cap) { (void)cap; call(21); }
+void APIENTRY glEnable (GLenum cap) { (void)cap; call(22); }
+void APIENTRY glFinish (void) { call(23); }
+void APIENTRY glFlush (void) { call(24); }
+void APIENTRY glBlendFunc (GLenum sfactor, GLenum dfactor) { (void)sfactor; (void)dfactor; call(25); }
+void APIENTRY glLogicOp (GLenum opcode) { (void)opcode; call(26); }
+void APIENTRY glStencilFunc (GLenum func, GLint ref, GLuint mask) { (void)func; (void)ref; (void)mask; call(27); }
+void APIENTRY glStencilOp (GLenum fail, GLenum zfail, GLenum zpass) { (void)fail; (void)zfail; (void)zpass; call(28); }
+void APIENTRY glDepthFunc (GLenum func) { (void)func; call(29); }
+void APIENTRY glPixelStoref (GLenum pname, GLfloat param) { (void)pname; (void)param; call(30); }
+void APIENTRY glPixelStorei (GLenum pname, GLint param) { (void)pname; (void)param; call(31); }
+void APIENTRY glReadBuffer (GLenum src) { (void)src; call(32); }
+void APIENTRY glReadPixels (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) { (void)x; (void)y; (void)width; (void)height; (void)format; (void)type; (void)pixels; call(33); }
+void APIENTRY glGetBooleanv (GLenum pname, GLboolean *data) { call(34); GLint value[4] = { 0, 0, 0, 0 }; if (get(pname, value)) *data = GLboolean(value[0]); }
+void APIENTRY glGetDoublev (GLenum pname, GLdouble *data) { (void)pname; (void)data; call(35); }
+GLenum APIENTRY glGetError (void) { call(36); return GL_NO_ERROR; }
+void APIENTRY glGetFloatv (GLenum pname, GLfloat *data) { call(37); GLint value[4] = { 0, 0, 0, 0 }; if (get(pname, value)) *data = GLfloat(value[0]); }
+void APIENTRY glGetIntegerv (GLenum pname, GLint *data) { call(38); get(pname, data); }
+const GLubyte * APIENTRY glGetString (GLenum name) { (void)name; call(39); static GLubyte const null[] = "null"; return null; }
+void APIENTRY glGetTexImage (GLenum target, GLint level, GLenum format, GLenum type, void *pixels) { (void)target; (void)level; (void)format; (void)type; (void)pixels; call(40); }
+void APIENTRY glGetTexParameterfv (GLenum target, GLenum pname, GLfloat *params) { (void)target; (void)pname; (void)params; call(41); }
+void APIENTRY glGetTexParameteriv (GLenum target, GLenum pname, GLint *params) { (void)target; (void)pname; (void)params; call(42); }
+void APIENTRY glGetTexLevelParameterfv (GLenum target, GLint level, GLenum pname, GLfloat *params) { (void)target; (void)level; (void)pname; (void)params; call(43); }
+void APIENTRY glGetTexLevelParameteriv (GLenum target, GLint level, GLenum pname, GLint *params) { (void)target; (void)level; (void)pname; (void)params; call(44); }
+GLboolean APIENTRY glIsEnabled (GLenum cap) { (void)cap; call(45); return GL_FALSE; }
+void APIENTRY glDepthRange (GLdouble n, GLdouble f) { (void)n; (void)f; call(46); }
+void APIENTRY glViewport (GLint x, GLint y, GLsizei width, GLsizei height) { (void)x; (void)y; (void)width; (void)height; call(47); }
+void APIENTRY glDrawArrays (GLenum mode, GLint first, GLsizei count) { (void)mode; (void)first; call(48); gl_null.draws += 1; gl_null.vertices += uint64_t(count); }
+void APIENTRY glDrawElements (GLenum mode, GLsizei count, GLenum type, const void *indices) { (void)mode; (void)type; (void)indices; call(49); gl_null.draws += 1; gl_null.vertices += uint64_t(count); }
+void APIENTRY glGetPointerv (GLenum pname, void **params) { (void)pname; (void)params; call(50); }
+void APIENTRY glPolygonOffset (GLfloat factor, GLfloat units) { (void)factor; (void)units; call(51); }
+void APIENTRY glCopyTexImage1D (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) { (void)target; (void)level; (void)internalformat; (void)x; (void)y; (void)width; (void)border; call(52); }
+void APIENTRY glCopyTexImage2D (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) { (void)target; (void)level; (void)internalformat; (void)x; (void)y; (void)width; (void)height; (void)border; call(53); }
+void APIENTRY glCopyTexSubImage1D (GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) { (void)target; (void)level; (void)xoffset; (void)x; (void)y; (void)width; call(54); }
+void APIENTRY glCopyTexSubImage2D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) { (void)target; (void)level; (void)xoffset; (void)yoffset; (void)x; (void)y; (void)width; (void)height; call(55); }
+void APIENTRY glTexSubImage1D (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) { (void)target; (void)level; (void)xoffset; (void)width; (void)format; (void)type; (void)pixels; call(56); }
+void APIENTRY glTexSubImage2D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) { (void)target; (void)level; (void)xoffset; (void)yoffset; (void)width; (void)height; (void)format; (void)type; (void)pixels; call(57); }
+void APIENTRY glBindTexture (GLenum target, GLuint texture) { (void)target; (void)texture; call(58); gl_null.binds += 1; }
+void APIENTRY glDeleteTextures (GLsizei n, const GLuint *textures) { (void)n; (void)textures; call(59); }
+void APIENTRY glGenTextures (GLsizei n, GLuint *textures) { call(60); for (GLsizei i = 0; i < n; ++i) textures[i] = ++next_name; }
+GLboolean APIENTRY glIsTexture (GLuint texture) { (void)texture; call(61); return GLboolean(0); }
+#ifdef _WIN32
+static void APIENTRY null_glDrawRangeElements (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) { (void)mode; (void)start; (void)end; (void)type; (void)indices; call(62); gl_null.draws += 1; gl_null.vertices += uint64_t(count); }
+void (APIENTRYFP glDrawRangeElements) (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) = null_glDrawRangeElements;
+#else
+void APIENTRY glDrawRangeElements (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) { (void)mode; (void)start; (void)end; (void)type; (void)indices; call(62); gl_null.draws += 1; gl_null.vertices += uint64_t(count); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glTexImage3D (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) { (void)target; (void)level; (void)internalformat; (void)width; (void)height; (void)depth; (void)border; (void)format; (void)type; (void)pixels; call(63); }
+void (APIENTRYFP glTexImage3D) (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) = null_glTexImage3D;
+#else
+void APIENTRY glTexImage3D (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) { (void)target; (void)level; (void)internalformat; (void)width; (void)height; (void)depth; (void)border; (void)format; (void)type; (void)pixels; call(63); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glTexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) { (void)target; (void)level; (void)xoffset; (void)yoffset; (void)zoffset; (void)width; (void)height; (void)depth; (void)format; (void)type; (void)pixels; call(64); }
+void (APIENTRYFP glTexSubImage3D) (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) = null_glTexSubImage3D;
+#else
+void APIENTRY glTexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) { (void)target; (void)level; (void)xoffset; (void)yoffset; (void)zoffset; (void)width; (void)height; (void)depth; (void)format; (void)type; (void)pixels; call(64); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glCopyTexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) { (void)target; (void)level; (void)xoffset; (void)yoffset; (void)zoffset; (void)x; (void)y; (void)width; (void)height; call(65); }
+void (APIENTRYFP glCopyTexSubImage3D) (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) = null_glCopyTexSubImage3D;
+#else
+void APIENTRY glCopyTexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) { (void)target; (void)level; (void)xoffset; (void)yoffset; (void)zoffset; (void)x; (void)y; (void)width; (void)height; call(65); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glActiveTexture (GLenum texture) { (void)texture; call(66); gl_null.binds += 1; }
+void (APIENTRYFP glActiveTexture) (GLenum texture) = null_glActiveTexture;
+#else
+void APIENTRY glActiveTexture (GLenum texture) { (void)texture; call(66); gl_null.binds += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glSampleCoverage (GLfloat value, GLboolean invert) { (void)value; (void)invert; call(67); }
+void (APIENTRYFP glSampleCoverage) (GLfloat value, GLboolean invert) = null_glSampleCoverage;
+#else
+void APIENTRY glSampleCoverage (GLfloat value, GLboolean invert) { (void)value; (void)invert; call(67); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glCompressedTexImage3D (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) { (void)target; (void)level; (void)internalformat; (void)width; (void)height; (void)depth; (void)border; (void)imageSize; (void)data; call(68); }
+void (APIENTRYFP glCompressedTexImage3D) (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) = null_glCompressedTexImage3D;
+#else
+void APIENTRY glCompressedTexImage3D (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) { (void)target; (void)level; (void)internalformat; (void)width; (void)height; (void)depth; (void)border; (void)imageSize; (void)data; call(68); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glCompressedTexImage2D (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) { (void)target; (void)level; (void)internalformat; (void)width; (void)height; (void)border; (void)imageSize; (void)data; call(69); }
+void (APIENTRYFP glCompressedTexImage2D) (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) = null_glCompressedTexImage2D;
+#else
+void APIENTRY glCompressedTexImage2D (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) { (void)target; (void)level; (void)internalformat; (void)width; (void)height; (void)border; (void)imageSize; (void)data; call(69); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glCompressedTexImage1D (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) { (void)target; (void)level; (void)internalformat; (void)width; (void)border; (void)imageSize; (void)data; call(70); }
+void (APIENTRYFP glCompressedTexImage1D) (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) = null_glCompressedTexImage1D;
+#else
+void APIENTRY glCompressedTexImage1D (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) { (void)target; (void)level; (void)internalformat; (void)width; (void)border; (void)imageSize; (void)data; call(70); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glCompressedTexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) { (void)target; (void)level; (void)xoffset; (void)yoffset; (void)zoffset; (void)width; (void)height; (void)depth; (void)format; (void)imageSize; (void)data; call(71); }
+void (APIENTRYFP glCompressedTexSubImage3D) (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) = null_glCompressedTexSubImage3D;
+#else
+void APIENTRY glCompressedTexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) { (void)target; (void)level; (void)xoffset; (void)yoffset; (void)zoffset; (void)width; (void)height; (void)depth; (void)format; (void)imageSize; (void)data; call(71); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glCompressedTexSubImage2D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) { (void)target; (void)level; (void)xoffset; (void)yoffset; (void)width; (void)height; (void)format; (void)imageSize; (void)data; call(72); }
+void (APIENTRYFP glCompressedTexSubImage2D) (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) = null_glCompressedTexSubImage2D;
+#else
+void APIENTRY glCompressedTexSubImage2D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) { (void)target; (void)level; (void)xoffset; (void)yoffset; (void)width; (void)height; (void)format; (void)imageSize; (void)data; call(72); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glCompressedTexSubImage1D (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) { (void)target; (void)level; (void)xoffset; (void)width; (void)format; (void)imageSize; (void)data; call(73); }
+void (APIENTRYFP glCompressedTexSubImage1D) (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) = null_glCompressedTexSubImage1D;
+#else
+void APIENTRY glCompressedTexSubImage1D (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) { (void)target; (void)level; (void)xoffset; (void)width; (void)format; (void)imageSize; (void)data; call(73); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetCompressedTexImage (GLenum target, GLint level, void *img) { (void)target; (void)level; (void)img; call(74); }
+void (APIENTRYFP glGetCompressedTexImage) (GLenum target, GLint level, void *img) = null_glGetCompressedTexImage;
+#else
+void APIENTRY glGetCompressedTexImage (GLenum target, GLint level, void *img) { (void)target; (void)level; (void)img; call(74); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glBlendFuncSeparate (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) { (void)sfactorRGB; (void)dfactorRGB; (void)sfactorAlpha; (void)dfactorAlpha; call(75); }
+void (APIENTRYFP glBlendFuncSeparate) (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) = null_glBlendFuncSeparate;
+#else
+void APIENTRY glBlendFuncSeparate (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) { (void)sfactorRGB; (void)dfactorRGB; (void)sfactorAlpha; (void)dfactorAlpha; call(75); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glMultiDrawArrays (GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) { (void)mode; (void)first; (void)count; (void)drawcount; call(76); gl_null.draws += 1; }
+void (APIENTRYFP glMultiDrawArrays) (GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) = null_glMultiDrawArrays;
+#else
+void APIENTRY glMultiDrawArrays (GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) { (void)mode; (void)first; (void)count; (void)drawcount; call(76); gl_null.draws += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glMultiDrawElements (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) { (void)mode; (void)count; (void)type; (void)indices; (void)drawcount; call(77); gl_null.draws += 1; }
+void (APIENTRYFP glMultiDrawElements) (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) = null_glMultiDrawElements;
+#else
+void APIENTRY glMultiDrawElements (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) { (void)mode; (void)count; (void)type; (void)indices; (void)drawcount; call(77); gl_null.draws += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glPointParameterf (GLenum pname, GLfloat param) { (void)pname; (void)param; call(78); }
+void (APIENTRYFP glPointParameterf) (GLenum pname, GLfloat param) = null_glPointParameterf;
+#else
+void APIENTRY glPointParameterf (GLenum pname, GLfloat param) { (void)pname; (void)param; call(78); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glPointParameterfv (GLenum pname, const GLfloat *params) { (void)pname; (void)params; call(79); }
+void (APIENTRYFP glPointParameterfv) (GLenum pname, const GLfloat *params) = null_glPointParameterfv;
+#else
+void APIENTRY glPointParameterfv (GLenum pname, const GLfloat *params) { (void)pname; (void)params; call(79); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glPointParameteri (GLenum pname, GLint param) { (void)pname; (void)param; call(80); }
+void (APIENTRYFP glPointParameteri) (GLenum pname, GLint param) = null_glPointParameteri;
+#else
+void APIENTRY glPointParameteri (GLenum pname, GLint param) { (void)pname; (void)param; call(80); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glPointParameteriv (GLenum pname, const GLint *params) { (void)pname; (void)params; call(81); }
+void (APIENTRYFP glPointParameteriv) (GLenum pname, const GLint *params) = null_glPointParameteriv;
+#else
+void APIENTRY glPointParameteriv (GLenum pname, const GLint *params) { (void)pname; (void)params; call(81); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glBlendColor (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) { (void)red; (void)green; (void)blue; (void)alpha; call(82); }
+void (APIENTRYFP glBlendColor) (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) = null_glBlendColor;
+#else
+void APIENTRY glBlendColor (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) { (void)red; (void)green; (void)blue; (void)alpha; call(82); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glBlendEquation (GLenum mode) { (void)mode; call(83); }
+void (APIENTRYFP glBlendEquation) (GLenum mode) = null_glBlendEquation;
+#else
+void APIENTRY glBlendEquation (GLenum mode) { (void)mode; call(83); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGenQueries (GLsizei n, GLuint *ids) { call(84); for (GLsizei i = 0; i < n; ++i) ids[i] = ++next_name; }
+void (APIENTRYFP glGenQueries) (GLsizei n, GLuint *ids) = null_glGenQueries;
+#else
+void APIENTRY glGenQueries (GLsizei n, GLuint *ids) { call(84); for (GLsizei i = 0; i < n; ++i) ids[i] = ++next_name; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glDeleteQueries (GLsizei n, const GLuint *ids) { (void)n; (void)ids; call(85); }
+void (APIENTRYFP glDeleteQueries) (GLsizei n, const GLuint *ids) = null_glDeleteQueries;
+#else
+void APIENTRY glDeleteQueries (GLsizei n, const GLuint *ids) { (void)n; (void)ids; call(85); }
+#endif
+#ifdef _WIN32
+static GLboolean APIENTRY null_glIsQuery (GLuint id) { (void)id; call(86); return GLboolean(0); }
+GLboolean (APIENTRYFP glIsQuery) (GLuint id) = null_glIsQuery;
+#else
+GLboolean APIENTRY glIsQuery (GLuint id) { (void)id; call(86); return GLboolean(0); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glBeginQuery (GLenum target, GLuint id) { (void)target; (void)id; call(87); }
+void (APIENTRYFP glBeginQuery) (GLenum target, GLuint id) = null_glBeginQuery;
+#else
+void APIENTRY glBeginQuery (GLenum target, GLuint id) { (void)target; (void)id; call(87); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glEndQuery (GLenum target) { (void)target; call(88); }
+void (APIENTRYFP glEndQuery) (GLenum target) = null_glEndQuery;
+#else
+void APIENTRY glEndQuery (GLenum target) { (void)target; call(88); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetQueryiv (GLenum target, GLenum pname, GLint *params) { (void)target; (void)pname; (void)params; call(89); }
+void (APIENTRYFP glGetQueryiv) (GLenum target, GLenum pname, GLint *params) = null_glGetQueryiv;
+#else
+void APIENTRY glGetQueryiv (GLenum target, GLenum pname, GLint *params) { (void)target; (void)pname; (void)params; call(89); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetQueryObjectiv (GLuint id, GLenum pname, GLint *params) { (void)id; call(90); if (params) *params = (pname == GL_QUERY_RESULT_AVAILABLE ? GL_TRUE : 0); }
+void (APIENTRYFP glGetQueryObjectiv) (GLuint id, GLenum pname, GLint *params) = null_glGetQueryObjectiv;
+#else
+void APIENTRY glGetQueryObjectiv (GLuint id, GLenum pname, GLint *params) { (void)id; call(90); if (params) *params = (pname == GL_QUERY_RESULT_AVAILABLE ? GL_TRUE : 0); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetQueryObjectuiv (GLuint id, GLenum pname, GLuint *params) { (void)id; call(91); if (params) *params = (pname == GL_QUERY_RESULT_AVAILABLE ? GL_TRUE : 0); }
+void (APIENTRYFP glGetQueryObjectuiv) (GLuint id, GLenum pname, GLuint *params) = null_glGetQueryObjectuiv;
+#else
+void APIENTRY glGetQueryObjectuiv (GLuint id, GLenum pname, GLuint *params) { (void)id; call(91); if (params) *params = (pname == GL_QUERY_RESULT_AVAILABLE ? GL_TRUE : 0); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glBindBuffer (GLenum target, GLuint buffer) { (void)target; (void)buffer; call(92); gl_null.binds += 1; }
+void (APIENTRYFP glBindBuffer) (GLenum target, GLuint buffer) = null_glBindBuffer;
+#else
+void APIENTRY glBindBuffer (GLenum target, GLuint buffer) { (void)target; (void)buffer; call(92); gl_null.binds += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glDeleteBuffers (GLsizei n, const GLuint *buffers) { (void)n; (void)buffers; call(93); }
+void (APIENTRYFP glDeleteBuffers) (GLsizei n, const GLuint *buffers) = null_glDeleteBuffers;
+#else
+void APIENTRY glDeleteBuffers (GLsizei n, const GLuint *buffers) { (void)n; (void)buffers; call(93); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGenBuffers (GLsizei n, GLuint *buffers) { call(94); for (GLsizei i = 0; i < n; ++i) buffers[i] = ++next_name; }
+void (APIENTRYFP glGenBuffers) (GLsizei n, GLuint *buffers) = null_glGenBuffers;
+#else
+void APIENTRY glGenBuffers (GLsizei n, GLuint *buffers) { call(94); for (GLsizei i = 0; i < n; ++i) buffers[i] = ++next_name; }
+#endif
+#ifdef _WIN32
+static GLboolean APIENTRY null_glIsBuffer (GLuint buffer) { (void)buffer; call(95); return GLboolean(0); }
+GLboolean (APIENTRYFP glIsBuffer) (GLuint buffer) = null_glIsBuffer;
+#else
+GLboolean APIENTRY glIsBuffer (GLuint buffer) { (void)buffer; call(95); return GLboolean(0); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glBufferData (GLenum target, GLsizeiptr size, const void *data, GLenum usage) { (void)target; (void)usage; call(96); if (data) gl_null.uploaded_bytes += uint64_t(size); }
+void (APIENTRYFP glBufferData) (GLenum target, GLsizeiptr size, const void *data, GLenum usage) = null_glBufferData;
+#else
+void APIENTRY glBufferData (GLenum target, GLsizeiptr size, const void *data, GLenum usage) { (void)target; (void)usage; call(96); if (data) gl_null.uploaded_bytes += uint64_t(size); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glBufferSubData (GLenum target, GLintptr offset, GLsizeiptr size, const void *data) { (void)target; (void)offset; (void)data; call(97); gl_null.uploaded_bytes += uint64_t(size); }
+void (APIENTRYFP glBufferSubData) (GLenum target, GLintptr offset, GLsizeiptr size, const void *data) = null_glBufferSubData;
+#else
+void APIENTRY glBufferSubData (GLenum target, GLintptr offset, GLsizeiptr size, const void *data) { (void)target; (void)offset; (void)data; call(97); gl_null.uploaded_bytes += uint64_t(size); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetBufferSubData (GLenum target, GLintptr offset, GLsizeiptr size, void *data) { (void)target; (void)offset; (void)size; (void)data; call(98); }
+void (APIENTRYFP glGetBufferSubData) (GLenum target, GLintptr offset, GLsizeiptr size, void *data) = null_glGetBufferSubData;
+#else
+void APIENTRY glGetBufferSubData (GLenum target, GLintptr offset, GLsizeiptr size, void *data) { (void)target; (void)offset; (void)size; (void)data; call(98); }
+#endif
+#ifdef _WIN32
+static void * APIENTRY null_glMapBuffer (GLenum target, GLenum access) { (void)target; (void)access; call(99); return scratch(1 << 20); }
+void * (APIENTRYFP glMapBuffer) (GLenum target, GLenum access) = null_glMapBuffer;
+#else
+void * APIENTRY glMapBuffer (GLenum target, GLenum access) { (void)target; (void)access; call(99); return scratch(1 << 20); }
+#endif
+#ifdef _WIN32
+static GLboolean APIENTRY null_glUnmapBuffer (GLenum target) { (void)target; call(100); return GL_TRUE; }
+GLboolean (APIENTRYFP glUnmapBuffer) (GLenum target) = null_glUnmapBuffer;
+#else
+GLboolean APIENTRY glUnmapBuffer (GLenum target) { (void)target; call(100); return GL_TRUE; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetBufferParameteriv (GLenum target, GLenum pname, GLint *params) { (void)target; (void)pname; call(101); if (params) *params = 0; }
+void (APIENTRYFP glGetBufferParameteriv) (GLenum target, GLenum pname, GLint *params) = null_glGetBufferParameteriv;
+#else
+void APIENTRY glGetBufferParameteriv (GLenum target, GLenum pname, GLint *params) { (void)target; (void)pname; call(101); if (params) *params = 0; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetBufferPointerv (GLenum target, GLenum pname, void **params) { (void)target; (void)pname; (void)params; call(102); }
+void (APIENTRYFP glGetBufferPointerv) (GLenum target, GLenum pname, void **params) = null_glGetBufferPointerv;
+#else
+void APIENTRY glGetBufferPointerv (GLenum target, GLenum pname, void **params) { (void)target; (void)pname; (void)params; call(102); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glBlendEquationSeparate (GLenum modeRGB, GLenum modeAlpha) { (void)modeRGB; (void)modeAlpha; call(103); }
+void (APIENTRYFP glBlendEquationSeparate) (GLenum modeRGB, GLenum modeAlpha) = null_glBlendEquationSeparate;
+#else
+void APIENTRY glBlendEquationSeparate (GLenum modeRGB, GLenum modeAlpha) { (void)modeRGB; (void)modeAlpha; call(103); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glDrawBuffers (GLsizei n, const GLenum *bufs) { (void)n; (void)bufs; call(104); }
+void (APIENTRYFP glDrawBuffers) (GLsizei n, const GLenum *bufs) = null_glDrawBuffers;
+#else
+void APIENTRY glDrawBuffers (GLsizei n, const GLenum *bufs) { (void)n; (void)bufs; call(104); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glStencilOpSeparate (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) { (void)face; (void)sfail; (void)dpfail; (void)dppass; call(105); }
+void (APIENTRYFP glStencilOpSeparate) (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) = null_glStencilOpSeparate;
+#else
+void APIENTRY glStencilOpSeparate (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) { (void)face; (void)sfail; (void)dpfail; (void)dppass; call(105); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glStencilFuncSeparate (GLenum face, GLenum func, GLint ref, GLuint mask) { (void)face; (void)func; (void)ref; (void)mask; call(106); }
+void (APIENTRYFP glStencilFuncSeparate) (GLenum face, GLenum func, GLint ref, GLuint mask) = null_glStencilFuncSeparate;
+#else
+void APIENTRY glStencilFuncSeparate (GLenum face, GLenum func, GLint ref, GLuint mask) { (void)face; (void)func; (void)ref; (void)mask; call(106); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glStencilMaskSeparate (GLenum face, GLuint mask) { (void)face; (void)mask; call(107); }
+void (APIENTRYFP glStencilMaskSeparate) (GLenum face, GLuint mask) = null_glStencilMaskSeparate;
+#else
+void APIENTRY glStencilMaskSeparate (GLenum face, GLuint mask) { (void)face; (void)mask; call(107); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glAttachShader (GLuint program, GLuint shader) { (void)program; (void)shader; call(108); }
+void (APIENTRYFP glAttachShader) (GLuint program, GLuint shader) = null_glAttachShader;
+#else
+void APIENTRY glAttachShader (GLuint program, GLuint shader) { (void)program; (void)shader; call(108); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glBindAttribLocation (GLuint program, GLuint index, const GLchar *name) { (void)program; (void)index; (void)name; call(109); gl_null.binds += 1; }
+void (APIENTRYFP glBindAttribLocation) (GLuint program, GLuint index, const GLchar *name) = null_glBindAttribLocation;
+#else
+void APIENTRY glBindAttribLocation (GLuint program, GLuint index, const GLchar *name) { (void)program; (void)index; (void)name; call(109); gl_null.binds += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glCompileShader (GLuint shader) { (void)shader; call(110); }
+void (APIENTRYFP glCompileShader) (GLuint shader) = null_glCompileShader;
+#else
+void APIENTRY glCompileShader (GLuint shader) { (void)shader; call(110); }
+#endif
+#ifdef _WIN32
+static GLuint APIENTRY null_glCreateProgram (void) { call(111); return ++next_name; }
+GLuint (APIENTRYFP glCreateProgram) (void) = null_glCreateProgram;
+#else
+GLuint APIENTRY glCreateProgram (void) { call(111); return ++next_name; }
+#endif
+#ifdef _WIN32
+static GLuint APIENTRY null_glCreateShader (GLenum type) { (void)type; call(112); return ++next_name; }
+GLuint (APIENTRYFP glCreateShader) (GLenum type) = null_glCreateShader;
+#else
+GLuint APIENTRY glCreateShader (GLenum type) { (void)type; call(112); return ++next_name; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glDeleteProgram (GLuint program) { (void)program; call(113); }
+void (APIENTRYFP glDeleteProgram) (GLuint program) = null_glDeleteProgram;
+#else
+void APIENTRY glDeleteProgram (GLuint program) { (void)program; call(113); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glDeleteShader (GLuint shader) { (void)shader; call(114); }
+void (APIENTRYFP glDeleteShader) (GLuint shader) = null_glDeleteShader;
+#else
+void APIENTRY glDeleteShader (GLuint shader) { (void)shader; call(114); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glDetachShader (GLuint program, GLuint shader) { (void)program; (void)shader; call(115); }
+void (APIENTRYFP glDetachShader) (GLuint program, GLuint shader) = null_glDetachShader;
+#else
+void APIENTRY glDetachShader (GLuint program, GLuint shader) { (void)program; (void)shader; call(115); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glDisableVertexAttribArray (GLuint index) { (void)index; call(116); }
+void (APIENTRYFP glDisableVertexAttribArray) (GLuint index) = null_glDisableVertexAttribArray;
+#else
+void APIENTRY glDisableVertexAttribArray (GLuint index) { (void)index; call(116); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glEnableVertexAttribArray (GLuint index) { (void)index; call(117); }
+void (APIENTRYFP glEnableVertexAttribArray) (GLuint index) = null_glEnableVertexAttribArray;
+#else
+void APIENTRY glEnableVertexAttribArray (GLuint index) { (void)index; call(117); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetActiveAttrib (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) { (void)program; (void)index; (void)bufSize; (void)length; (void)size; (void)type; (void)name; call(118); }
+void (APIENTRYFP glGetActiveAttrib) (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) = null_glGetActiveAttrib;
+#else
+void APIENTRY glGetActiveAttrib (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) { (void)program; (void)index; (void)bufSize; (void)length; (void)size; (void)type; (void)name; call(118); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetActiveUniform (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) { (void)program; (void)index; (void)bufSize; (void)length; (void)size; (void)type; (void)name; call(119); }
+void (APIENTRYFP glGetActiveUniform) (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) = null_glGetActiveUniform;
+#else
+void APIENTRY glGetActiveUniform (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) { (void)program; (void)index; (void)bufSize; (void)length; (void)size; (void)type; (void)name; call(119); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetAttachedShaders (GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) { (void)program; (void)maxCount; (void)count; (void)shaders; call(120); }
+void (APIENTRYFP glGetAttachedShaders) (GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) = null_glGetAttachedShaders;
+#else
+void APIENTRY glGetAttachedShaders (GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) { (void)program; (void)maxCount; (void)count; (void)shaders; call(120); }
+#endif
+#ifdef _WIN32
+static GLint APIENTRY null_glGetAttribLocation (GLuint program, const GLchar *name) { (void)program; (void)name; call(121); return 0; }
+GLint (APIENTRYFP glGetAttribLocation) (GLuint program, const GLchar *name) = null_glGetAttribLocation;
+#else
+GLint APIENTRY glGetAttribLocation (GLuint program, const GLchar *name) { (void)program; (void)name; call(121); return 0; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetProgramiv (GLuint program, GLenum pname, GLint *params) { (void)program; call(122); if (params) *params = (pname == GL_LINK_STATUS || pname == GL_VALIDATE_STATUS ? GL_TRUE : 0); }
+void (APIENTRYFP glGetProgramiv) (GLuint program, GLenum pname, GLint *params) = null_glGetProgramiv;
+#else
+void APIENTRY glGetProgramiv (GLuint program, GLenum pname, GLint *params) { (void)program; call(122); if (params) *params = (pname == GL_LINK_STATUS || pname == GL_VALIDATE_STATUS ? GL_TRUE : 0); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetProgramInfoLog (GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) { (void)program; call(123); if (length) *length = 0; if (bufSize > 0) infoLog[0] = '\0'; }
+void (APIENTRYFP glGetProgramInfoLog) (GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) = null_glGetProgramInfoLog;
+#else
+void APIENTRY glGetProgramInfoLog (GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) { (void)program; call(123); if (length) *length = 0; if (bufSize > 0) infoLog[0] = '\0'; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetShaderiv (GLuint shader, GLenum pname, GLint *params) { (void)shader; call(124); if (params) *params = (pname == GL_COMPILE_STATUS ? GL_TRUE : 0); }
+void (APIENTRYFP glGetShaderiv) (GLuint shader, GLenum pname, GLint *params) = null_glGetShaderiv;
+#else
+void APIENTRY glGetShaderiv (GLuint shader, GLenum pname, GLint *params) { (void)shader; call(124); if (params) *params = (pname == GL_COMPILE_STATUS ? GL_TRUE : 0); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetShaderInfoLog (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) { (void)shader; call(125); if (length) *length = 0; if (bufSize > 0) infoLog[0] = '\0'; }
+void (APIENTRYFP glGetShaderInfoLog) (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) = null_glGetShaderInfoLog;
+#else
+void APIENTRY glGetShaderInfoLog (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) { (void)shader; call(125); if (length) *length = 0; if (bufSize > 0) infoLog[0] = '\0'; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetShaderSource (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) { (void)shader; (void)bufSize; (void)length; (void)source; call(126); }
+void (APIENTRYFP glGetShaderSource) (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) = null_glGetShaderSource;
+#else
+void APIENTRY glGetShaderSource (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) { (void)shader; (void)bufSize; (void)length; (void)source; call(126); }
+#endif
+#ifdef _WIN32
+static GLint APIENTRY null_glGetUniformLocation (GLuint program, const GLchar *name) { (void)program; (void)name; call(127); return 0; }
+GLint (APIENTRYFP glGetUniformLocation) (GLuint program, const GLchar *name) = null_glGetUniformLocation;
+#else
+GLint APIENTRY glGetUniformLocation (GLuint program, const GLchar *name) { (void)program; (void)name; call(127); return 0; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetUniformfv (GLuint program, GLint location, GLfloat *params) { (void)program; (void)location; (void)params; call(128); }
+void (APIENTRYFP glGetUniformfv) (GLuint program, GLint location, GLfloat *params) = null_glGetUniformfv;
+#else
+void APIENTRY glGetUniformfv (GLuint program, GLint location, GLfloat *params) { (void)program; (void)location; (void)params; call(128); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetUniformiv (GLuint program, GLint location, GLint *params) { (void)program; (void)location; (void)params; call(129); }
+void (APIENTRYFP glGetUniformiv) (GLuint program, GLint location, GLint *params) = null_glGetUniformiv;
+#else
+void APIENTRY glGetUniformiv (GLuint program, GLint location, GLint *params) { (void)program; (void)location; (void)params; call(129); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetVertexAttribdv (GLuint index, GLenum pname, GLdouble *params) { (void)index; (void)pname; (void)params; call(130); }
+void (APIENTRYFP glGetVertexAttribdv) (GLuint index, GLenum pname, GLdouble *params) = null_glGetVertexAttribdv;
+#else
+void APIENTRY glGetVertexAttribdv (GLuint index, GLenum pname, GLdouble *params) { (void)index; (void)pname; (void)params; call(130); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetVertexAttribfv (GLuint index, GLenum pname, GLfloat *params) { (void)index; (void)pname; (void)params; call(131); }
+void (APIENTRYFP glGetVertexAttribfv) (GLuint index, GLenum pname, GLfloat *params) = null_glGetVertexAttribfv;
+#else
+void APIENTRY glGetVertexAttribfv (GLuint index, GLenum pname, GLfloat *params) { (void)index; (void)pname; (void)params; call(131); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetVertexAttribiv (GLuint index, GLenum pname, GLint *params) { (void)index; (void)pname; (void)params; call(132); }
+void (APIENTRYFP glGetVertexAttribiv) (GLuint index, GLenum pname, GLint *params) = null_glGetVertexAttribiv;
+#else
+void APIENTRY glGetVertexAttribiv (GLuint index, GLenum pname, GLint *params) { (void)index; (void)pname; (void)params; call(132); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetVertexAttribPointerv (GLuint index, GLenum pname, void **pointer) { (void)index; (void)pname; (void)pointer; call(133); }
+void (APIENTRYFP glGetVertexAttribPointerv) (GLuint index, GLenum pname, void **pointer) = null_glGetVertexAttribPointerv;
+#else
+void APIENTRY glGetVertexAttribPointerv (GLuint index, GLenum pname, void **pointer) { (void)index; (void)pname; (void)pointer; call(133); }
+#endif
+#ifdef _WIN32
+static GLboolean APIENTRY null_glIsProgram (GLuint program) { (void)program; call(134); return GLboolean(0); }
+GLboolean (APIENTRYFP glIsProgram) (GLuint program) = null_glIsProgram;
+#else
+GLboolean APIENTRY glIsProgram (GLuint program) { (void)program; call(134); return GLboolean(0); }
+#endif
+#ifdef _WIN32
+static GLboolean APIENTRY null_glIsShader (GLuint shader) { (void)shader; call(135); return GLboolean(0); }
+GLboolean (APIENTRYFP glIsShader) (GLuint shader) = null_glIsShader;
+#else
+GLboolean APIENTRY glIsShader (GLuint shader) { (void)shader; call(135); return GLboolean(0); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glLinkProgram (GLuint program) { (void)program; call(136); }
+void (APIENTRYFP glLinkProgram) (GLuint program) = null_glLinkProgram;
+#else
+void APIENTRY glLinkProgram (GLuint program) { (void)program; call(136); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glShaderSource (GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) { (void)shader; (void)count; (void)string; (void)length; call(137); }
+void (APIENTRYFP glShaderSource) (GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) = null_glShaderSource;
+#else
+void APIENTRY glShaderSource (GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) { (void)shader; (void)count; (void)string; (void)length; call(137); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glUseProgram (GLuint program) { (void)program; call(138); gl_null.binds += 1; }
+void (APIENTRYFP glUseProgram) (GLuint program) = null_glUseProgram;
+#else
+void APIENTRY glUseProgram (GLuint program) { (void)program; call(138); gl_null.binds += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glUniform1f (GLint location, GLfloat v0) { (void)location; (void)v0; call(139); gl_null.uniforms += 1; }
+void (APIENTRYFP glUniform1f) (GLint location, GLfloat v0) = null_glUniform1f;
+#else
+void APIENTRY glUniform1f (GLint location, GLfloat v0) { (void)location; (void)v0; call(139); gl_null.uniforms += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glUniform2f (GLint location, GLfloat v0, GLfloat v1) { (void)location; (void)v0; (void)v1; call(140); gl_null.uniforms += 1; }
+void (APIENTRYFP glUniform2f) (GLint location, GLfloat v0, GLfloat v1) = null_glUniform2f;
+#else
+void APIENTRY glUniform2f (GLint location, GLfloat v0, GLfloat v1) { (void)location; (void)v0; (void)v1; call(140); gl_null.uniforms += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glUniform3f (GLint location, GLfloat v0, GLfloat v1, GLfloat v2) { (void)location; (void)v0; (void)v1; (void)v2; call(141); gl_null.uniforms += 1; }
+void (APIENTRYFP glUniform3f) (GLint location, GLfloat v0, GLfloat v1, GLfloat v2) = null_glUniform3f;
+#else
+void APIENTRY glUniform3f (GLint location, GLfloat v0, GLfloat v1, GLfloat v2) { (void)location; (void)v0; (void)v1; (void)v2; call(141); gl_null.uniforms += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glUniform4f (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) { (void)location; (void)v0; (void)v1; (void)v2; (void)v3; call(142); gl_null.uniforms += 1; }
+void (APIENTRYFP glUniform4f) (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) = null_glUniform4f;
+#else
+void APIENTRY glUniform4f (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) { (void)location; (void)v0; (void)v1; (void)v2; (void)v3; call(142); gl_null.uniforms += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glUniform1i (GLint location, GLint v0) { (void)location; (void)v0; call(143); gl_null.uniforms += 1; }
+void (APIENTRYFP glUniform1i) (GLint location, GLint v0) = null_glUniform1i;
+#else
+void APIENTRY glUniform1i (GLint location, GLint v0) { (void)location; (void)v0; call(143); gl_null.uniforms += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glUniform2i (GLint location, GLint v0, GLint v1) { (void)location; (void)v0; (void)v1; call(144); gl_null.uniforms += 1; }
+void (APIENTRYFP glUniform2i) (GLint location, GLint v0, GLint v1) = null_glUniform2i;
+#else
+void APIENTRY glUniform2i (GLint location, GLint v0, GLint v1) { (void)location; (void)v0; (void)v1; call(144); gl_null.uniforms += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glUniform3i (GLint location, GLint v0, GLint v1, GLint v2) { (void)location; (void)v0; (void)v1; (void)v2; call(145); gl_null.uniforms += 1; }
+void (APIENTRYFP glUniform3i) (GLint location, GLint v0, GLint v1, GLint v2) = null_glUniform3i;
+#else
+void APIENTRY glUniform3i (GLint location, GLint v0, GLint v1, GLint v2) { (void)location; (void)v0; (void)v1; (void)v2; call(145); gl_null.uniforms += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glUniform4i (GLint location, GLint v0, GLint v1, GLint v2, GLint v3) { (void)location; (void)v0; (void)v1; (void)v2; (void)v3; call(146); gl_null.uniforms += 1; }
+void (APIENTRYFP glUniform4i) (GLint location, GLint v0, GLint v1, GLint v2, GLint v3) = null_glUniform4i;
+#else
+void APIENTRY glUniform4i (GLint location, GLint v0, GLint v1, GLint v2, GLint v3) { (void)location; (void)v0; (void)v1; (void)v2; (void)v3; call(146); gl_null.uniforms += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glUniform1fv (GLint location, GLsizei count, const GLfloat *value) { (void)location; (void)count; (void)value; call(147); gl_null.uniforms += 1; }
+void (APIENTRYFP glUniform1fv) (GLint location, GLsizei count, const GLfloat *value) = null_glUniform1fv;
+#else
+void APIENTRY glUniform1fv (GLint location, GLsizei count, const GLfloat *value) { (void)location; (void)count; (void)value; call(147); gl_null.uniforms += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glUniform2fv (GLint location, GLsizei count, const GLfloat *value) { (void)location; (void)count; (void)value; call(148); gl_null.uniforms += 1; }
+void (APIENTRYFP glUniform2fv) (GLint location, GLsizei count, const GLfloat *value) = null_glUniform2fv;
+#else
+void APIENTRY glUniform2fv (GLint location, GLsizei count, const GLfloat *value) { (void)location; (void)count; (void)value; call(148); gl_null.uniforms += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glUniform3fv (GLint location, GLsizei count, const GLfloat *value) { (void)location; (void)count; (void)value; call(149); gl_null.uniforms += 1; }
+void (APIENTRYFP glUniform3fv) (GLint location, GLsizei count, const GLfloat *value) = null_glUniform3fv;
+#else
+void APIENTRY glUniform3fv (GLint location, GLsizei count, const GLfloat *value) { (void)location; (void)count; (void)value; call(149); gl_null.uniforms += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glUniform4fv (GLint location, GLsizei count, const GLfloat *value) { (void)location; (void)count; (void)value; call(150); gl_null.uniforms += 1; }
+void (APIENTRYFP glUniform4fv) (GLint location, GLsizei count, const GLfloat *value) = null_glUniform4fv;
+#else
+void APIENTRY glUniform4fv (GLint location, GLsizei count, const GLfloat *value) { (void)location; (void)count; (void)value; call(150); gl_null.uniforms += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glUniform1iv (GLint location, GLsizei count, const GLint *value) { (void)location; (void)count; (void)value; call(151); gl_null.uniforms += 1; }
+void (APIENTRYFP glUniform1iv) (GLint location, GLsizei count, const GLint *value) = null_glUniform1iv;
+#else
+void APIENTRY glUniform1iv (GLint location, GLsizei count, const GLint *value) { (void)location; (void)count; (void)value; call(151); gl_null.uniforms += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glUniform2iv (GLint location, GLsizei count, const GLint *value) { (void)location; (void)count; (void)value; call(152); gl_null.uniforms += 1; }
+void (APIENTRYFP glUniform2iv) (GLint location, GLsizei count, const GLint *value) = null_glUniform2iv;
+#else
+void APIENTRY glUniform2iv (GLint location, GLsizei count, const GLint *value) { (void)location; (void)count; (void)value; call(152); gl_null.uniforms += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glUniform3iv (GLint location, GLsizei count, const GLint *value) { (void)location; (void)count; (void)value; call(153); gl_null.uniforms += 1; }
+void (APIENTRYFP glUniform3iv) (GLint location, GLsizei count, const GLint *value) = null_glUniform3iv;
+#else
+void APIENTRY glUniform3iv (GLint location, GLsizei count, const GLint *value) { (void)location; (void)count; (void)value; call(153); gl_null.uniforms += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glUniform4iv (GLint location, GLsizei count, const GLint *value) { (void)location; (void)count; (void)value; call(154); gl_null.uniforms += 1; }
+void (APIENTRYFP glUniform4iv) (GLint location, GLsizei count, const GLint *value) = null_glUniform4iv;
+#else
+void APIENTRY glUniform4iv (GLint location, GLsizei count, const GLint *value) { (void)location; (void)count; (void)value; call(154); gl_null.uniforms += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glUniformMatrix2fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { (void)location; (void)count; (void)transpose; (void)value; call(155); gl_null.uniforms += 1; }
+void (APIENTRYFP glUniformMatrix2fv) (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) = null_glUniformMatrix2fv;
+#else
+void APIENTRY glUniformMatrix2fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { (void)location; (void)count; (void)transpose; (void)value; call(155); gl_null.uniforms += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glUniformMatrix3fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { (void)location; (void)count; (void)transpose; (void)value; call(156); gl_null.uniforms += 1; }
+void (APIENTRYFP glUniformMatrix3fv) (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) = null_glUniformMatrix3fv;
+#else
+void APIENTRY glUniformMatrix3fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { (void)location; (void)count; (void)transpose; (void)value; call(156); gl_null.uniforms += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glUniformMatrix4fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { (void)location; (void)count; (void)transpose; (void)value; call(157); gl_null.uniforms += 1; }
+void (APIENTRYFP glUniformMatrix4fv) (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) = null_glUniformMatrix4fv;
+#else
+void APIENTRY glUniformMatrix4fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { (void)location; (void)count; (void)transpose; (void)value; call(157); gl_null.uniforms += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glValidateProgram (GLuint program) { (void)program; call(158); }
+void (APIENTRYFP glValidateProgram) (GLuint program) = null_glValidateProgram;
+#else
+void APIENTRY glValidateProgram (GLuint program) { (void)program; call(158); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttrib1d (GLuint index, GLdouble x) { (void)index; (void)x; call(159); }
+void (APIENTRYFP glVertexAttrib1d) (GLuint index, GLdouble x) = null_glVertexAttrib1d;
+#else
+void APIENTRY glVertexAttrib1d (GLuint index, GLdouble x) { (void)index; (void)x; call(159); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttrib1dv (GLuint index, const GLdouble *v) { (void)index; (void)v; call(160); }
+void (APIENTRYFP glVertexAttrib1dv) (GLuint index, const GLdouble *v) = null_glVertexAttrib1dv;
+#else
+void APIENTRY glVertexAttrib1dv (GLuint index, const GLdouble *v) { (void)index; (void)v; call(160); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttrib1f (GLuint index, GLfloat x) { (void)index; (void)x; call(161); }
+void (APIENTRYFP glVertexAttrib1f) (GLuint index, GLfloat x) = null_glVertexAttrib1f;
+#else
+void APIENTRY glVertexAttrib1f (GLuint index, GLfloat x) { (void)index; (void)x; call(161); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttrib1fv (GLuint index, const GLfloat *v) { (void)index; (void)v; call(162); }
+void (APIENTRYFP glVertexAttrib1fv) (GLuint index, const GLfloat *v) = null_glVertexAttrib1fv;
+#else
+void APIENTRY glVertexAttrib1fv (GLuint index, const GLfloat *v) { (void)index; (void)v; call(162); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttrib1s (GLuint index, GLshort x) { (void)index; (void)x; call(163); }
+void (APIENTRYFP glVertexAttrib1s) (GLuint index, GLshort x) = null_glVertexAttrib1s;
+#else
+void APIENTRY glVertexAttrib1s (GLuint index, GLshort x) { (void)index; (void)x; call(163); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttrib1sv (GLuint index, const GLshort *v) { (void)index; (void)v; call(164); }
+void (APIENTRYFP glVertexAttrib1sv) (GLuint index, const GLshort *v) = null_glVertexAttrib1sv;
+#else
+void APIENTRY glVertexAttrib1sv (GLuint index, const GLshort *v) { (void)index; (void)v; call(164); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttrib2d (GLuint index, GLdouble x, GLdouble y) { (void)index; (void)x; (void)y; call(165); }
+void (APIENTRYFP glVertexAttrib2d) (GLuint index, GLdouble x, GLdouble y) = null_glVertexAttrib2d;
+#else
+void APIENTRY glVertexAttrib2d (GLuint index, GLdouble x, GLdouble y) { (void)index; (void)x; (void)y; call(165); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttrib2dv (GLuint index, const GLdouble *v) { (void)index; (void)v; call(166); }
+void (APIENTRYFP glVertexAttrib2dv) (GLuint index, const GLdouble *v) = null_glVertexAttrib2dv;
+#else
+void APIENTRY glVertexAttrib2dv (GLuint index, const GLdouble *v) { (void)index; (void)v; call(166); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttrib2f (GLuint index, GLfloat x, GLfloat y) { (void)index; (void)x; (void)y; call(167); }
+void (APIENTRYFP glVertexAttrib2f) (GLuint index, GLfloat x, GLfloat y) = null_glVertexAttrib2f;
+#else
+void APIENTRY glVertexAttrib2f (GLuint index, GLfloat x, GLfloat y) { (void)index; (void)x; (void)y; call(167); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttrib2fv (GLuint index, const GLfloat *v) { (void)index; (void)v; call(168); }
+void (APIENTRYFP glVertexAttrib2fv) (GLuint index, const GLfloat *v) = null_glVertexAttrib2fv;
+#else
+void APIENTRY glVertexAttrib2fv (GLuint index, const GLfloat *v) { (void)index; (void)v; call(168); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttrib2s (GLuint index, GLshort x, GLshort y) { (void)index; (void)x; (void)y; call(169); }
+void (APIENTRYFP glVertexAttrib2s) (GLuint index, GLshort x, GLshort y) = null_glVertexAttrib2s;
+#else
+void APIENTRY glVertexAttrib2s (GLuint index, GLshort x, GLshort y) { (void)index; (void)x; (void)y; call(169); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttrib2sv (GLuint index, const GLshort *v) { (void)index; (void)v; call(170); }
+void (APIENTRYFP glVertexAttrib2sv) (GLuint index, const GLshort *v) = null_glVertexAttrib2sv;
+#else
+void APIENTRY glVertexAttrib2sv (GLuint index, const GLshort *v) { (void)index; (void)v; call(170); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttrib3d (GLuint index, GLdouble x, GLdouble y, GLdouble z) { (void)index; (void)x; (void)y; (void)z; call(171); }
+void (APIENTRYFP glVertexAttrib3d) (GLuint index, GLdouble x, GLdouble y, GLdouble z) = null_glVertexAttrib3d;
+#else
+void APIENTRY glVertexAttrib3d (GLuint index, GLdouble x, GLdouble y, GLdouble z) { (void)index; (void)x; (void)y; (void)z; call(171); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttrib3dv (GLuint index, const GLdouble *v) { (void)index; (void)v; call(172); }
+void (APIENTRYFP glVertexAttrib3dv) (GLuint index, const GLdouble *v) = null_glVertexAttrib3dv;
+#else
+void APIENTRY glVertexAttrib3dv (GLuint index, const GLdouble *v) { (void)index; (void)v; call(172); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttrib3f (GLuint index, GLfloat x, GLfloat y, GLfloat z) { (void)index; (void)x; (void)y; (void)z; call(173); }
+void (APIENTRYFP glVertexAttrib3f) (GLuint index, GLfloat x, GLfloat y, GLfloat z) = null_glVertexAttrib3f;
+#else
+void APIENTRY glVertexAttrib3f (GLuint index, GLfloat x, GLfloat y, GLfloat z) { (void)index; (void)x; (void)y; (void)z; call(173); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttrib3fv (GLuint index, const GLfloat *v) { (void)index; (void)v; call(174); }
+void (APIENTRYFP glVertexAttrib3fv) (GLuint index, const GLfloat *v) = null_glVertexAttrib3fv;
+#else
+void APIENTRY glVertexAttrib3fv (GLuint index, const GLfloat *v) { (void)index; (void)v; call(174); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttrib3s (GLuint index, GLshort x, GLshort y, GLshort z) { (void)index; (void)x; (void)y; (void)z; call(175); }
+void (APIENTRYFP glVertexAttrib3s) (GLuint index, GLshort x, GLshort y, GLshort z) = null_glVertexAttrib3s;
+#else
+void APIENTRY glVertexAttrib3s (GLuint index, GLshort x, GLshort y, GLshort z) { (void)index; (void)x; (void)y; (void)z; call(175); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttrib3sv (GLuint index, const GLshort *v) { (void)index; (void)v; call(176); }
+void (APIENTRYFP glVertexAttrib3sv) (GLuint index, const GLshort *v) = null_glVertexAttrib3sv;
+#else
+void APIENTRY glVertexAttrib3sv (GLuint index, const GLshort *v) { (void)index; (void)v; call(176); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttrib4Nbv (GLuint index, const GLbyte *v) { (void)index; (void)v; call(177); }
+void (APIENTRYFP glVertexAttrib4Nbv) (GLuint index, const GLbyte *v) = null_glVertexAttrib4Nbv;
+#else
+void APIENTRY glVertexAttrib4Nbv (GLuint index, const GLbyte *v) { (void)index; (void)v; call(177); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttrib4Niv (GLuint index, const GLint *v) { (void)index; (void)v; call(178); }
+void (APIENTRYFP glVertexAttrib4Niv) (GLuint index, const GLint *v) = null_glVertexAttrib4Niv;
+#else
+void APIENTRY glVertexAttrib4Niv (GLuint index, const GLint *v) { (void)index; (void)v; call(178); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttrib4Nsv (GLuint index, const GLshort *v) { (void)index; (void)v; call(179); }
+void (APIENTRYFP glVertexAttrib4Nsv) (GLuint index, const GLshort *v) = null_glVertexAttrib4Nsv;
+#else
+void APIENTRY glVertexAttrib4Nsv (GLuint index, const GLshort *v) { (void)index; (void)v; call(179); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttrib4Nub (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) { (void)index; (void)x; (void)y; (void)z; (void)w; call(180); }
+void (APIENTRYFP glVertexAttrib4Nub) (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) = null_glVertexAttrib4Nub;
+#else
+void APIENTRY glVertexAttrib4Nub (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) { (void)index; (void)x; (void)y; (void)z; (void)w; call(180); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttrib4Nubv (GLuint index, const GLubyte *v) { (void)index; (void)v; call(181); }
+void (APIENTRYFP glVertexAttrib4Nubv) (GLuint index, const GLubyte *v) = null_glVertexAttrib4Nubv;
+#else
+void APIENTRY glVertexAttrib4Nubv (GLuint index, const GLubyte *v) { (void)index; (void)v; call(181); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttrib4Nuiv (GLuint index, const GLuint *v) { (void)index; (void)v; call(182); }
+void (APIENTRYFP glVertexAttrib4Nuiv) (GLuint index, const GLuint *v) = null_glVertexAttrib4Nuiv;
+#else
+void APIENTRY glVertexAttrib4Nuiv (GLuint index, const GLuint *v) { (void)index; (void)v; call(182); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttrib4Nusv (GLuint index, const GLushort *v) { (void)index; (void)v; call(183); }
+void (APIENTRYFP glVertexAttrib4Nusv) (GLuint index, const GLushort *v) = null_glVertexAttrib4Nusv;
+#else
+void APIENTRY glVertexAttrib4Nusv (GLuint index, const GLushort *v) { (void)index; (void)v; call(183); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttrib4bv (GLuint index, const GLbyte *v) { (void)index; (void)v; call(184); }
+void (APIENTRYFP glVertexAttrib4bv) (GLuint index, const GLbyte *v) = null_glVertexAttrib4bv;
+#else
+void APIENTRY glVertexAttrib4bv (GLuint index, const GLbyte *v) { (void)index; (void)v; call(184); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttrib4d (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) { (void)index; (void)x; (void)y; (void)z; (void)w; call(185); }
+void (APIENTRYFP glVertexAttrib4d) (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) = null_glVertexAttrib4d;
+#else
+void APIENTRY glVertexAttrib4d (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) { (void)index; (void)x; (void)y; (void)z; (void)w; call(185); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttrib4dv (GLuint index, const GLdouble *v) { (void)index; (void)v; call(186); }
+void (APIENTRYFP glVertexAttrib4dv) (GLuint index, const GLdouble *v) = null_glVertexAttrib4dv;
+#else
+void APIENTRY glVertexAttrib4dv (GLuint index, const GLdouble *v) { (void)index; (void)v; call(186); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttrib4f (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) { (void)index; (void)x; (void)y; (void)z; (void)w; call(187); }
+void (APIENTRYFP glVertexAttrib4f) (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) = null_glVertexAttrib4f;
+#else
+void APIENTRY glVertexAttrib4f (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) { (void)index; (void)x; (void)y; (void)z; (void)w; call(187); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttrib4fv (GLuint index, const GLfloat *v) { (void)index; (void)v; call(188); }
+void (APIENTRYFP glVertexAttrib4fv) (GLuint index, const GLfloat *v) = null_glVertexAttrib4fv;
+#else
+void APIENTRY glVertexAttrib4fv (GLuint index, const GLfloat *v) { (void)index; (void)v; call(188); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttrib4iv (GLuint index, const GLint *v) { (void)index; (void)v; call(189); }
+void (APIENTRYFP glVertexAttrib4iv) (GLuint index, const GLint *v) = null_glVertexAttrib4iv;
+#else
+void APIENTRY glVertexAttrib4iv (GLuint index, const GLint *v) { (void)index; (void)v; call(189); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttrib4s (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) { (void)index; (void)x; (void)y; (void)z; (void)w; call(190); }
+void (APIENTRYFP glVertexAttrib4s) (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) = null_glVertexAttrib4s;
+#else
+void APIENTRY glVertexAttrib4s (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) { (void)index; (void)x; (void)y; (void)z; (void)w; call(190); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttrib4sv (GLuint index, const GLshort *v) { (void)index; (void)v; call(191); }
+void (APIENTRYFP glVertexAttrib4sv) (GLuint index, const GLshort *v) = null_glVertexAttrib4sv;
+#else
+void APIENTRY glVertexAttrib4sv (GLuint index, const GLshort *v) { (void)index; (void)v; call(191); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttrib4ubv (GLuint index, const GLubyte *v) { (void)index; (void)v; call(192); }
+void (APIENTRYFP glVertexAttrib4ubv) (GLuint index, const GLubyte *v) = null_glVertexAttrib4ubv;
+#else
+void APIENTRY glVertexAttrib4ubv (GLuint index, const GLubyte *v) { (void)index; (void)v; call(192); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttrib4uiv (GLuint index, const GLuint *v) { (void)index; (void)v; call(193); }
+void (APIENTRYFP glVertexAttrib4uiv) (GLuint index, const GLuint *v) = null_glVertexAttrib4uiv;
+#else
+void APIENTRY glVertexAttrib4uiv (GLuint index, const GLuint *v) { (void)index; (void)v; call(193); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttrib4usv (GLuint index, const GLushort *v) { (void)index; (void)v; call(194); }
+void (APIENTRYFP glVertexAttrib4usv) (GLuint index, const GLushort *v) = null_glVertexAttrib4usv;
+#else
+void APIENTRY glVertexAttrib4usv (GLuint index, const GLushort *v) { (void)index; (void)v; call(194); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttribPointer (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) { (void)index; (void)size; (void)type; (void)normalized; (void)stride; (void)pointer; call(195); }
+void (APIENTRYFP glVertexAttribPointer) (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) = null_glVertexAttribPointer;
+#else
+void APIENTRY glVertexAttribPointer (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) { (void)index; (void)size; (void)type; (void)normalized; (void)stride; (void)pointer; call(195); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glUniformMatrix2x3fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { (void)location; (void)count; (void)transpose; (void)value; call(196); gl_null.uniforms += 1; }
+void (APIENTRYFP glUniformMatrix2x3fv) (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) = null_glUniformMatrix2x3fv;
+#else
+void APIENTRY glUniformMatrix2x3fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { (void)location; (void)count; (void)transpose; (void)value; call(196); gl_null.uniforms += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glUniformMatrix3x2fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { (void)location; (void)count; (void)transpose; (void)value; call(197); gl_null.uniforms += 1; }
+void (APIENTRYFP glUniformMatrix3x2fv) (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) = null_glUniformMatrix3x2fv;
+#else
+void APIENTRY glUniformMatrix3x2fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { (void)location; (void)count; (void)transpose; (void)value; call(197); gl_null.uniforms += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glUniformMatrix2x4fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { (void)location; (void)count; (void)transpose; (void)value; call(198); gl_null.uniforms += 1; }
+void (APIENTRYFP glUniformMatrix2x4fv) (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) = null_glUniformMatrix2x4fv;
+#else
+void APIENTRY glUniformMatrix2x4fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { (void)location; (void)count; (void)transpose; (void)value; call(198); gl_null.uniforms += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glUniformMatrix4x2fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { (void)location; (void)count; (void)transpose; (void)value; call(199); gl_null.uniforms += 1; }
+void (APIENTRYFP glUniformMatrix4x2fv) (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) = null_glUniformMatrix4x2fv;
+#else
+void APIENTRY glUniformMatrix4x2fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { (void)location; (void)count; (void)transpose; (void)value; call(199); gl_null.uniforms += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glUniformMatrix3x4fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { (void)location; (void)count; (void)transpose; (void)value; call(200); gl_null.uniforms += 1; }
+void (APIENTRYFP glUniformMatrix3x4fv) (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) = null_glUniformMatrix3x4fv;
+#else
+void APIENTRY glUniformMatrix3x4fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { (void)location; (void)count; (void)transpose; (void)value; call(200); gl_null.uniforms += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glUniformMatrix4x3fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { (void)location; (void)count; (void)transpose; (void)value; call(201); gl_null.uniforms += 1; }
+void (APIENTRYFP glUniformMatrix4x3fv) (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) = null_glUniformMatrix4x3fv;
+#else
+void APIENTRY glUniformMatrix4x3fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { (void)location; (void)count; (void)transpose; (void)value; call(201); gl_null.uniforms += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glColorMaski (GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) { (void)index; (void)r; (void)g; (void)b; (void)a; call(202); }
+void (APIENTRYFP glColorMaski) (GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) = null_glColorMaski;
+#else
+void APIENTRY glColorMaski (GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) { (void)index; (void)r; (void)g; (void)b; (void)a; call(202); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetBooleani_v (GLenum target, GLuint index, GLboolean *data) { (void)target; (void)index; (void)data; call(203); }
+void (APIENTRYFP glGetBooleani_v) (GLenum target, GLuint index, GLboolean *data) = null_glGetBooleani_v;
+#else
+void APIENTRY glGetBooleani_v (GLenum target, GLuint index, GLboolean *data) { (void)target; (void)index; (void)data; call(203); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetIntegeri_v (GLenum target, GLuint index, GLint *data) { (void)target; (void)index; (void)data; call(204); }
+void (APIENTRYFP glGetIntegeri_v) (GLenum target, GLuint index, GLint *data) = null_glGetIntegeri_v;
+#else
+void APIENTRY glGetIntegeri_v (GLenum target, GLuint index, GLint *data) { (void)target; (void)index; (void)data; call(204); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glEnablei (GLenum target, GLuint index) { (void)target; (void)index; call(205); }
+void (APIENTRYFP glEnablei) (GLenum target, GLuint index) = null_glEnablei;
+#else
+void APIENTRY glEnablei (GLenum target, GLuint index) { (void)target; (void)index; call(205); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glDisablei (GLenum target, GLuint index) { (void)target; (void)index; call(206); }
+void (APIENTRYFP glDisablei) (GLenum target, GLuint index) = null_glDisablei;
+#else
+void APIENTRY glDisablei (GLenum target, GLuint index) { (void)target; (void)index; call(206); }
+#endif
+#ifdef _WIN32
+static GLboolean APIENTRY null_glIsEnabledi (GLenum target, GLuint index) { (void)target; (void)index; call(207); return GLboolean(0); }
+GLboolean (APIENTRYFP glIsEnabledi) (GLenum target, GLuint index) = null_glIsEnabledi;
+#else
+GLboolean APIENTRY glIsEnabledi (GLenum target, GLuint index) { (void)target; (void)index; call(207); return GLboolean(0); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glBeginTransformFeedback (GLenum primitiveMode) { (void)primitiveMode; call(208); }
+void (APIENTRYFP glBeginTransformFeedback) (GLenum primitiveMode) = null_glBeginTransformFeedback;
+#else
+void APIENTRY glBeginTransformFeedback (GLenum primitiveMode) { (void)primitiveMode; call(208); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glEndTransformFeedback (void) { call(209); }
+void (APIENTRYFP glEndTransformFeedback) (void) = null_glEndTransformFeedback;
+#else
+void APIENTRY glEndTransformFeedback (void) { call(209); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glBindBufferRange (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) { (void)target; (void)index; (void)buffer; (void)offset; (void)size; call(210); gl_null.binds += 1; }
+void (APIENTRYFP glBindBufferRange) (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) = null_glBindBufferRange;
+#else
+void APIENTRY glBindBufferRange (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) { (void)target; (void)index; (void)buffer; (void)offset; (void)size; call(210); gl_null.binds += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glBindBufferBase (GLenum target, GLuint index, GLuint buffer) { (void)target; (void)index; (void)buffer; call(211); gl_null.binds += 1; }
+void (APIENTRYFP glBindBufferBase) (GLenum target, GLuint index, GLuint buffer) = null_glBindBufferBase;
+#else
+void APIENTRY glBindBufferBase (GLenum target, GLuint index, GLuint buffer) { (void)target; (void)index; (void)buffer; call(211); gl_null.binds += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glTransformFeedbackVaryings (GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) { (void)program; (void)count; (void)varyings; (void)bufferMode; call(212); }
+void (APIENTRYFP glTransformFeedbackVaryings) (GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) = null_glTransformFeedbackVaryings;
+#else
+void APIENTRY glTransformFeedbackVaryings (GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) { (void)program; (void)count; (void)varyings; (void)bufferMode; call(212); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetTransformFeedbackVarying (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) { (void)program; (void)index; (void)bufSize; (void)length; (void)size; (void)type; (void)name; call(213); }
+void (APIENTRYFP glGetTransformFeedbackVarying) (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) = null_glGetTransformFeedbackVarying;
+#else
+void APIENTRY glGetTransformFeedbackVarying (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) { (void)program; (void)index; (void)bufSize; (void)length; (void)size; (void)type; (void)name; call(213); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glClampColor (GLenum target, GLenum clamp) { (void)target; (void)clamp; call(214); }
+void (APIENTRYFP glClampColor) (GLenum target, GLenum clamp) = null_glClampColor;
+#else
+void APIENTRY glClampColor (GLenum target, GLenum clamp) { (void)target; (void)clamp; call(214); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glBeginConditionalRender (GLuint id, GLenum mode) { (void)id; (void)mode; call(215); }
+void (APIENTRYFP glBeginConditionalRender) (GLuint id, GLenum mode) = null_glBeginConditionalRender;
+#else
+void APIENTRY glBeginConditionalRender (GLuint id, GLenum mode) { (void)id; (void)mode; call(215); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glEndConditionalRender (void) { call(216); }
+void (APIENTRYFP glEndConditionalRender) (void) = null_glEndConditionalRender;
+#else
+void APIENTRY glEndConditionalRender (void) { call(216); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttribIPointer (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) { (void)index; (void)size; (void)type; (void)stride; (void)pointer; call(217); }
+void (APIENTRYFP glVertexAttribIPointer) (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) = null_glVertexAttribIPointer;
+#else
+void APIENTRY glVertexAttribIPointer (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) { (void)index; (void)size; (void)type; (void)stride; (void)pointer; call(217); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetVertexAttribIiv (GLuint index, GLenum pname, GLint *params) { (void)index; (void)pname; (void)params; call(218); }
+void (APIENTRYFP glGetVertexAttribIiv) (GLuint index, GLenum pname, GLint *params) = null_glGetVertexAttribIiv;
+#else
+void APIENTRY glGetVertexAttribIiv (GLuint index, GLenum pname, GLint *params) { (void)index; (void)pname; (void)params; call(218); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetVertexAttribIuiv (GLuint index, GLenum pname, GLuint *params) { (void)index; (void)pname; (void)params; call(219); }
+void (APIENTRYFP glGetVertexAttribIuiv) (GLuint index, GLenum pname, GLuint *params) = null_glGetVertexAttribIuiv;
+#else
+void APIENTRY glGetVertexAttribIuiv (GLuint index, GLenum pname, GLuint *params) { (void)index; (void)pname; (void)params; call(219); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttribI1i (GLuint index, GLint x) { (void)index; (void)x; call(220); }
+void (APIENTRYFP glVertexAttribI1i) (GLuint index, GLint x) = null_glVertexAttribI1i;
+#else
+void APIENTRY glVertexAttribI1i (GLuint index, GLint x) { (void)index; (void)x; call(220); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttribI2i (GLuint index, GLint x, GLint y) { (void)index; (void)x; (void)y; call(221); }
+void (APIENTRYFP glVertexAttribI2i) (GLuint index, GLint x, GLint y) = null_glVertexAttribI2i;
+#else
+void APIENTRY glVertexAttribI2i (GLuint index, GLint x, GLint y) { (void)index; (void)x; (void)y; call(221); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttribI3i (GLuint index, GLint x, GLint y, GLint z) { (void)index; (void)x; (void)y; (void)z; call(222); }
+void (APIENTRYFP glVertexAttribI3i) (GLuint index, GLint x, GLint y, GLint z) = null_glVertexAttribI3i;
+#else
+void APIENTRY glVertexAttribI3i (GLuint index, GLint x, GLint y, GLint z) { (void)index; (void)x; (void)y; (void)z; call(222); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttribI4i (GLuint index, GLint x, GLint y, GLint z, GLint w) { (void)index; (void)x; (void)y; (void)z; (void)w; call(223); }
+void (APIENTRYFP glVertexAttribI4i) (GLuint index, GLint x, GLint y, GLint z, GLint w) = null_glVertexAttribI4i;
+#else
+void APIENTRY glVertexAttribI4i (GLuint index, GLint x, GLint y, GLint z, GLint w) { (void)index; (void)x; (void)y; (void)z; (void)w; call(223); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttribI1ui (GLuint index, GLuint x) { (void)index; (void)x; call(224); }
+void (APIENTRYFP glVertexAttribI1ui) (GLuint index, GLuint x) = null_glVertexAttribI1ui;
+#else
+void APIENTRY glVertexAttribI1ui (GLuint index, GLuint x) { (void)index; (void)x; call(224); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttribI2ui (GLuint index, GLuint x, GLuint y) { (void)index; (void)x; (void)y; call(225); }
+void (APIENTRYFP glVertexAttribI2ui) (GLuint index, GLuint x, GLuint y) = null_glVertexAttribI2ui;
+#else
+void APIENTRY glVertexAttribI2ui (GLuint index, GLuint x, GLuint y) { (void)index; (void)x; (void)y; call(225); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttribI3ui (GLuint index, GLuint x, GLuint y, GLuint z) { (void)index; (void)x; (void)y; (void)z; call(226); }
+void (APIENTRYFP glVertexAttribI3ui) (GLuint index, GLuint x, GLuint y, GLuint z) = null_glVertexAttribI3ui;
+#else
+void APIENTRY glVertexAttribI3ui (GLuint index, GLuint x, GLuint y, GLuint z) { (void)index; (void)x; (void)y; (void)z; call(226); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttribI4ui (GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) { (void)index; (void)x; (void)y; (void)z; (void)w; call(227); }
+void (APIENTRYFP glVertexAttribI4ui) (GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) = null_glVertexAttribI4ui;
+#else
+void APIENTRY glVertexAttribI4ui (GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) { (void)index; (void)x; (void)y; (void)z; (void)w; call(227); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttribI1iv (GLuint index, const GLint *v) { (void)index; (void)v; call(228); }
+void (APIENTRYFP glVertexAttribI1iv) (GLuint index, const GLint *v) = null_glVertexAttribI1iv;
+#else
+void APIENTRY glVertexAttribI1iv (GLuint index, const GLint *v) { (void)index; (void)v; call(228); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttribI2iv (GLuint index, const GLint *v) { (void)index; (void)v; call(229); }
+void (APIENTRYFP glVertexAttribI2iv) (GLuint index, const GLint *v) = null_glVertexAttribI2iv;
+#else
+void APIENTRY glVertexAttribI2iv (GLuint index, const GLint *v) { (void)index; (void)v; call(229); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttribI3iv (GLuint index, const GLint *v) { (void)index; (void)v; call(230); }
+void (APIENTRYFP glVertexAttribI3iv) (GLuint index, const GLint *v) = null_glVertexAttribI3iv;
+#else
+void APIENTRY glVertexAttribI3iv (GLuint index, const GLint *v) { (void)index; (void)v; call(230); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttribI4iv (GLuint index, const GLint *v) { (void)index; (void)v; call(231); }
+void (APIENTRYFP glVertexAttribI4iv) (GLuint index, const GLint *v) = null_glVertexAttribI4iv;
+#else
+void APIENTRY glVertexAttribI4iv (GLuint index, const GLint *v) { (void)index; (void)v; call(231); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttribI1uiv (GLuint index, const GLuint *v) { (void)index; (void)v; call(232); }
+void (APIENTRYFP glVertexAttribI1uiv) (GLuint index, const GLuint *v) = null_glVertexAttribI1uiv;
+#else
+void APIENTRY glVertexAttribI1uiv (GLuint index, const GLuint *v) { (void)index; (void)v; call(232); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttribI2uiv (GLuint index, const GLuint *v) { (void)index; (void)v; call(233); }
+void (APIENTRYFP glVertexAttribI2uiv) (GLuint index, const GLuint *v) = null_glVertexAttribI2uiv;
+#else
+void APIENTRY glVertexAttribI2uiv (GLuint index, const GLuint *v) { (void)index; (void)v; call(233); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttribI3uiv (GLuint index, const GLuint *v) { (void)index; (void)v; call(234); }
+void (APIENTRYFP glVertexAttribI3uiv) (GLuint index, const GLuint *v) = null_glVertexAttribI3uiv;
+#else
+void APIENTRY glVertexAttribI3uiv (GLuint index, const GLuint *v) { (void)index; (void)v; call(234); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttribI4uiv (GLuint index, const GLuint *v) { (void)index; (void)v; call(235); }
+void (APIENTRYFP glVertexAttribI4uiv) (GLuint index, const GLuint *v) = null_glVertexAttribI4uiv;
+#else
+void APIENTRY glVertexAttribI4uiv (GLuint index, const GLuint *v) { (void)index; (void)v; call(235); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttribI4bv (GLuint index, const GLbyte *v) { (void)index; (void)v; call(236); }
+void (APIENTRYFP glVertexAttribI4bv) (GLuint index, const GLbyte *v) = null_glVertexAttribI4bv;
+#else
+void APIENTRY glVertexAttribI4bv (GLuint index, const GLbyte *v) { (void)index; (void)v; call(236); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttribI4sv (GLuint index, const GLshort *v) { (void)index; (void)v; call(237); }
+void (APIENTRYFP glVertexAttribI4sv) (GLuint index, const GLshort *v) = null_glVertexAttribI4sv;
+#else
+void APIENTRY glVertexAttribI4sv (GLuint index, const GLshort *v) { (void)index; (void)v; call(237); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttribI4ubv (GLuint index, const GLubyte *v) { (void)index; (void)v; call(238); }
+void (APIENTRYFP glVertexAttribI4ubv) (GLuint index, const GLubyte *v) = null_glVertexAttribI4ubv;
+#else
+void APIENTRY glVertexAttribI4ubv (GLuint index, const GLubyte *v) { (void)index; (void)v; call(238); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttribI4usv (GLuint index, const GLushort *v) { (void)index; (void)v; call(239); }
+void (APIENTRYFP glVertexAttribI4usv) (GLuint index, const GLushort *v) = null_glVertexAttribI4usv;
+#else
+void APIENTRY glVertexAttribI4usv (GLuint index, const GLushort *v) { (void)index; (void)v; call(239); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetUniformuiv (GLuint program, GLint location, GLuint *params) { (void)program; (void)location; (void)params; call(240); }
+void (APIENTRYFP glGetUniformuiv) (GLuint program, GLint location, GLuint *params) = null_glGetUniformuiv;
+#else
+void APIENTRY glGetUniformuiv (GLuint program, GLint location, GLuint *params) { (void)program; (void)location; (void)params; call(240); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glBindFragDataLocation (GLuint program, GLuint color, const GLchar *name) { (void)program; (void)color; (void)name; call(241); gl_null.binds += 1; }
+void (APIENTRYFP glBindFragDataLocation) (GLuint program, GLuint color, const GLchar *name) = null_glBindFragDataLocation;
+#else
+void APIENTRY glBindFragDataLocation (GLuint program, GLuint color, const GLchar *name) { (void)program; (void)color; (void)name; call(241); gl_null.binds += 1; }
+#endif
+#ifdef _WIN32
+static GLint APIENTRY null_glGetFragDataLocation (GLuint program, const GLchar *name) { (void)program; (void)name; call(242); return 0; }
+GLint (APIENTRYFP glGetFragDataLocation) (GLuint program, const GLchar *name) = null_glGetFragDataLocation;
+#else
+GLint APIENTRY glGetFragDataLocation (GLuint program, const GLchar *name) { (void)program; (void)name; call(242); return 0; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glUniform1ui (GLint location, GLuint v0) { (void)location; (void)v0; call(243); gl_null.uniforms += 1; }
+void (APIENTRYFP glUniform1ui) (GLint location, GLuint v0) = null_glUniform1ui;
+#else
+void APIENTRY glUniform1ui (GLint location, GLuint v0) { (void)location; (void)v0; call(243); gl_null.uniforms += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glUniform2ui (GLint location, GLuint v0, GLuint v1) { (void)location; (void)v0; (void)v1; call(244); gl_null.uniforms += 1; }
+void (APIENTRYFP glUniform2ui) (GLint location, GLuint v0, GLuint v1) = null_glUniform2ui;
+#else
+void APIENTRY glUniform2ui (GLint location, GLuint v0, GLuint v1) { (void)location; (void)v0; (void)v1; call(244); gl_null.uniforms += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glUniform3ui (GLint location, GLuint v0, GLuint v1, GLuint v2) { (void)location; (void)v0; (void)v1; (void)v2; call(245); gl_null.uniforms += 1; }
+void (APIENTRYFP glUniform3ui) (GLint location, GLuint v0, GLuint v1, GLuint v2) = null_glUniform3ui;
+#else
+void APIENTRY glUniform3ui (GLint location, GLuint v0, GLuint v1, GLuint v2) { (void)location; (void)v0; (void)v1; (void)v2; call(245); gl_null.uniforms += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glUniform4ui (GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) { (void)location; (void)v0; (void)v1; (void)v2; (void)v3; call(246); gl_null.uniforms += 1; }
+void (APIENTRYFP glUniform4ui) (GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) = null_glUniform4ui;
+#else
+void APIENTRY glUniform4ui (GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) { (void)location; (void)v0; (void)v1; (void)v2; (void)v3; call(246); gl_null.uniforms += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glUniform1uiv (GLint location, GLsizei count, const GLuint *value) { (void)location; (void)count; (void)value; call(247); gl_null.uniforms += 1; }
+void (APIENTRYFP glUniform1uiv) (GLint location, GLsizei count, const GLuint *value) = null_glUniform1uiv;
+#else
+void APIENTRY glUniform1uiv (GLint location, GLsizei count, const GLuint *value) { (void)location; (void)count; (void)value; call(247); gl_null.uniforms += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glUniform2uiv (GLint location, GLsizei count, const GLuint *value) { (void)location; (void)count; (void)value; call(248); gl_null.uniforms += 1; }
+void (APIENTRYFP glUniform2uiv) (GLint location, GLsizei count, const GLuint *value) = null_glUniform2uiv;
+#else
+void APIENTRY glUniform2uiv (GLint location, GLsizei count, const GLuint *value) { (void)location; (void)count; (void)value; call(248); gl_null.uniforms += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glUniform3uiv (GLint location, GLsizei count, const GLuint *value) { (void)location; (void)count; (void)value; call(249); gl_null.uniforms += 1; }
+void (APIENTRYFP glUniform3uiv) (GLint location, GLsizei count, const GLuint *value) = null_glUniform3uiv;
+#else
+void APIENTRY glUniform3uiv (GLint location, GLsizei count, const GLuint *value) { (void)location; (void)count; (void)value; call(249); gl_null.uniforms += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glUniform4uiv (GLint location, GLsizei count, const GLuint *value) { (void)location; (void)count; (void)value; call(250); gl_null.uniforms += 1; }
+void (APIENTRYFP glUniform4uiv) (GLint location, GLsizei count, const GLuint *value) = null_glUniform4uiv;
+#else
+void APIENTRY glUniform4uiv (GLint location, GLsizei count, const GLuint *value) { (void)location; (void)count; (void)value; call(250); gl_null.uniforms += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glTexParameterIiv (GLenum target, GLenum pname, const GLint *params) { (void)target; (void)pname; (void)params; call(251); }
+void (APIENTRYFP glTexParameterIiv) (GLenum target, GLenum pname, const GLint *params) = null_glTexParameterIiv;
+#else
+void APIENTRY glTexParameterIiv (GLenum target, GLenum pname, const GLint *params) { (void)target; (void)pname; (void)params; call(251); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glTexParameterIuiv (GLenum target, GLenum pname, const GLuint *params) { (void)target; (void)pname; (void)params; call(252); }
+void (APIENTRYFP glTexParameterIuiv) (GLenum target, GLenum pname, const GLuint *params) = null_glTexParameterIuiv;
+#else
+void APIENTRY glTexParameterIuiv (GLenum target, GLenum pname, const GLuint *params) { (void)target; (void)pname; (void)params; call(252); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetTexParameterIiv (GLenum target, GLenum pname, GLint *params) { (void)target; (void)pname; (void)params; call(253); }
+void (APIENTRYFP glGetTexParameterIiv) (GLenum target, GLenum pname, GLint *params) = null_glGetTexParameterIiv;
+#else
+void APIENTRY glGetTexParameterIiv (GLenum target, GLenum pname, GLint *params) { (void)target; (void)pname; (void)params; call(253); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetTexParameterIuiv (GLenum target, GLenum pname, GLuint *params) { (void)target; (void)pname; (void)params; call(254); }
+void (APIENTRYFP glGetTexParameterIuiv) (GLenum target, GLenum pname, GLuint *params) = null_glGetTexParameterIuiv;
+#else
+void APIENTRY glGetTexParameterIuiv (GLenum target, GLenum pname, GLuint *params) { (void)target; (void)pname; (void)params; call(254); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glClearBufferiv (GLenum buffer, GLint drawbuffer, const GLint *value) { (void)buffer; (void)drawbuffer; (void)value; call(255); }
+void (APIENTRYFP glClearBufferiv) (GLenum buffer, GLint drawbuffer, const GLint *value) = null_glClearBufferiv;
+#else
+void APIENTRY glClearBufferiv (GLenum buffer, GLint drawbuffer, const GLint *value) { (void)buffer; (void)drawbuffer; (void)value; call(255); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glClearBufferuiv (GLenum buffer, GLint drawbuffer, const GLuint *value) { (void)buffer; (void)drawbuffer; (void)value; call(256); }
+void (APIENTRYFP glClearBufferuiv) (GLenum buffer, GLint drawbuffer, const GLuint *value) = null_glClearBufferuiv;
+#else
+void APIENTRY glClearBufferuiv (GLenum buffer, GLint drawbuffer, const GLuint *value) { (void)buffer; (void)drawbuffer; (void)value; call(256); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glClearBufferfv (GLenum buffer, GLint drawbuffer, const GLfloat *value) { (void)buffer; (void)drawbuffer; (void)value; call(257); }
+void (APIENTRYFP glClearBufferfv) (GLenum buffer, GLint drawbuffer, const GLfloat *value) = null_glClearBufferfv;
+#else
+void APIENTRY glClearBufferfv (GLenum buffer, GLint drawbuffer, const GLfloat *value) { (void)buffer; (void)drawbuffer; (void)value; call(257); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glClearBufferfi (GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) { (void)buffer; (void)drawbuffer; (void)depth; (void)stencil; call(258); }
+void (APIENTRYFP glClearBufferfi) (GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) = null_glClearBufferfi;
+#else
+void APIENTRY glClearBufferfi (GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) { (void)buffer; (void)drawbuffer; (void)depth; (void)stencil; call(258); }
+#endif
+#ifdef _WIN32
+static const GLubyte * APIENTRY null_glGetStringi (GLenum name, GLuint index) { (void)name; (void)index; call(259); static GLubyte const empty[] = ""; return empty; }
+const GLubyte * (APIENTRYFP glGetStringi) (GLenum name, GLuint index) = null_glGetStringi;
+#else
+const GLubyte * APIENTRY glGetStringi (GLenum name, GLuint index) { (void)name; (void)index; call(259); static GLubyte const empty[] = ""; return empty; }
+#endif
+#ifdef _WIN32
+static GLboolean APIENTRY null_glIsRenderbuffer (GLuint renderbuffer) { (void)renderbuffer; call(260); return GLboolean(0); }
+GLboolean (APIENTRYFP glIsRenderbuffer) (GLuint renderbuffer) = null_glIsRenderbuffer;
+#else
+GLboolean APIENTRY glIsRenderbuffer (GLuint renderbuffer) { (void)renderbuffer; call(260); return GLboolean(0); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glBindRenderbuffer (GLenum target, GLuint renderbuffer) { (void)target; (void)renderbuffer; call(261); gl_null.binds += 1; }
+void (APIENTRYFP glBindRenderbuffer) (GLenum target, GLuint renderbuffer) = null_glBindRenderbuffer;
+#else
+void APIENTRY glBindRenderbuffer (GLenum target, GLuint renderbuffer) { (void)target; (void)renderbuffer; call(261); gl_null.binds += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glDeleteRenderbuffers (GLsizei n, const GLuint *renderbuffers) { (void)n; (void)renderbuffers; call(262); }
+void (APIENTRYFP glDeleteRenderbuffers) (GLsizei n, const GLuint *renderbuffers) = null_glDeleteRenderbuffers;
+#else
+void APIENTRY glDeleteRenderbuffers (GLsizei n, const GLuint *renderbuffers) { (void)n; (void)renderbuffers; call(262); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGenRenderbuffers (GLsizei n, GLuint *renderbuffers) { call(263); for (GLsizei i = 0; i < n; ++i) renderbuffers[i] = ++next_name; }
+void (APIENTRYFP glGenRenderbuffers) (GLsizei n, GLuint *renderbuffers) = null_glGenRenderbuffers;
+#else
+void APIENTRY glGenRenderbuffers (GLsizei n, GLuint *renderbuffers) { call(263); for (GLsizei i = 0; i < n; ++i) renderbuffers[i] = ++next_name; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glRenderbufferStorage (GLenum target, GLenum internalformat, GLsizei width, GLsizei height) { (void)target; (void)internalformat; (void)width; (void)height; call(264); }
+void (APIENTRYFP glRenderbufferStorage) (GLenum target, GLenum internalformat, GLsizei width, GLsizei height) = null_glRenderbufferStorage;
+#else
+void APIENTRY glRenderbufferStorage (GLenum target, GLenum internalformat, GLsizei width, GLsizei height) { (void)target; (void)internalformat; (void)width; (void)height; call(264); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetRenderbufferParameteriv (GLenum target, GLenum pname, GLint *params) { (void)target; (void)pname; (void)params; call(265); }
+void (APIENTRYFP glGetRenderbufferParameteriv) (GLenum target, GLenum pname, GLint *params) = null_glGetRenderbufferParameteriv;
+#else
+void APIENTRY glGetRenderbufferParameteriv (GLenum target, GLenum pname, GLint *params) { (void)target; (void)pname; (void)params; call(265); }
+#endif
+#ifdef _WIN32
+static GLboolean APIENTRY null_glIsFramebuffer (GLuint framebuffer) { (void)framebuffer; call(266); return GLboolean(0); }
+GLboolean (APIENTRYFP glIsFramebuffer) (GLuint framebuffer) = null_glIsFramebuffer;
+#else
+GLboolean APIENTRY glIsFramebuffer (GLuint framebuffer) { (void)framebuffer; call(266); return GLboolean(0); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glBindFramebuffer (GLenum target, GLuint framebuffer) { (void)target; (void)framebuffer; call(267); gl_null.binds += 1; }
+void (APIENTRYFP glBindFramebuffer) (GLenum target, GLuint framebuffer) = null_glBindFramebuffer;
+#else
+void APIENTRY glBindFramebuffer (GLenum target, GLuint framebuffer) { (void)target; (void)framebuffer; call(267); gl_null.binds += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glDeleteFramebuffers (GLsizei n, const GLuint *framebuffers) { (void)n; (void)framebuffers; call(268); }
+void (APIENTRYFP glDeleteFramebuffers) (GLsizei n, const GLuint *framebuffers) = null_glDeleteFramebuffers;
+#else
+void APIENTRY glDeleteFramebuffers (GLsizei n, const GLuint *framebuffers) { (void)n; (void)framebuffers; call(268); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGenFramebuffers (GLsizei n, GLuint *framebuffers) { call(269); for (GLsizei i = 0; i < n; ++i) framebuffers[i] = ++next_name; }
+void (APIENTRYFP glGenFramebuffers) (GLsizei n, GLuint *framebuffers) = null_glGenFramebuffers;
+#else
+void APIENTRY glGenFramebuffers (GLsizei n, GLuint *framebuffers) { call(269); for (GLsizei i = 0; i < n; ++i) framebuffers[i] = ++next_name; }
+#endif
+#ifdef _WIN32
+static GLenum APIENTRY null_glCheckFramebufferStatus (GLenum target) { (void)target; call(270); return GL_FRAMEBUFFER_COMPLETE; }
+GLenum (APIENTRYFP glCheckFramebufferStatus) (GLenum target) = null_glCheckFramebufferStatus;
+#else
+GLenum APIENTRY glCheckFramebufferStatus (GLenum target) { (void)target; call(270); return GL_FRAMEBUFFER_COMPLETE; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glFramebufferTexture1D (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) { (void)target; (void)attachment; (void)textarget; (void)texture; (void)level; call(271); }
+void (APIENTRYFP glFramebufferTexture1D) (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) = null_glFramebufferTexture1D;
+#else
+void APIENTRY glFramebufferTexture1D (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) { (void)target; (void)attachment; (void)textarget; (void)texture; (void)level; call(271); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glFramebufferTexture2D (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) { (void)target; (void)attachment; (void)textarget; (void)texture; (void)level; call(272); }
+void (APIENTRYFP glFramebufferTexture2D) (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) = null_glFramebufferTexture2D;
+#else
+void APIENTRY glFramebufferTexture2D (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) { (void)target; (void)attachment; (void)textarget; (void)texture; (void)level; call(272); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glFramebufferTexture3D (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) { (void)target; (void)attachment; (void)textarget; (void)texture; (void)level; (void)zoffset; call(273); }
+void (APIENTRYFP glFramebufferTexture3D) (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) = null_glFramebufferTexture3D;
+#else
+void APIENTRY glFramebufferTexture3D (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) { (void)target; (void)attachment; (void)textarget; (void)texture; (void)level; (void)zoffset; call(273); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glFramebufferRenderbuffer (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) { (void)target; (void)attachment; (void)renderbuffertarget; (void)renderbuffer; call(274); }
+void (APIENTRYFP glFramebufferRenderbuffer) (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) = null_glFramebufferRenderbuffer;
+#else
+void APIENTRY glFramebufferRenderbuffer (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) { (void)target; (void)attachment; (void)renderbuffertarget; (void)renderbuffer; call(274); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetFramebufferAttachmentParameteriv (GLenum target, GLenum attachment, GLenum pname, GLint *params) { (void)target; (void)attachment; (void)pname; (void)params; call(275); }
+void (APIENTRYFP glGetFramebufferAttachmentParameteriv) (GLenum target, GLenum attachment, GLenum pname, GLint *params) = null_glGetFramebufferAttachmentParameteriv;
+#else
+void APIENTRY glGetFramebufferAttachmentParameteriv (GLenum target, GLenum attachment, GLenum pname, GLint *params) { (void)target; (void)attachment; (void)pname; (void)params; call(275); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGenerateMipmap (GLenum target) { (void)target; call(276); }
+void (APIENTRYFP glGenerateMipmap) (GLenum target) = null_glGenerateMipmap;
+#else
+void APIENTRY glGenerateMipmap (GLenum target) { (void)target; call(276); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glBlitFramebuffer (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) { (void)srcX0; (void)srcY0; (void)srcX1; (void)srcY1; (void)dstX0; (void)dstY0; (void)dstX1; (void)dstY1; (void)mask; (void)filter; call(277); }
+void (APIENTRYFP glBlitFramebuffer) (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) = null_glBlitFramebuffer;
+#else
+void APIENTRY glBlitFramebuffer (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) { (void)srcX0; (void)srcY0; (void)srcX1; (void)srcY1; (void)dstX0; (void)dstY0; (void)dstX1; (void)dstY1; (void)mask; (void)filter; call(277); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glRenderbufferStorageMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) { (void)target; (void)samples; (void)internalformat; (void)width; (void)height; call(278); }
+void (APIENTRYFP glRenderbufferStorageMultisample) (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) = null_glRenderbufferStorageMultisample;
+#else
+void APIENTRY glRenderbufferStorageMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) { (void)target; (void)samples; (void)internalformat; (void)width; (void)height; call(278); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glFramebufferTextureLayer (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) { (void)target; (void)attachment; (void)texture; (void)level; (void)layer; call(279); }
+void (APIENTRYFP glFramebufferTextureLayer) (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) = null_glFramebufferTextureLayer;
+#else
+void APIENTRY glFramebufferTextureLayer (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) { (void)target; (void)attachment; (void)texture; (void)level; (void)layer; call(279); }
+#endif
+#ifdef _WIN32
+static void * APIENTRY null_glMapBufferRange (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) { (void)target; (void)offset; (void)access; call(280); gl_null.uploaded_bytes += uint64_t(length); return scratch(size_t(length)); }
+void * (APIENTRYFP glMapBufferRange) (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) = null_glMapBufferRange;
+#else
+void * APIENTRY glMapBufferRange (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) { (void)target; (void)offset; (void)access; call(280); gl_null.uploaded_bytes += uint64_t(length); return scratch(size_t(length)); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glFlushMappedBufferRange (GLenum target, GLintptr offset, GLsizeiptr length) { (void)target; (void)offset; (void)length; call(281); }
+void (APIENTRYFP glFlushMappedBufferRange) (GLenum target, GLintptr offset, GLsizeiptr length) = null_glFlushMappedBufferRange;
+#else
+void APIENTRY glFlushMappedBufferRange (GLenum target, GLintptr offset, GLsizeiptr length) { (void)target; (void)offset; (void)length; call(281); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glBindVertexArray (GLuint array) { (void)array; call(282); gl_null.binds += 1; }
+void (APIENTRYFP glBindVertexArray) (GLuint array) = null_glBindVertexArray;
+#else
+void APIENTRY glBindVertexArray (GLuint array) { (void)array; call(282); gl_null.binds += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glDeleteVertexArrays (GLsizei n, const GLuint *arrays) { (void)n; (void)arrays; call(283); }
+void (APIENTRYFP glDeleteVertexArrays) (GLsizei n, const GLuint *arrays) = null_glDeleteVertexArrays;
+#else
+void APIENTRY glDeleteVertexArrays (GLsizei n, const GLuint *arrays) { (void)n; (void)arrays; call(283); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGenVertexArrays (GLsizei n, GLuint *arrays) { call(284); for (GLsizei i = 0; i < n; ++i) arrays[i] = ++next_name; }
+void (APIENTRYFP glGenVertexArrays) (GLsizei n, GLuint *arrays) = null_glGenVertexArrays;
+#else
+void APIENTRY glGenVertexArrays (GLsizei n, GLuint *arrays) { call(284); for (GLsizei i = 0; i < n; ++i) arrays[i] = ++next_name; }
+#endif
+#ifdef _WIN32
+static GLboolean APIENTRY null_glIsVertexArray (GLuint array) { (void)array; call(285); return GLboolean(0); }
+GLboolean (APIENTRYFP glIsVertexArray) (GLuint array) = null_glIsVertexArray;
+#else
+GLboolean APIENTRY glIsVertexArray (GLuint array) { (void)array; call(285); return GLboolean(0); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glDrawArraysInstanced (GLenum mode, GLint first, GLsizei count, GLsizei instancecount) { (void)mode; (void)first; call(286); gl_null.draws += 1; gl_null.vertices += uint64_t(count) * uint64_t(instancecount); }
+void (APIENTRYFP glDrawArraysInstanced) (GLenum mode, GLint first, GLsizei count, GLsizei instancecount) = null_glDrawArraysInstanced;
+#else
+void APIENTRY glDrawArraysInstanced (GLenum mode, GLint first, GLsizei count, GLsizei instancecount) { (void)mode; (void)first; call(286); gl_null.draws += 1; gl_null.vertices += uint64_t(count) * uint64_t(instancecount); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glDrawElementsInstanced (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) { (void)mode; (void)type; (void)indices; call(287); gl_null.draws += 1; gl_null.vertices += uint64_t(count) * uint64_t(instancecount); }
+void (APIENTRYFP glDrawElementsInstanced) (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) = null_glDrawElementsInstanced;
+#else
+void APIENTRY glDrawElementsInstanced (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) { (void)mode; (void)type; (void)indices; call(287); gl_null.draws += 1; gl_null.vertices += uint64_t(count) * uint64_t(instancecount); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glTexBuffer (GLenum target, GLenum internalformat, GLuint buffer) { (void)target; (void)internalformat; (void)buffer; call(288); }
+void (APIENTRYFP glTexBuffer) (GLenum target, GLenum internalformat, GLuint buffer) = null_glTexBuffer;
+#else
+void APIENTRY glTexBuffer (GLenum target, GLenum internalformat, GLuint buffer) { (void)target; (void)internalformat; (void)buffer; call(288); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glPrimitiveRestartIndex (GLuint index) { (void)index; call(289); }
+void (APIENTRYFP glPrimitiveRestartIndex) (GLuint index) = null_glPrimitiveRestartIndex;
+#else
+void APIENTRY glPrimitiveRestartIndex (GLuint index) { (void)index; call(289); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glCopyBufferSubData (GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) { (void)readTarget; (void)writeTarget; (void)readOffset; (void)writeOffset; (void)size; call(290); }
+void (APIENTRYFP glCopyBufferSubData) (GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) = null_glCopyBufferSubData;
+#else
+void APIENTRY glCopyBufferSubData (GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) { (void)readTarget; (void)writeTarget; (void)readOffset; (void)writeOffset; (void)size; call(290); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetUniformIndices (GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) { (void)program; (void)uniformCount; (void)uniformNames; (void)uniformIndices; call(291); }
+void (APIENTRYFP glGetUniformIndices) (GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) = null_glGetUniformIndices;
+#else
+void APIENTRY glGetUniformIndices (GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) { (void)program; (void)uniformCount; (void)uniformNames; (void)uniformIndices; call(291); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetActiveUniformsiv (GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) { (void)program; (void)uniformCount; (void)uniformIndices; (void)pname; (void)params; call(292); }
+void (APIENTRYFP glGetActiveUniformsiv) (GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) = null_glGetActiveUniformsiv;
+#else
+void APIENTRY glGetActiveUniformsiv (GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) { (void)program; (void)uniformCount; (void)uniformIndices; (void)pname; (void)params; call(292); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetActiveUniformName (GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName) { (void)program; (void)uniformIndex; (void)bufSize; (void)length; (void)uniformName; call(293); }
+void (APIENTRYFP glGetActiveUniformName) (GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName) = null_glGetActiveUniformName;
+#else
+void APIENTRY glGetActiveUniformName (GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName) { (void)program; (void)uniformIndex; (void)bufSize; (void)length; (void)uniformName; call(293); }
+#endif
+#ifdef _WIN32
+static GLuint APIENTRY null_glGetUniformBlockIndex (GLuint program, const GLchar *uniformBlockName) { (void)program; (void)uniformBlockName; call(294); return 0; }
+GLuint (APIENTRYFP glGetUniformBlockIndex) (GLuint program, const GLchar *uniformBlockName) = null_glGetUniformBlockIndex;
+#else
+GLuint APIENTRY glGetUniformBlockIndex (GLuint program, const GLchar *uniformBlockName) { (void)program; (void)uniformBlockName; call(294); return 0; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetActiveUniformBlockiv (GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) { (void)program; (void)uniformBlockIndex; (void)pname; (void)params; call(295); }
+void (APIENTRYFP glGetActiveUniformBlockiv) (GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) = null_glGetActiveUniformBlockiv;
+#else
+void APIENTRY glGetActiveUniformBlockiv (GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) { (void)program; (void)uniformBlockIndex; (void)pname; (void)params; call(295); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetActiveUniformBlockName (GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) { (void)program; (void)uniformBlockIndex; (void)bufSize; (void)length; (void)uniformBlockName; call(296); }
+void (APIENTRYFP glGetActiveUniformBlockName) (GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) = null_glGetActiveUniformBlockName;
+#else
+void APIENTRY glGetActiveUniformBlockName (GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) { (void)program; (void)uniformBlockIndex; (void)bufSize; (void)length; (void)uniformBlockName; call(296); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glUniformBlockBinding (GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) { (void)program; (void)uniformBlockIndex; (void)uniformBlockBinding; call(297); }
+void (APIENTRYFP glUniformBlockBinding) (GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) = null_glUniformBlockBinding;
+#else
+void APIENTRY glUniformBlockBinding (GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) { (void)program; (void)uniformBlockIndex; (void)uniformBlockBinding; call(297); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glDrawElementsBaseVertex (GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) { (void)mode; (void)type; (void)indices; (void)basevertex; call(298); gl_null.draws += 1; gl_null.vertices += uint64_t(count); }
+void (APIENTRYFP glDrawElementsBaseVertex) (GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) = null_glDrawElementsBaseVertex;
+#else
+void APIENTRY glDrawElementsBaseVertex (GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) { (void)mode; (void)type; (void)indices; (void)basevertex; call(298); gl_null.draws += 1; gl_null.vertices += uint64_t(count); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glDrawRangeElementsBaseVertex (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) { (void)mode; (void)start; (void)end; (void)type; (void)indices; (void)basevertex; call(299); gl_null.draws += 1; gl_null.vertices += uint64_t(count); }
+void (APIENTRYFP glDrawRangeElementsBaseVertex) (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) = null_glDrawRangeElementsBaseVertex;
+#else
+void APIENTRY glDrawRangeElementsBaseVertex (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) { (void)mode; (void)start; (void)end; (void)type; (void)indices; (void)basevertex; call(299); gl_null.draws += 1; gl_null.vertices += uint64_t(count); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glDrawElementsInstancedBaseVertex (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) { (void)mode; (void)type; (void)indices; (void)basevertex; call(300); gl_null.draws += 1; gl_null.vertices += uint64_t(count) * uint64_t(instancecount); }
+void (APIENTRYFP glDrawElementsInstancedBaseVertex) (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) = null_glDrawElementsInstancedBaseVertex;
+#else
+void APIENTRY glDrawElementsInstancedBaseVertex (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) { (void)mode; (void)type; (void)indices; (void)basevertex; call(300); gl_null.draws += 1; gl_null.vertices += uint64_t(count) * uint64_t(instancecount); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glMultiDrawElementsBaseVertex (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) { (void)mode; (void)count; (void)type; (void)indices; (void)drawcount; (void)basevertex; call(301); gl_null.draws += 1; }
+void (APIENTRYFP glMultiDrawElementsBaseVertex) (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) = null_glMultiDrawElementsBaseVertex;
+#else
+void APIENTRY glMultiDrawElementsBaseVertex (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) { (void)mode; (void)count; (void)type; (void)indices; (void)drawcount; (void)basevertex; call(301); gl_null.draws += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glProvokingVertex (GLenum mode) { (void)mode; call(302); }
+void (APIENTRYFP glProvokingVertex) (GLenum mode) = null_glProvokingVertex;
+#else
+void APIENTRY glProvokingVertex (GLenum mode) { (void)mode; call(302); }
+#endif
+#ifdef _WIN32
+static GLsync APIENTRY null_glFenceSync (GLenum condition, GLbitfield flags) { (void)condition; (void)flags; call(303); static int fence; return reinterpret_cast< GLsync >(&fence); }
+GLsync (APIENTRYFP glFenceSync) (GLenum condition, GLbitfield flags) = null_glFenceSync;
+#else
+GLsync APIENTRY glFenceSync (GLenum condition, GLbitfield flags) { (void)condition; (void)flags; call(303); static int fence; return reinterpret_cast< GLsync >(&fence); }
+#endif
+#ifdef _WIN32
+static GLboolean APIENTRY null_glIsSync (GLsync sync) { (void)sync; call(304); return GLboolean(0); }
+GLboolean (APIENTRYFP glIsSync) (GLsync sync) = null_glIsSync;
+#else
+GLboolean APIENTRY glIsSync (GLsync sync) { (void)sync; call(304); return GLboolean(0); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glDeleteSync (GLsync sync) { (void)sync; call(305); }
+void (APIENTRYFP glDeleteSync) (GLsync sync) = null_glDeleteSync;
+#else
+void APIENTRY glDeleteSync (GLsync sync) { (void)sync; call(305); }
+#endif
+#ifdef _WIN32
+static GLenum APIENTRY null_glClientWaitSync (GLsync sync, GLbitfield flags, GLuint64 timeout) { (void)sync; (void)flags; (void)timeout; call(306); return GL_ALREADY_SIGNALED; }
+GLenum (APIENTRYFP glClientWaitSync) (GLsync sync, GLbitfield flags, GLuint64 timeout) = null_glClientWaitSync;
+#else
+GLenum APIENTRY glClientWaitSync (GLsync sync, GLbitfield flags, GLuint64 timeout) { (void)sync; (void)flags; (void)timeout; call(306); return GL_ALREADY_SIGNALED; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glWaitSync (GLsync sync, GLbitfield flags, GLuint64 timeout) { (void)sync; (void)flags; (void)timeout; call(307); }
+void (APIENTRYFP glWaitSync) (GLsync sync, GLbitfield flags, GLuint64 timeout) = null_glWaitSync;
+#else
+void APIENTRY glWaitSync (GLsync sync, GLbitfield flags, GLuint64 timeout) { (void)sync; (void)flags; (void)timeout; call(307); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetInteger64v (GLenum pname, GLint64 *data) { call(308); GLint value[4] = { 0, 0, 0, 0 }; if (get(pname, value)) *data = GLint64(value[0]); }
+void (APIENTRYFP glGetInteger64v) (GLenum pname, GLint64 *data) = null_glGetInteger64v;
+#else
+void APIENTRY glGetInteger64v (GLenum pname, GLint64 *data) { call(308); GLint value[4] = { 0, 0, 0, 0 }; if (get(pname, value)) *data = GLint64(value[0]); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetSynciv (GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values) { (void)sync; (void)pname; (void)bufSize; (void)length; (void)values; call(309); }
+void (APIENTRYFP glGetSynciv) (GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values) = null_glGetSynciv;
+#else
+void APIENTRY glGetSynciv (GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values) { (void)sync; (void)pname; (void)bufSize; (void)length; (void)values; call(309); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetInteger64i_v (GLenum target, GLuint index, GLint64 *data) { (void)target; (void)index; (void)data; call(310); }
+void (APIENTRYFP glGetInteger64i_v) (GLenum target, GLuint index, GLint64 *data) = null_glGetInteger64i_v;
+#else
+void APIENTRY glGetInteger64i_v (GLenum target, GLuint index, GLint64 *data) { (void)target; (void)index; (void)data; call(310); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetBufferParameteri64v (GLenum target, GLenum pname, GLint64 *params) { (void)target; (void)pname; (void)params; call(311); }
+void (APIENTRYFP glGetBufferParameteri64v) (GLenum target, GLenum pname, GLint64 *params) = null_glGetBufferParameteri64v;
+#else
+void APIENTRY glGetBufferParameteri64v (GLenum target, GLenum pname, GLint64 *params) { (void)target; (void)pname; (void)params; call(311); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glFramebufferTexture (GLenum target, GLenum attachment, GLuint texture, GLint level) { (void)target; (void)attachment; (void)texture; (void)level; call(312); }
+void (APIENTRYFP glFramebufferTexture) (GLenum target, GLenum attachment, GLuint texture, GLint level) = null_glFramebufferTexture;
+#else
+void APIENTRY glFramebufferTexture (GLenum target, GLenum attachment, GLuint texture, GLint level) { (void)target; (void)attachment; (void)texture; (void)level; call(312); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glTexImage2DMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) { (void)target; (void)samples; (void)internalformat; (void)width; (void)height; (void)fixedsamplelocations; call(313); }
+void (APIENTRYFP glTexImage2DMultisample) (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) = null_glTexImage2DMultisample;
+#else
+void APIENTRY glTexImage2DMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) { (void)target; (void)samples; (void)internalformat; (void)width; (void)height; (void)fixedsamplelocations; call(313); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glTexImage3DMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) { (void)target; (void)samples; (void)internalformat; (void)width; (void)height; (void)depth; (void)fixedsamplelocations; call(314); }
+void (APIENTRYFP glTexImage3DMultisample) (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) = null_glTexImage3DMultisample;
+#else
+void APIENTRY glTexImage3DMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) { (void)target; (void)samples; (void)internalformat; (void)width; (void)height; (void)depth; (void)fixedsamplelocations; call(314); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetMultisamplefv (GLenum pname, GLuint index, GLfloat *val) { (void)pname; (void)index; (void)val; call(315); }
+void (APIENTRYFP glGetMultisamplefv) (GLenum pname, GLuint index, GLfloat *val) = null_glGetMultisamplefv;
+#else
+void APIENTRY glGetMultisamplefv (GLenum pname, GLuint index, GLfloat *val) { (void)pname; (void)index; (void)val; call(315); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glSampleMaski (GLuint maskNumber, GLbitfield mask) { (void)maskNumber; (void)mask; call(316); }
+void (APIENTRYFP glSampleMaski) (GLuint maskNumber, GLbitfield mask) = null_glSampleMaski;
+#else
+void APIENTRY glSampleMaski (GLuint maskNumber, GLbitfield mask) { (void)maskNumber; (void)mask; call(316); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glBindFragDataLocationIndexed (GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) { (void)program; (void)colorNumber; (void)index; (void)name; call(317); gl_null.binds += 1; }
+void (APIENTRYFP glBindFragDataLocationIndexed) (GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) = null_glBindFragDataLocationIndexed;
+#else
+void APIENTRY glBindFragDataLocationIndexed (GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) { (void)program; (void)colorNumber; (void)index; (void)name; call(317); gl_null.binds += 1; }
+#endif
+#ifdef _WIN32
+static GLint APIENTRY null_glGetFragDataIndex (GLuint program, const GLchar *name) { (void)program; (void)name; call(318); return GLint(0); }
+GLint (APIENTRYFP glGetFragDataIndex) (GLuint program, const GLchar *name) = null_glGetFragDataIndex;
+#else
+GLint APIENTRY glGetFragDataIndex (GLuint program, const GLchar *name) { (void)program; (void)name; call(318); return GLint(0); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGenSamplers (GLsizei count, GLuint *samplers) { (void)count; (void)samplers; call(319); }
+void (APIENTRYFP glGenSamplers) (GLsizei count, GLuint *samplers) = null_glGenSamplers;
+#else
+void APIENTRY glGenSamplers (GLsizei count, GLuint *samplers) { (void)count; (void)samplers; call(319); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glDeleteSamplers (GLsizei count, const GLuint *samplers) { (void)count; (void)samplers; call(320); }
+void (APIENTRYFP glDeleteSamplers) (GLsizei count, const GLuint *samplers) = null_glDeleteSamplers;
+#else
+void APIENTRY glDeleteSamplers (GLsizei count, const GLuint *samplers) { (void)count; (void)samplers; call(320); }
+#endif
+#ifdef _WIN32
+static GLboolean APIENTRY null_glIsSampler (GLuint sampler) { (void)sampler; call(321); return GLboolean(0); }
+GLboolean (APIENTRYFP glIsSampler) (GLuint sampler) = null_glIsSampler;
+#else
+GLboolean APIENTRY glIsSampler (GLuint sampler) { (void)sampler; call(321); return GLboolean(0); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glBindSampler (GLuint unit, GLuint sampler) { (void)unit; (void)sampler; call(322); gl_null.binds += 1; }
+void (APIENTRYFP glBindSampler) (GLuint unit, GLuint sampler) = null_glBindSampler;
+#else
+void APIENTRY glBindSampler (GLuint unit, GLuint sampler) { (void)unit; (void)sampler; call(322); gl_null.binds += 1; }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glSamplerParameteri (GLuint sampler, GLenum pname, GLint param) { (void)sampler; (void)pname; (void)param; call(323); }
+void (APIENTRYFP glSamplerParameteri) (GLuint sampler, GLenum pname, GLint param) = null_glSamplerParameteri;
+#else
+void APIENTRY glSamplerParameteri (GLuint sampler, GLenum pname, GLint param) { (void)sampler; (void)pname; (void)param; call(323); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glSamplerParameteriv (GLuint sampler, GLenum pname, const GLint *param) { (void)sampler; (void)pname; (void)param; call(324); }
+void (APIENTRYFP glSamplerParameteriv) (GLuint sampler, GLenum pname, const GLint *param) = null_glSamplerParameteriv;
+#else
+void APIENTRY glSamplerParameteriv (GLuint sampler, GLenum pname, const GLint *param) { (void)sampler; (void)pname; (void)param; call(324); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glSamplerParameterf (GLuint sampler, GLenum pname, GLfloat param) { (void)sampler; (void)pname; (void)param; call(325); }
+void (APIENTRYFP glSamplerParameterf) (GLuint sampler, GLenum pname, GLfloat param) = null_glSamplerParameterf;
+#else
+void APIENTRY glSamplerParameterf (GLuint sampler, GLenum pname, GLfloat param) { (void)sampler; (void)pname; (void)param; call(325); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glSamplerParameterfv (GLuint sampler, GLenum pname, const GLfloat *param) { (void)sampler; (void)pname; (void)param; call(326); }
+void (APIENTRYFP glSamplerParameterfv) (GLuint sampler, GLenum pname, const GLfloat *param) = null_glSamplerParameterfv;
+#else
+void APIENTRY glSamplerParameterfv (GLuint sampler, GLenum pname, const GLfloat *param) { (void)sampler; (void)pname; (void)param; call(326); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glSamplerParameterIiv (GLuint sampler, GLenum pname, const GLint *param) { (void)sampler; (void)pname; (void)param; call(327); }
+void (APIENTRYFP glSamplerParameterIiv) (GLuint sampler, GLenum pname, const GLint *param) = null_glSamplerParameterIiv;
+#else
+void APIENTRY glSamplerParameterIiv (GLuint sampler, GLenum pname, const GLint *param) { (void)sampler; (void)pname; (void)param; call(327); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glSamplerParameterIuiv (GLuint sampler, GLenum pname, const GLuint *param) { (void)sampler; (void)pname; (void)param; call(328); }
+void (APIENTRYFP glSamplerParameterIuiv) (GLuint sampler, GLenum pname, const GLuint *param) = null_glSamplerParameterIuiv;
+#else
+void APIENTRY glSamplerParameterIuiv (GLuint sampler, GLenum pname, const GLuint *param) { (void)sampler; (void)pname; (void)param; call(328); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetSamplerParameteriv (GLuint sampler, GLenum pname, GLint *params) { (void)sampler; (void)pname; (void)params; call(329); }
+void (APIENTRYFP glGetSamplerParameteriv) (GLuint sampler, GLenum pname, GLint *params) = null_glGetSamplerParameteriv;
+#else
+void APIENTRY glGetSamplerParameteriv (GLuint sampler, GLenum pname, GLint *params) { (void)sampler; (void)pname; (void)params; call(329); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetSamplerParameterIiv (GLuint sampler, GLenum pname, GLint *params) { (void)sampler; (void)pname; (void)params; call(330); }
+void (APIENTRYFP glGetSamplerParameterIiv) (GLuint sampler, GLenum pname, GLint *params) = null_glGetSamplerParameterIiv;
+#else
+void APIENTRY glGetSamplerParameterIiv (GLuint sampler, GLenum pname, GLint *params) { (void)sampler; (void)pname; (void)params; call(330); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetSamplerParameterfv (GLuint sampler, GLenum pname, GLfloat *params) { (void)sampler; (void)pname; (void)params; call(331); }
+void (APIENTRYFP glGetSamplerParameterfv) (GLuint sampler, GLenum pname, GLfloat *params) = null_glGetSamplerParameterfv;
+#else
+void APIENTRY glGetSamplerParameterfv (GLuint sampler, GLenum pname, GLfloat *params) { (void)sampler; (void)pname; (void)params; call(331); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetSamplerParameterIuiv (GLuint sampler, GLenum pname, GLuint *params) { (void)sampler; (void)pname; (void)params; call(332); }
+void (APIENTRYFP glGetSamplerParameterIuiv) (GLuint sampler, GLenum pname, GLuint *params) = null_glGetSamplerParameterIuiv;
+#else
+void APIENTRY glGetSamplerParameterIuiv (GLuint sampler, GLenum pname, GLuint *params) { (void)sampler; (void)pname; (void)params; call(332); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glQueryCounter (GLuint id, GLenum target) { (void)id; (void)target; call(333); }
+void (APIENTRYFP glQueryCounter) (GLuint id, GLenum target) = null_glQueryCounter;
+#else
+void APIENTRY glQueryCounter (GLuint id, GLenum target) { (void)id; (void)target; call(333); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetQueryObjecti64v (GLuint id, GLenum pname, GLint64 *params) { (void)id; call(334); if (params) *params = (pname == GL_QUERY_RESULT_AVAILABLE ? GL_TRUE : 0); }
+void (APIENTRYFP glGetQueryObjecti64v) (GLuint id, GLenum pname, GLint64 *params) = null_glGetQueryObjecti64v;
+#else
+void APIENTRY glGetQueryObjecti64v (GLuint id, GLenum pname, GLint64 *params) { (void)id; call(334); if (params) *params = (pname == GL_QUERY_RESULT_AVAILABLE ? GL_TRUE : 0); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glGetQueryObjectui64v (GLuint id, GLenum pname, GLuint64 *params) { (void)id; call(335); if (params) *params = (pname == GL_QUERY_RESULT_AVAILABLE ? GL_TRUE : 0); }
+void (APIENTRYFP glGetQueryObjectui64v) (GLuint id, GLenum pname, GLuint64 *params) = null_glGetQueryObjectui64v;
+#else
+void APIENTRY glGetQueryObjectui64v (GLuint id, GLenum pname, GLuint64 *params) { (void)id; call(335); if (params) *params = (pname == GL_QUERY_RESULT_AVAILABLE ? GL_TRUE : 0); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttribDivisor (GLuint index, GLuint divisor) { (void)index; (void)divisor; call(336); }
+void (APIENTRYFP glVertexAttribDivisor) (GLuint index, GLuint divisor) = null_glVertexAttribDivisor;
+#else
+void APIENTRY glVertexAttribDivisor (GLuint index, GLuint divisor) { (void)index; (void)divisor; call(336); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttribP1ui (GLuint index, GLenum type, GLboolean normalized, GLuint value) { (void)index; (void)type; (void)normalized; (void)value; call(337); }
+void (APIENTRYFP glVertexAttribP1ui) (GLuint index, GLenum type, GLboolean normalized, GLuint value) = null_glVertexAttribP1ui;
+#else
+void APIENTRY glVertexAttribP1ui (GLuint index, GLenum type, GLboolean normalized, GLuint value) { (void)index; (void)type; (void)normalized; (void)value; call(337); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttribP1uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value) { (void)index; (void)type; (void)normalized; (void)value; call(338); }
+void (APIENTRYFP glVertexAttribP1uiv) (GLuint index, GLenum type, GLboolean normalized, const GLuint *value) = null_glVertexAttribP1uiv;
+#else
+void APIENTRY glVertexAttribP1uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value) { (void)index; (void)type; (void)normalized; (void)value; call(338); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttribP2ui (GLuint index, GLenum type, GLboolean normalized, GLuint value) { (void)index; (void)type; (void)normalized; (void)value; call(339); }
+void (APIENTRYFP glVertexAttribP2ui) (GLuint index, GLenum type, GLboolean normalized, GLuint value) = null_glVertexAttribP2ui;
+#else
+void APIENTRY glVertexAttribP2ui (GLuint index, GLenum type, GLboolean normalized, GLuint value) { (void)index; (void)type; (void)normalized; (void)value; call(339); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttribP2uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value) { (void)index; (void)type; (void)normalized; (void)value; call(340); }
+void (APIENTRYFP glVertexAttribP2uiv) (GLuint index, GLenum type, GLboolean normalized, const GLuint *value) = null_glVertexAttribP2uiv;
+#else
+void APIENTRY glVertexAttribP2uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value) { (void)index; (void)type; (void)normalized; (void)value; call(340); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttribP3ui (GLuint index, GLenum type, GLboolean normalized, GLuint value) { (void)index; (void)type; (void)normalized; (void)value; call(341); }
+void (APIENTRYFP glVertexAttribP3ui) (GLuint index, GLenum type, GLboolean normalized, GLuint value) = null_glVertexAttribP3ui;
+#else
+void APIENTRY glVertexAttribP3ui (GLuint index, GLenum type, GLboolean normalized, GLuint value) { (void)index; (void)type; (void)normalized; (void)value; call(341); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttribP3uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value) { (void)index; (void)type; (void)normalized; (void)value; call(342); }
+void (APIENTRYFP glVertexAttribP3uiv) (GLuint index, GLenum type, GLboolean normalized, const GLuint *value) = null_glVertexAttribP3uiv;
+#else
+void APIENTRY glVertexAttribP3uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value) { (void)index; (void)type; (void)normalized; (void)value; call(342); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttribP4ui (GLuint index, GLenum type, GLboolean normalized, GLuint value) { (void)index; (void)type; (void)normalized; (void)value; call(343); }
+void (APIENTRYFP glVertexAttribP4ui) (GLuint index, GLenum type, GLboolean normalized, GLuint value) = null_glVertexAttribP4ui;
+#else
+void APIENTRY glVertexAttribP4ui (GLuint index, GLenum type, GLboolean normalized, GLuint value) { (void)index; (void)type; (void)normalized; (void)value; call(343); }
+#endif
+#ifdef _WIN32
+static void APIENTRY null_glVertexAttribP4uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value) { (void)index; (void)type; (void)normalized; (void)value; call(344); }
+void (APIENTRYFP glVertexAttribP4uiv) (GLuint index, GLenum type, GLboolean normalized, const GLuint *value) = null_glVertexAttribP4uiv;
+#else
+void APIENTRY glVertexAttribP4uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value) { (void)index; (void)type; (void)normalized; (void)value; call(344); }
+#endif
+
+} //extern "C"
@@ -0,0 +1,46 @@
+#pragma once
+
+/*
+ * GL-null.cpp is a drop-in replacement for GL.cpp: link it instead, and every
+ *  entry point declared in GL.hpp becomes a stub that draws nothing and needs
+ *  no context -- it only counts (and, if asked, records) the calls made.
+ *
+ * This lets the CPU side of rendering (e.g., Scene::draw) be timed on machines
+ *  without a GPU; see bench-render.cpp.
+ *
+ * The stubs do just enough to keep callers happy: glGen* and glCreate* hand out
+ *  fresh names, shaders compile and programs link, framebuffers are complete,
+ *  queries are immediately available (and read zero), glMap* return scratch memory.
+ *
+ * GL-null.cpp is generated from GL.hpp by make-GL-null.py.
+ *
+ */
+
+#include <cstdint>
+#include <vector>
+
+struct GLNull {
+	GLNull();
+
+	static uint32_t const FunctionCount;
+	static char const * const FunctionNames[]; //entry points, in GL.hpp order
+
+	std::vector< uint64_t > calls; //per entry point, indexed like FunctionNames
+	uint64_t total = 0; //all calls
+
+	//calls (and their work) by kind:
+	uint64_t binds = 0; //glBind*, glUseProgram, glActiveTexture
+	uint64_t uniforms = 0; //glUniform*
+	uint64_t draws = 0; //glDraw*, glMultiDraw*
+	uint64_t vertices = 0; //vertices (times instances) submitted by draws
+	uint64_t uploaded_bytes = 0; //glBufferData, glBufferSubData, and glMap*'d bytes
+
+	//if set, every call appends its index in FunctionNames to 'trace':
+	bool tracing = false;
+	std::vector< uint16_t > trace;
+
+	//zero all counters and clear 'trace':
+	void reset();
+};
+
+extern GLNull gl_null;
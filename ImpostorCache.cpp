@@ -0,0 +1,371 @@
+#include "ImpostorCache.hpp"
+
+#include "gl_errors.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+
+//axes of a camera looking along -dir (with world +z up):
+static void view_basis(glm::vec3 const &dir, glm::vec3 *right, glm::vec3 *up, glm::vec3 *forward) {
+	*forward = -dir;
+	*right = glm::normalize(glm::cross(*forward, glm::vec3(0.0f, 0.0f, 1.0f)));
+	*up = glm::cross(*right, *forward);
+}
+
+ImpostorCache::ImpostorCache(uint32_t tile_size_, uint32_t max_impostors_) : tile_size(tile_size_), max_impostors(max_impostors_) {
+	assert(tile_size > 0 && max_impostors > 0);
+
+	//rows of (about) 2048 texels, holding whole slots:
+	tiles.x = std::max(uint32_t(Views), 2048 / tile_size / Views * Views);
+	tiles.y = (max_impostors * Views + tiles.x - 1) / tiles.x;
+	glm::uvec2 size = tiles * tile_size;
+
+	glGenTextures(1, &atlas);
+	glBindTexture(GL_TEXTURE_2D, atlas);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, size.x, size.y, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	glGenRenderbuffers(1, &atlas_depth);
+	glBindRenderbuffer(GL_RENDERBUFFER, atlas_depth);
+	glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, size.x, size.y);
+	glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+	GLint old_framebuffer = 0;
+	glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &old_framebuffer);
+	glGenFramebuffers(1, &framebuffer);
+	glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, atlas, 0);
+	glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, atlas_depth);
+	GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+	if (status != GL_FRAMEBUFFER_COMPLETE) {
+		throw std::runtime_error("Impostor atlas framebuffer is incomplete (status " + std::to_string(status) + ").");
+	}
+	//start out fully transparent (the clear ignores the viewport, and the scissor test is assumed off here):
+	GLfloat clear_color[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+	glClearBufferfv(GL_COLOR, 0, clear_color);
+	glBindFramebuffer(GL_FRAMEBUFFER, old_framebuffer);
+
+	glBindTexture(GL_TEXTURE_2D, atlas);
+	glGenerateMipmap(GL_TEXTURE_2D);
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	glGenBuffers(1, &frame_buffer);
+	glGenBuffers(1, &object_buffer);
+
+	//quads are written by use() and uploaded by draw():
+	glGenBuffers(1, &quad_buffer);
+	glGenVertexArrays(1, &quad_vao);
+	glBindVertexArray(quad_vao);
+	glBindBuffer(GL_ARRAY_BUFFER, quad_buffer);
+	//(locations match impostor.vert)
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (GLbyte *)0 + offsetof(Vertex, position));
+	glEnableVertexAttribArray(0);
+	glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (GLbyte *)0 + offsetof(Vertex, tex_coord));
+	glEnableVertexAttribArray(1);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	glBindVertexArray(0);
+
+	//(hand out slot 0 first)
+	for (uint32_t slot = max_impostors; slot > 0; --slot) {
+		free_slots.emplace_back(slot - 1);
+	}
+
+	GL_ERRORS();
+}
+
+ImpostorCache::~ImpostorCache() {
+	glDeleteVertexArrays(1, &quad_vao);
+	glDeleteBuffers(1, &quad_buffer);
+	glDeleteBuffers(1, &object_buffer);
+	glDeleteBuffers(1, &frame_buffer);
+	glDeleteFramebuffers(1, &framebuffer);
+	glDeleteRenderbuffers(1, &atlas_depth);
+	glDeleteTextures(1, &atlas);
+}
+
+bool ImpostorCache::can_impostor(Scene::Drawable const &drawable) {
+	Scene::Drawable::Pipeline const &pipeline = drawable.pipeline;
+	if (!drawable.has_bounds) return false;
+	if (pipeline.program == 0 || pipeline.count == 0) return false;
+	if (!pipeline.uniform_blocks || pipeline.material.layout) return false;
+	for (Scene::Transform const *t = drawable.transform; t; t = t->parent) {
+		if (t->dynamic) return false;
+	}
+	return true;
+}
+
+glm::vec3 ImpostorCache::view_direction(uint32_t view) const {
+	float angle = view * (2.0f * 3.1415926f / Views);
+	return glm::vec3(std::cos(angle) * std::cos(elevation), std::sin(angle) * std::cos(elevation), std::sin(elevation));
+}
+
+void ImpostorCache::bounding_sphere(Scene::Drawable const &drawable, glm::mat4 const &object_to_world, glm::vec3 *center, float *radius) {
+	*center = glm::vec3(object_to_world * glm::vec4(0.5f * (drawable.min + drawable.max), 1.0f));
+	*radius = 0.0f;
+	for (uint32_t i = 0; i < 8; ++i) {
+		glm::vec3 corner = glm::vec3(object_to_world * glm::vec4(
+			(i & 1 ? drawable.max.x : drawable.min.x),
+			(i & 2 ? drawable.max.y : drawable.min.y),
+			(i & 4 ? drawable.max.z : drawable.min.z),
+			1.0f
+		));
+		*radius = std::max(*radius, glm::length(corner - *center));
+	}
+}
+
+glm::uvec2 ImpostorCache::tile_origin(uint32_t slot, uint32_t view) const {
+	uint32_t tile = slot * Views + view;
+	return glm::uvec2(tile % tiles.x, tile / tiles.x) * tile_size;
+}
+
+ImpostorCache::Impostor *ImpostorCache::find(Scene::Drawable const &drawable) {
+	Scene::Drawable::Pipeline const &pipeline = drawable.pipeline;
+
+	auto f = impostors.find(&drawable);
+	if (f != impostors.end()) {
+		Impostor &impostor = f->second;
+		if (impostor.vao != pipeline.vao || impostor.start != pipeline.start || impostor.count != pipeline.count) {
+			impostor.ready = impostor.requested = 0;
+			impostor.vao = pipeline.vao;
+			impostor.start = pipeline.start;
+			impostor.count = pipeline.count;
+		}
+		impostor.last_used = frame;
+		return &impostor;
+	}
+
+	uint32_t slot;
+	if (!free_slots.empty()) {
+		slot = free_slots.back();
+		free_slots.pop_back();
+	} else {
+		//take over the slot of the least recently used impostor that isn't in use this frame:
+		auto victim = impostors.end();
+		for (auto i = impostors.begin(); i != impostors.end(); ++i) {
+			if (i->second.last_used == frame) continue;
+			if (victim == impostors.end() || i->second.last_used < victim->second.last_used) victim = i;
+		}
+		if (victim == impostors.end()) return nullptr;
+		slot = victim->second.slot;
+		impostors.erase(victim);
+	}
+
+	Impostor &impostor = impostors[&drawable];
+	impostor.slot = slot;
+	impostor.vao = pipeline.vao;
+	impostor.start = pipeline.start;
+	impostor.count = pipeline.count;
+	impostor.last_used = frame;
+	return &impostor;
+}
+
+bool ImpostorCache::use(Scene::Drawable const &drawable, glm::mat4 const &object_to_world, glm::vec3 const &eye, float distance) {
+	if (!can_impostor(drawable)) return false;
+
+	glm::vec3 center;
+	float radius;
+	bounding_sphere(drawable, object_to_world, &center, &radius);
+	glm::vec3 to_eye = eye - center;
+	if (glm::length(to_eye) - radius < distance) return false;
+
+	Impostor *impostor = find(drawable);
+	if (!impostor) return false;
+
+	//nearest captured direction around the vertical axis:
+	float steps = std::atan2(to_eye.y, to_eye.x) / (2.0f * 3.1415926f / Views);
+	int32_t nearest = int32_t(std::floor(steps + 0.5f)) % int32_t(Views);
+	uint32_t view = uint32_t(nearest < 0 ? nearest + int32_t(Views) : nearest);
+	uint32_t bit = 1u << view;
+
+	if (!(impostor->ready & bit)) {
+		if (!(impostor->requested & bit)) {
+			impostor->requested |= bit;
+			requests.emplace_back(Request{ &drawable, object_to_world, view });
+		}
+		return false;
+	}
+
+	//quad through the center of the bounds, facing along the tile's direction:
+	glm::vec3 right, up, forward;
+	view_basis(view_direction(view), &right, &up, &forward);
+	glm::vec2 origin = glm::vec2(tile_origin(impostor->slot, view));
+	glm::vec2 atlas_size = glm::vec2(tiles * tile_size);
+	auto corner = [&](float x, float y) {
+		Vertex vertex;
+		vertex.position = center + radius * (x * right + y * up);
+		vertex.tex_coord = (origin + (0.5f * glm::vec2(x, y) + 0.5f) * float(tile_size)) / atlas_size;
+		quads.emplace_back(vertex);
+	};
+	corner(-1.0f,-1.0f); corner( 1.0f,-1.0f); corner( 1.0f, 1.0f);
+	corner(-1.0f,-1.0f); corner( 1.0f, 1.0f); corner(-1.0f, 1.0f);
+	return true;
+}
+
+void ImpostorCache::refresh(Scene::FrameUniforms const &frame_uniforms) {
+	if (requests.empty()) return;
+
+	//remember the state changed below:
+	GLint old_framebuffer = 0;
+	glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &old_framebuffer);
+	GLint old_viewport[4];
+	glGetIntegerv(GL_VIEWPORT, old_viewport);
+	GLboolean old_scissor = glIsEnabled(GL_SCISSOR_TEST);
+	GLboolean old_depth_test = glIsEnabled(GL_DEPTH_TEST);
+	GLboolean old_blend = glIsEnabled(GL_BLEND);
+	GLint old_depth_func = GL_LESS;
+	glGetIntegerv(GL_DEPTH_FUNC, &old_depth_func);
+	GLboolean old_depth_mask = GL_TRUE;
+	glGetBooleanv(GL_DEPTH_WRITEMASK, &old_depth_mask);
+
+	glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+	glEnable(GL_SCISSOR_TEST);
+	glEnable(GL_DEPTH_TEST);
+	glDepthFunc(GL_LESS);
+	glDepthMask(GL_TRUE);
+	glDisable(GL_BLEND);
+
+	glm::mat4x3 world_to_light;
+	for (uint32_t col = 0; col < 4; ++col) {
+		world_to_light[col] = glm::vec3(frame_uniforms.world_to_light[col]);
+	}
+
+	uint32_t rendered = 0;
+	for (auto const &request : requests) {
+		auto f = impostors.find(request.drawable);
+		if (f == impostors.end()) continue; //(slot was taken over since the request)
+		Impostor &impostor = f->second;
+		uint32_t bit = 1u << request.view;
+		impostor.requested &= ~bit;
+		if (rendered >= refreshes_per_frame) continue; //(use() will ask again)
+
+		Scene::Drawable const &drawable = *request.drawable;
+		Scene::Drawable::Pipeline const &pipeline = drawable.pipeline;
+
+		//orthographic view of the bounding sphere, from outside it along the tile's direction:
+		glm::vec3 center;
+		float radius;
+		bounding_sphere(drawable, request.object_to_world, &center, &radius);
+		glm::vec3 right, up, forward;
+		view_basis(view_direction(request.view), &right, &up, &forward);
+		glm::mat4 world_to_clip(1.0f);
+		for (uint32_t i = 0; i < 3; ++i) {
+			world_to_clip[i] = glm::vec4(right[i], up[i], forward[i], 0.0f) / radius;
+		}
+		world_to_clip[3] = glm::vec4(-glm::dot(right, center), -glm::dot(up, center), -glm::dot(forward, center), radius) / radius;
+
+		Scene::FrameUniforms tile_frame = frame_uniforms;
+		tile_frame.world_to_clip = world_to_clip;
+		tile_frame.cluster_counts = glm::uvec4(0); //(the light grid belongs to the main view, so tiles get no point lights)
+
+		Scene::ObjectUniforms object;
+		glm::mat4 position_to_world = request.object_to_world * pipeline.position_to_object(); //(for quantized positions)
+		object.object_to_clip = world_to_clip * position_to_world;
+		glm::mat4x3 object_to_light = world_to_light * request.object_to_world;
+		glm::mat3 normal_to_light = glm::inverse(glm::transpose(glm::mat3(object_to_light)));
+		glm::mat4x3 position_to_light = world_to_light * position_to_world;
+		for (uint32_t col = 0; col < 4; ++col) {
+			object.object_to_light[col] = glm::vec4(position_to_light[col], 0.0f);
+		}
+		for (uint32_t col = 0; col < 3; ++col) {
+			object.normal_to_light[col] = glm::vec4(normal_to_light[col], 0.0f);
+		}
+		object.custom_col = (drawable.custom_col ? *drawable.custom_col : glm::vec4(1.0f, 0.0f, 1.0f, 1.0f));
+
+		glBindBuffer(GL_UNIFORM_BUFFER, frame_buffer);
+		glBufferData(GL_UNIFORM_BUFFER, sizeof(tile_frame), &tile_frame, GL_STREAM_DRAW);
+		glBindBuffer(GL_UNIFORM_BUFFER, object_buffer);
+		glBufferData(GL_UNIFORM_BUFFER, sizeof(object), &object, GL_STREAM_DRAW);
+		glBindBuffer(GL_UNIFORM_BUFFER, 0);
+		glBindBufferBase(GL_UNIFORM_BUFFER, Scene::FrameBinding, frame_buffer);
+		glBindBufferBase(GL_UNIFORM_BUFFER, Scene::ObjectBinding, object_buffer);
+
+		glm::uvec2 origin = tile_origin(impostor.slot, request.view);
+		glViewport(origin.x, origin.y, tile_size, tile_size);
+		glScissor(origin.x, origin.y, tile_size, tile_size);
+		GLfloat clear_color[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+		glClearBufferfv(GL_COLOR, 0, clear_color);
+		GLfloat clear_depth = 1.0f;
+		glClearBufferfv(GL_DEPTH, 0, &clear_depth);
+
+		glUseProgram(pipeline.program);
+		glBindVertexArray(pipeline.vao);
+		for (uint32_t i = 0; i < Scene::Drawable::Pipeline::TextureCount; ++i) {
+			if (pipeline.textures[i].texture == 0) continue;
+			glActiveTexture(GL_TEXTURE0 + i);
+			glBindTexture(pipeline.textures[i].target, pipeline.textures[i].texture);
+		}
+		if (pipeline.index_type != 0) {
+			glDrawElements(pipeline.type, pipeline.count, pipeline.index_type, (GLbyte *)0 + pipeline.start * (pipeline.index_type == GL_UNSIGNED_SHORT ? 2 : 4));
+		} else {
+			glDrawArrays(pipeline.type, pipeline.start, pipeline.count);
+		}
+		for (uint32_t i = 0; i < Scene::Drawable::Pipeline::TextureCount; ++i) {
+			if (pipeline.textures[i].texture == 0) continue;
+			glActiveTexture(GL_TEXTURE0 + i);
+			glBindTexture(pipeline.textures[i].target, 0);
+		}
+
+		impostor.ready |= bit;
+		rendered += 1;
+	}
+	requests.clear();
+
+	glUseProgram(0);
+	glBindVertexArray(0);
+	glActiveTexture(GL_TEXTURE0);
+
+	glBindFramebuffer(GL_FRAMEBUFFER, old_framebuffer);
+	glViewport(old_viewport[0], old_viewport[1], old_viewport[2], old_viewport[3]);
+	if (!old_scissor) glDisable(GL_SCISSOR_TEST);
+	if (!old_depth_test) glDisable(GL_DEPTH_TEST);
+	if (old_blend) glEnable(GL_BLEND);
+	glDepthFunc(old_depth_func);
+	glDepthMask(old_depth_mask);
+
+	if (rendered != 0) {
+		glBindTexture(GL_TEXTURE_2D, atlas);
+		glGenerateMipmap(GL_TEXTURE_2D);
+		glBindTexture(GL_TEXTURE_2D, 0);
+	}
+
+	GL_ERRORS();
+}
+
+uint32_t ImpostorCache::draw(GLuint program) {
+	frame += 1;
+	if (quads.empty()) return 0;
+	uint32_t count = uint32_t(quads.size() / 6);
+
+	glBindBuffer(GL_ARRAY_BUFFER, quad_buffer);
+	glBufferData(GL_ARRAY_BUFFER, quads.size() * sizeof(Vertex), quads.data(), GL_STREAM_DRAW);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	glUseProgram(program);
+	glBindVertexArray(quad_vao);
+	glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_2D, atlas);
+
+	glDrawArrays(GL_TRIANGLES, 0, GLsizei(quads.size()));
+
+	glBindTexture(GL_TEXTURE_2D, 0);
+	glBindVertexArray(0);
+	glUseProgram(0);
+
+	quads.clear();
+	GL_ERRORS();
+	return count;
+}
+
+void ImpostorCache::invalidate() {
+	for (auto &kv : impostors) {
+		kv.second.ready = 0;
+	}
+}
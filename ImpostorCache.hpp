@@ -0,0 +1,101 @@
+#pragma once
+
+/*
+ * ImpostorCache keeps pictures of far-away static drawables (e.g., baked city blocks),
+ *  so they can be drawn as one textured quad each instead of their full meshes.
+ *
+ * Each drawable gets a row of Views tiles in a texture atlas, one per direction around
+ *  the vertical axis (all captured from the same slight 'elevation' above the horizon).
+ * Tiles are rendered lazily: use() requests the tile for the current view direction and
+ *  returns false until it exists (the caller draws the real mesh meanwhile); refresh()
+ *  then renders at most refreshes_per_frame requested tiles.
+ * Drawables whose tile is ready get a quad facing along the tile's view direction,
+ *  and draw() sends all of those quads in one call.
+ *
+ * Scene::draw does all of this for drawables farther than Scene::impostor_distance.
+ *
+ */
+
+#include "GL.hpp"
+#include "Scene.hpp"
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+struct ImpostorCache {
+	ImpostorCache(uint32_t tile_size = 128, uint32_t max_impostors = 32);
+	~ImpostorCache();
+	ImpostorCache(ImpostorCache const &) = delete;
+	ImpostorCache &operator=(ImpostorCache const &) = delete;
+
+	enum : uint32_t { Views = 8 };
+	float elevation = 0.25f; //angle (radians) above the horizon that tiles are captured from
+	uint32_t refreshes_per_frame = 8; //tiles rendered per refresh() at most
+
+	//Can 'drawable' be drawn as an impostor?
+	// (needs bounds, a pipeline with uniform blocks and no material, and no dynamic transforms above it)
+	static bool can_impostor(Scene::Drawable const &drawable);
+
+	//If 'drawable' can be an impostor and its bounds are all at least 'distance' from 'eye':
+	// queues a quad and returns true if the tile facing 'eye' is ready; otherwise requests the tile and returns false.
+	bool use(Scene::Drawable const &drawable, glm::mat4 const &object_to_world, glm::vec3 const &eye, float distance);
+
+	//Render requested tiles; 'frame' supplies world_to_light and fog for them (world_to_clip is replaced per tile).
+	// Leaves the draw framebuffer and viewport as they were, but (like Scene::draw) binds the Frame/Object uniform blocks:
+	void refresh(Scene::FrameUniforms const &frame);
+
+	//Draw all quads queued by use() since the last draw() with 'program' (see ImpostorProgram.hpp),
+	// which reads WORLD_TO_CLIP (and fog) from the already-bound "Frame" block. Returns the number of quads:
+	uint32_t draw(GLuint program);
+
+	//Mark every tile as out of date (e.g., after changing the scene's lighting):
+	void invalidate();
+
+	//---- internals ----
+	uint32_t tile_size;
+	uint32_t max_impostors;
+	glm::uvec2 tiles = glm::uvec2(0); //atlas size in tiles
+	GLuint atlas = 0; //RGBA8, mipmapped; alpha is coverage
+	GLuint atlas_depth = 0; //renderbuffer
+	GLuint framebuffer = 0;
+	GLuint frame_buffer = 0, object_buffer = 0; //uniform buffers used while rendering tiles
+	GLuint quad_buffer = 0, quad_vao = 0;
+
+	struct Impostor {
+		uint32_t slot = 0; //the tiles slot*Views ... slot*Views+Views-1
+		uint32_t ready = 0; //bitmask of views that are rendered
+		uint32_t requested = 0; //bitmask of views that are waiting for refresh()
+		uint32_t last_used = 0; //frame counter
+		//checked on use(), so a new drawable at the address of a forgotten one doesn't inherit its tiles:
+		GLuint vao = 0, start = 0, count = 0;
+	};
+	std::unordered_map< Scene::Drawable const *, Impostor > impostors;
+	std::vector< uint32_t > free_slots;
+	uint32_t frame = 1;
+
+	struct Request {
+		Scene::Drawable const *drawable;
+		glm::mat4 object_to_world;
+		uint32_t view;
+	};
+	std::vector< Request > requests;
+
+	struct Vertex {
+		glm::vec3 position;
+		glm::vec2 tex_coord;
+	};
+	static_assert(sizeof(Vertex) == 4*3 + 4*2, "Vertex is packed.");
+	std::vector< Vertex > quads;
+
+	//find the impostor for 'drawable', (re-)allocating a slot if needed; null if all slots were used this frame:
+	Impostor *find(Scene::Drawable const &drawable);
+	//capture direction for 'view' and the bounding sphere of a drawable:
+	glm::vec3 view_direction(uint32_t view) const;
+	static void bounding_sphere(Scene::Drawable const &drawable, glm::mat4 const &object_to_world, glm::vec3 *center, float *radius);
+	//lower-left corner of a tile, in texels:
+	glm::uvec2 tile_origin(uint32_t slot, uint32_t view) const;
+};
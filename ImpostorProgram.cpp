@@ -0,0 +1,32 @@
+#include "ImpostorProgram.hpp"
+
+#include "gl_compile_program.hpp"
+#include "gl_errors.hpp"
+#include "data_path.hpp"
+#include "Archive.hpp"
+
+Load< ImpostorProgram > impostor_program(LoadTagEarly, []() -> ImpostorProgram const * {
+	return new ImpostorProgram();
+});
+
+ImpostorProgram::ImpostorProgram() {
+	std::string vert_content = read_data_file(data_path("impostor.vert"));
+	std::string frag_content = read_data_file(data_path("impostor.frag"));
+
+	program = gl_compile_program(vert_content, frag_content);
+
+	//connect the "Frame" block to Scene's binding point:
+	Scene::bind_uniform_blocks(program);
+
+	//ATLAS always samples from GL_TEXTURE0:
+	glUseProgram(program);
+	glUniform1i(glGetUniformLocation(program, "ATLAS"), 0);
+	glUseProgram(0);
+
+	GL_ERRORS();
+}
+
+ImpostorProgram::~ImpostorProgram() {
+	glDeleteProgram(program);
+	program = 0;
+}
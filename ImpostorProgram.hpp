@@ -0,0 +1,24 @@
+#pragma once
+
+#include "GL.hpp"
+#include "Load.hpp"
+#include "Scene.hpp"
+
+//Shader program that draws impostor quads (see ImpostorCache.hpp) with the same fog as LitColorTextureProgram:
+struct ImpostorProgram {
+	ImpostorProgram();
+	~ImpostorProgram();
+
+	GLuint program = 0;
+
+	//Attributes (per-vertex variables) have fixed locations, matching ImpostorCache::Vertex:
+	// 0 - Position (world space)
+	// 1 - TexCoord (in the impostor atlas)
+
+	//Uniforms come from the "Frame" uniform block (Scene::FrameUniforms).
+
+	//Textures:
+	//TEXTURE0 - the impostor atlas
+};
+
+extern Load< ImpostorProgram > impostor_program;
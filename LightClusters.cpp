@@ -0,0 +1,181 @@
+#include "LightClusters.hpp"
+
+#include "gl_errors.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+
+LightClusters::LightClusters() {
+	glGenBuffers(3, buffers);
+	glGenTextures(3, textures);
+	GLenum const formats[3] = { GL_RG32UI, GL_R16UI, GL_RGBA32F };
+	for (uint32_t i = 0; i < 3; ++i) {
+		glBindBuffer(GL_TEXTURE_BUFFER, buffers[i]);
+		glBufferData(GL_TEXTURE_BUFFER, 16, NULL, GL_STREAM_DRAW);
+		glBindTexture(GL_TEXTURE_BUFFER, textures[i]);
+		//(the texture keeps referring to the buffer when upload() re-allocates its storage)
+		glTexBuffer(GL_TEXTURE_BUFFER, formats[i], buffers[i]);
+	}
+	glBindTexture(GL_TEXTURE_BUFFER, 0);
+	glBindBuffer(GL_TEXTURE_BUFFER, 0);
+	GL_ERRORS();
+}
+
+LightClusters::~LightClusters() {
+	glDeleteTextures(3, textures);
+	glDeleteBuffers(3, buffers);
+}
+
+glm::vec4 LightClusters::cluster_scale(glm::uvec2 size) const {
+	float slices_per_log2 = float(Slices) / std::log2(far_depth / near_depth);
+	return glm::vec4(
+		float(TilesX) / float(std::max(size.x, 1U)),
+		float(TilesY) / float(std::max(size.y, 1U)),
+		slices_per_log2,
+		-std::log2(near_depth) * slices_per_log2
+	);
+}
+
+void LightClusters::build(glm::mat4 const &world_to_clip, std::vector< Light > const &lights) {
+	auto before = std::chrono::high_resolution_clock::now();
+
+	stats = Stats();
+	clusters.assign(TilesX * TilesY * Slices, glm::uvec2(0));
+	light_data.clear();
+	boxes.clear();
+
+	//clip-space w (view depth) is linear in world position:
+	glm::vec4 w_row = glm::vec4(world_to_clip[0][3], world_to_clip[1][3], world_to_clip[2][3], world_to_clip[3][3]);
+	float w_per_unit = glm::length(glm::vec3(w_row));
+	glm::vec4 scale = cluster_scale(glm::uvec2(1));
+	auto slice = [&](float w) {
+		float s = std::floor(std::log2(std::max(w, near_depth)) * scale.z + scale.w);
+		return uint8_t(std::min(std::max(s, 0.0f), float(Slices - 1)));
+	};
+	auto tile = [](float ndc, uint32_t tiles) {
+		float t = std::floor((ndc * 0.5f + 0.5f) * tiles);
+		return uint8_t(std::min(std::max(t, 0.0f), float(tiles - 1)));
+	};
+
+	//find each light's box of cells, counting the lights per cell:
+	for (auto const &light : lights) {
+		if (light_data.size() / 2 >= MaxLights) break;
+		if (light.radius <= 0.0f) continue;
+
+		float w = glm::dot(w_row, glm::vec4(light.position, 1.0f));
+		float dw = light.radius * w_per_unit;
+		if (w + dw <= 0.0f || w - dw > far_depth) continue; //entirely behind the camera or past the last slice
+
+		Box box;
+		box.z0 = slice(w - dw);
+		box.z1 = slice(w + dw);
+
+		//screen rectangle of the corners of the light's bounding cube:
+		// (a cube corner can be nearer than the sphere by up to sqrt(3) times, so check each corner's w as well)
+		bool everywhere = (w - dw <= 1e-3f); //reaches around the camera, so could be anywhere on screen
+		glm::vec2 lo = glm::vec2( std::numeric_limits< float >::infinity());
+		glm::vec2 hi = glm::vec2(-std::numeric_limits< float >::infinity());
+		for (uint32_t i = 0; i < 8 && !everywhere; ++i) {
+			glm::vec4 corner = world_to_clip * glm::vec4(light.position + light.radius * glm::vec3(
+				(i & 1 ? 1.0f : -1.0f),
+				(i & 2 ? 1.0f : -1.0f),
+				(i & 4 ? 1.0f : -1.0f)
+			), 1.0f);
+			if (corner.w <= 1e-3f) {
+				everywhere = true;
+				break;
+			}
+			glm::vec2 ndc = glm::vec2(corner) / corner.w;
+			lo = glm::min(lo, ndc);
+			hi = glm::max(hi, ndc);
+		}
+		if (everywhere) {
+			box.x0 = 0; box.x1 = TilesX - 1;
+			box.y0 = 0; box.y1 = TilesY - 1;
+		} else {
+			if (hi.x < -1.0f || lo.x > 1.0f || hi.y < -1.0f || lo.y > 1.0f) continue; //off screen
+			box.x0 = tile(lo.x, TilesX); box.x1 = tile(hi.x, TilesX);
+			box.y0 = tile(lo.y, TilesY); box.y1 = tile(hi.y, TilesY);
+		}
+
+		box.light = uint16_t(light_data.size() / 2);
+		light_data.emplace_back(light.position, light.radius);
+		light_data.emplace_back(light.color, 0.0f);
+		boxes.emplace_back(box);
+
+		for (uint32_t z = box.z0; z <= box.z1; ++z) {
+			for (uint32_t y = box.y0; y <= box.y1; ++y) {
+				for (uint32_t x = box.x0; x <= box.x1; ++x) {
+					clusters[x + TilesX * (y + TilesY * z)].y += 1;
+				}
+			}
+		}
+	}
+
+	//lay out each cell's run of indices:
+	uint32_t offset = 0;
+	for (auto &cluster : clusters) {
+		stats.max_per_cluster = std::max(stats.max_per_cluster, cluster.y);
+		if (cluster.y > MaxPerCluster) {
+			stats.dropped += cluster.y - MaxPerCluster;
+			cluster.y = MaxPerCluster;
+		}
+		cluster.x = offset;
+		offset += cluster.y;
+	}
+	indices.resize(offset);
+
+	//fill the runs (in light order, so the lights dropped from full cells are the last ones):
+	filled.assign(clusters.size(), 0);
+	for (auto const &box : boxes) {
+		for (uint32_t z = box.z0; z <= box.z1; ++z) {
+			for (uint32_t y = box.y0; y <= box.y1; ++y) {
+				for (uint32_t x = box.x0; x <= box.x1; ++x) {
+					uint32_t c = x + TilesX * (y + TilesY * z);
+					if (filled[c] == clusters[c].y) continue;
+					indices[clusters[c].x + filled[c]] = box.light;
+					filled[c] += 1;
+				}
+			}
+		}
+	}
+
+	stats.lights = uint32_t(boxes.size());
+	stats.indices = offset;
+	stats.bin_ms = std::chrono::duration< float >(std::chrono::high_resolution_clock::now() - before).count() * 1000.0f;
+}
+
+void LightClusters::upload() {
+	//(texture buffers can't be empty, so always send at least one element)
+	auto send = [](GLuint buffer, void const *data, size_t bytes) {
+		static glm::vec4 const zero = glm::vec4(0.0f);
+		glBindBuffer(GL_TEXTURE_BUFFER, buffer);
+		if (bytes == 0) glBufferData(GL_TEXTURE_BUFFER, sizeof(zero), &zero, GL_STREAM_DRAW);
+		else glBufferData(GL_TEXTURE_BUFFER, bytes, data, GL_STREAM_DRAW);
+	};
+	send(buffers[0], clusters.data(), clusters.size() * sizeof(clusters[0]));
+	send(buffers[1], indices.data(), indices.size() * sizeof(indices[0]));
+	send(buffers[2], light_data.data(), light_data.size() * sizeof(light_data[0]));
+	glBindBuffer(GL_TEXTURE_BUFFER, 0);
+	GL_ERRORS();
+}
+
+void LightClusters::bind() const {
+	GLuint const units[3] = { ClustersUnit, IndicesUnit, LightsUnit };
+	for (uint32_t i = 0; i < 3; ++i) {
+		glActiveTexture(GL_TEXTURE0 + units[i]);
+		glBindTexture(GL_TEXTURE_BUFFER, textures[i]);
+	}
+	glActiveTexture(GL_TEXTURE0);
+}
+
+void LightClusters::unbind() const {
+	GLuint const units[3] = { ClustersUnit, IndicesUnit, LightsUnit };
+	for (uint32_t i = 0; i < 3; ++i) {
+		glActiveTexture(GL_TEXTURE0 + units[i]);
+		glBindTexture(GL_TEXTURE_BUFFER, 0);
+	}
+	glActiveTexture(GL_TEXTURE0);
+}
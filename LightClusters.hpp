@@ -0,0 +1,87 @@
+#pragma once
+
+/*
+ * LightClusters bins point lights into a grid of view-space cells ("froxels"),
+ *  so a fragment only loops over the lights that can reach its own cell.
+ *
+ * The grid is Tiles.x by Tiles.y screen tiles by Slices depth slices; slices
+ *  are spaced logarithmically in view depth (clip-space w) between 'near_depth' and 'far_depth'.
+ *
+ * Each frame:
+ *  - build() bins the lights on the CPU (conservatively, by each light's bounding box)
+ *  - upload() copies the result into three texture buffers:
+ *     CLUSTERS (RG32UI): per cell, the offset and count of its run in LIGHT_INDICES
+ *     LIGHT_INDICES (R16UI): light numbers, cell after cell
+ *     LIGHTS (RGBA32F): two texels per light -- position + radius, color
+ *  - bind() binds them to ClustersUnit, IndicesUnit, and LightsUnit
+ *
+ * See point_lights() in shader.frag for the lookup.
+ *
+ */
+
+#include "GL.hpp"
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <vector>
+
+struct LightClusters {
+	LightClusters();
+	~LightClusters();
+	LightClusters(LightClusters const &) = delete;
+	LightClusters &operator=(LightClusters const &) = delete;
+
+	enum : uint32_t {
+		TilesX = 16, TilesY = 9, Slices = 24,
+		MaxLights = 65535, //(light numbers are 16 bits)
+		MaxPerCluster = 32 //lights past this many in a cell are dropped from it
+	};
+	//texture units used by bind() (just past Scene::Drawable::Pipeline's textures):
+	enum : GLuint { ClustersUnit = 4, IndicesUnit = 5, LightsUnit = 6 };
+
+	//depth range covered by slices (lights nearer than 'near_depth' land in the first slice, lights beyond 'far_depth' are dropped):
+	float near_depth = 0.5f;
+	float far_depth = 200.0f;
+
+	struct Light {
+		glm::vec3 position; //in the space lighting is done in (Scene's "light space")
+		float radius; //no effect past this distance
+		glm::vec3 color;
+	};
+
+	//bin 'lights' for a camera with the given world-to-clip matrix (light space is assumed to be world space):
+	void build(glm::mat4 const &world_to_clip, std::vector< Light > const &lights);
+	void upload();
+	void bind() const;
+	void unbind() const;
+
+	//values for Scene::FrameUniforms:
+	// xy: tiles per pixel of a 'size' framebuffer, z: slices per log2(depth), w: slice of depth 1 (so slice = log2(depth) * z + w)
+	glm::vec4 cluster_scale(glm::uvec2 size) const;
+
+	//work done by the last build():
+	struct Stats {
+		uint32_t lights = 0; //lights that touched any cell
+		uint32_t indices = 0; //total (cell, light) pairs
+		uint32_t dropped = 0; //pairs dropped for MaxPerCluster
+		uint32_t max_per_cluster = 0;
+		float bin_ms = 0.0f; //CPU time of build()
+	} stats;
+
+	//---- internals ----
+	std::vector< glm::uvec2 > clusters; //(offset, count) in indices, per cell
+	std::vector< uint16_t > indices;
+	std::vector< glm::vec4 > light_data; //two per binned light
+
+	//cell range of a binned light:
+	struct Box {
+		uint16_t light;
+		uint8_t x0, x1, y0, y1, z0, z1; //inclusive
+	};
+	std::vector< Box > boxes;
+	std::vector< uint32_t > filled; //per cell, while filling indices
+
+	GLuint buffers[3] = { 0, 0, 0 }; //clusters, indices, light_data
+	GLuint textures[3] = { 0, 0, 0 };
+};
@@ -2,8 +2,8 @@
 
 #include "gl_compile_program.hpp"
 #include "gl_errors.hpp"
-#include <fstream>
 #include "data_path.hpp"
+#include "Archive.hpp"
 
 Scene::Drawable::Pipeline lit_color_texture_program_pipeline;
 
@@ -13,9 +13,7 @@ Load< LitColorTextureProgram > lit_color_texture_program(LoadTagEarly, []() -> L
 	//----- build the pipeline template -----
 	lit_color_texture_program_pipeline.program = ret->program;
 
-	lit_color_texture_program_pipeline.OBJECT_TO_CLIP_mat4 = ret->OBJECT_TO_CLIP_mat4;
-	lit_color_texture_program_pipeline.OBJECT_TO_LIGHT_mat4x3 = ret->OBJECT_TO_LIGHT_mat4x3;
-	lit_color_texture_program_pipeline.NORMAL_TO_LIGHT_mat3 = ret->NORMAL_TO_LIGHT_mat3;
+	lit_color_texture_program_pipeline.uniform_blocks = true;
 
 	//make a 1-pixel white texture to bind by default:
 	GLuint tex;
@@ -37,15 +35,40 @@ Load< LitColorTextureProgram > lit_color_texture_program(LoadTagEarly, []() -> L
 	return ret;
 });
 
-LitColorTextureProgram::LitColorTextureProgram() {
-	//Compile vertex and fragment shaders using the convenient 'gl_compile_program' helper function:
-  std::ifstream vertex_fs(data_path("shader.vert"));
-  std::string vert_content( 
-      (std::istreambuf_iterator<char>(vertex_fs)), std::istreambuf_iterator<char>() );
+Load< LitColorTextureProgram > lit_color_texture_program_instanced(LoadTagEarly, []() -> LitColorTextureProgram const * {
+	LitColorTextureProgram *ret = new LitColorTextureProgram(true);
+
+	lit_color_texture_program_pipeline.instanced.program = ret->program;
+
+	return ret;
+});
+
+Load< LitColorTextureProgram > lit_color_texture_program_depth(LoadTagEarly, []() -> LitColorTextureProgram const * {
+	LitColorTextureProgram *ret = new LitColorTextureProgram(false, true);
+	lit_color_texture_program_pipeline.depth_program = ret->program;
+	return ret;
+});
 
-  std::ifstream fragment_fs(data_path("shader.frag"));
-  std::string frag_content( 
-      (std::istreambuf_iterator<char>(fragment_fs)), std::istreambuf_iterator<char>() );
+Load< LitColorTextureProgram > lit_color_texture_program_instanced_depth(LoadTagEarly, []() -> LitColorTextureProgram const * {
+	LitColorTextureProgram *ret = new LitColorTextureProgram(true, true);
+	lit_color_texture_program_pipeline.instanced.depth_program = ret->program;
+	return ret;
+});
+
+LitColorTextureProgram::LitColorTextureProgram(bool instanced, bool depth_only) {
+	//Compile vertex and fragment shaders using the convenient 'gl_compile_program' helper function:
+  std::string vert_content = read_data_file(data_path("shader.vert"));
+  if (instanced) {
+    //#define must come after the #version line:
+    vert_content.insert(vert_content.find('\n') + 1, "#define INSTANCED\n");
+  }
+
+  std::string frag_content = read_data_file(data_path("shader.frag"));
+  if (depth_only) {
+    frag_content =
+      "#version 330\n"
+      "void main() { }\n";
+  }
 
 	program = gl_compile_program(
 		//vertex shader:
@@ -63,10 +86,10 @@ LitColorTextureProgram::LitColorTextureProgram() {
 	Color_vec4 = glGetAttribLocation(program, "Color");
 	TexCoord_vec2 = glGetAttribLocation(program, "TexCoord");
 
+	//hook up the uniform blocks to Scene's binding points:
+	Scene::bind_uniform_blocks(program);
+
 	//look up the locations of uniforms:
-	OBJECT_TO_CLIP_mat4 = glGetUniformLocation(program, "OBJECT_TO_CLIP");
-	OBJECT_TO_LIGHT_mat4x3 = glGetUniformLocation(program, "OBJECT_TO_LIGHT");
-	NORMAL_TO_LIGHT_mat3 = glGetUniformLocation(program, "NORMAL_TO_LIGHT");
 	GLuint TEX_sampler2D = glGetUniformLocation(program, "TEX");
 
 	//set TEX to always refer to texture binding zero:
@@ -74,6 +97,11 @@ LitColorTextureProgram::LitColorTextureProgram() {
 
 	glUniform1i(TEX_sampler2D, 0); //set TEX to sample from GL_TEXTURE0
 
+	//the light grid's texture buffers (see LightClusters::bind):
+	glUniform1i(glGetUniformLocation(program, "CLUSTERS"), LightClusters::ClustersUnit);
+	glUniform1i(glGetUniformLocation(program, "LIGHT_INDICES"), LightClusters::IndicesUnit);
+	glUniform1i(glGetUniformLocation(program, "LIGHTS"), LightClusters::LightsUnit);
+
 	glUseProgram(0); //unbind program -- glUniform* calls refer to ??? now
 }
 
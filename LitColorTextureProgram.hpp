@@ -6,7 +6,9 @@
 
 //Shader program that draws transformed, lit, textured vertices tinted with vertex colors:
 struct LitColorTextureProgram {
-	LitColorTextureProgram();
+	//'instanced' builds the variant that reads per-object data from Scene::Instance attributes;
+	//'depth_only' builds a variant with the same vertex shader that writes no color (for Scene::depth_prepass):
+	LitColorTextureProgram(bool instanced = false, bool depth_only = false);
 	~LitColorTextureProgram();
 
 	GLuint program = 0;
@@ -17,18 +19,20 @@ struct LitColorTextureProgram {
 	GLuint Color_vec4 = -1U;
 	GLuint TexCoord_vec2 = -1U;
 
-	//Uniform (per-invocation variable) locations:
-	GLuint OBJECT_TO_CLIP_mat4 = -1U;
-	GLuint OBJECT_TO_LIGHT_mat4x3 = -1U;
-	GLuint NORMAL_TO_LIGHT_mat3 = -1U;
-  GLuint CUSTOM_COL = -1U;
+	//Uniforms come from the "Frame" and "Object" uniform blocks (Scene::FrameUniforms / Scene::ObjectUniforms);
+	// the instanced variant takes per-object data from attributes and only uses "Frame".
 	
 	//Textures:
 	//TEXTURE0 - texture that is accessed by TexCoord
 };
 
 extern Load< LitColorTextureProgram > lit_color_texture_program;
+extern Load< LitColorTextureProgram > lit_color_texture_program_instanced;
+extern Load< LitColorTextureProgram > lit_color_texture_program_depth;
+extern Load< LitColorTextureProgram > lit_color_texture_program_instanced_depth;
 
 //For convenient scene-graph setup, copy this object:
 // NOTE: by default, has texture bound to 1-pixel white texture -- so it's okay to use with vertex-color-only meshes.
+// NOTE: pipeline.instanced is filled in with lit_color_texture_program_instanced, except for the vao.
+// NOTE: depth programs are filled in too; they use the same attribute locations, so can share vaos.
 extern Scene::Drawable::Pipeline lit_color_texture_program_pipeline;
@@ -1,32 +1,489 @@
 #include "Load.hpp"
 
-#include <array>
-#include <list>
+#include <algorithm>
 #include <cassert>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <time.h>
+#endif
 
 namespace {
-	std::array< std::list< std::function< void() > >, MaxLoadTag > &get_load_lists() {
-		static std::array< std::list< std::function< void() > >, MaxLoadTag > load_lists;
-		return load_lists;
+	struct LoadJob {
+		LoadTag tag = LoadTagDefault;
+		void const *key = nullptr; //what LoadAfter lists call this load (may be null)
+		LoadSite site;
+		bool has_after = false; //false: wait for every load with an earlier tag
+		std::vector< void const * > after;
+		std::function< void() > fn; //runs on the context thread
+		std::function< std::function< void() >() > prepare; //..or runs on a worker, returning what runs on the context thread
+
+		//filled in by call_load_functions():
+		uint32_t waiting = 0; //loads this one is waiting for
+		std::vector< uint32_t > dependents; //loads waiting for this one
+	};
+
+	std::vector< LoadJob > &get_load_jobs() {
+		static std::vector< LoadJob > load_jobs;
+		return load_jobs;
+	}
+
+	//the thread that called call_load_functions() (lazy loads finish there too):
+	std::thread::id &get_context_thread() {
+		static std::thread::id context_thread;
+		return context_thread;
 	}
+
+	//---- startup profile (see LOAD_PROFILE in Load.hpp) ----
+
+	//one call of a load's fn, prepare, or finish:
+	struct LoadEvent {
+		uint32_t job = 0;
+		char const *phase = ""; //"load", "prepare", or "finish"
+		uint32_t thread = 0; //0 is the context thread, workers are 1, 2, ...
+		double begin_us = 0.0; //since call_load_functions() started
+		double wall_us = 0.0;
+		double cpu_us = 0.0;
+		LoadCounters counters;
+	};
+
+	//value of LOAD_PROFILE (empty if not set):
+	std::string load_profile_path() {
+		#if defined(_WIN32)
+		char *value = nullptr;
+		size_t length = 0;
+		if (_dupenv_s(&value, &length, "LOAD_PROFILE") != 0 || value == nullptr) return "";
+		std::string ret = value;
+		free(value);
+		return ret;
+		#else
+		char const *value = std::getenv("LOAD_PROFILE");
+		return (value ? value : "");
+		#endif
+	}
+
+	//CPU time used by the calling thread so far:
+	double thread_cpu_us() {
+		#if defined(_WIN32)
+		FILETIME creation, exit, kernel, user;
+		if (!GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user)) return 0.0;
+		auto to_100ns = [](FILETIME const &t) {
+			return (uint64_t(t.dwHighDateTime) << 32) | uint64_t(t.dwLowDateTime);
+		};
+		return double(to_100ns(kernel) + to_100ns(user)) / 10.0;
+		#else
+		struct timespec ts;
+		if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0) return 0.0;
+		return double(ts.tv_sec) * 1.0e6 + double(ts.tv_nsec) / 1.0e3;
+		#endif
+	}
+
+	//"RollLevel.cpp:30" for a load declared at line 30 of .../RollLevel.cpp:
+	std::string site_name(LoadSite const &site) {
+		std::string file = site.file;
+		size_t slash = file.find_last_of("/\\");
+		if (slash != std::string::npos) file = file.substr(slash + 1);
+		return file + ":" + std::to_string(site.line);
+	}
+
+	std::string json_string(std::string const &str) {
+		std::string ret = "\"";
+		for (char c : str) {
+			if (c == '"' || c == '\\') ret += '\\';
+			ret += c;
+		}
+		return ret + "\"";
+	}
+
+	void report_load_profile(std::vector< LoadJob > const &jobs, std::vector< LoadEvent > const &events,
+		double total_us, uint32_t worker_count, std::string const &trace_path) {
+
+		struct Total {
+			double wall_us = 0.0;
+			double cpu_us = 0.0;
+			LoadCounters counters;
+			std::string phases;
+		};
+		std::vector< Total > totals(jobs.size());
+		for (auto const &event : events) {
+			Total &total = totals[event.job];
+			total.wall_us += event.wall_us;
+			total.cpu_us += event.cpu_us;
+			total.counters.bytes_read += event.counters.bytes_read;
+			total.counters.bytes_uploaded += event.counters.bytes_uploaded;
+			if (std::string(event.phase) != "load") {
+				std::ostringstream phase;
+				phase << (total.phases.empty() ? "" : " + ") << event.phase << " " << std::fixed << std::setprecision(1) << event.wall_us / 1000.0 << "ms"
+					<< (event.thread == 0 ? "" : " (worker)");
+				total.phases += phase.str();
+			}
+		}
+
+		std::vector< uint32_t > order(jobs.size());
+		for (uint32_t i = 0; i < order.size(); ++i) order[i] = i;
+		std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+			return totals[a].wall_us > totals[b].wall_us;
+		});
+
+		std::cout << "Loaded " << jobs.size() << " loads in " << std::fixed << std::setprecision(1) << total_us / 1000.0 << "ms"
+			<< " (" << worker_count << " worker threads), slowest first:\n";
+		std::cout << "   wall ms    cpu ms   read kB  upload kB  load\n";
+		for (uint32_t j : order) {
+			Total const &total = totals[j];
+			std::cout << std::setw(10) << total.wall_us / 1000.0
+				<< std::setw(10) << total.cpu_us / 1000.0
+				<< std::setw(10) << total.counters.bytes_read / 1024
+				<< std::setw(11) << total.counters.bytes_uploaded / 1024
+				<< "  " << site_name(jobs[j].site);
+			if (!total.phases.empty()) std::cout << " [" << total.phases << "]";
+			std::cout << "\n";
+		}
+		std::cout.unsetf(std::ios::floatfield);
+		std::cout << std::setprecision(6);
+
+		//Chrome trace event format ("X" complete events, one track per thread):
+		std::ofstream trace(trace_path, std::ios::binary);
+		if (!trace) {
+			std::cerr << "WARNING: failed to open '" << trace_path << "' to write the load trace." << std::endl;
+			return;
+		}
+		trace << "{\"traceEvents\":[\n";
+		for (uint32_t t = 0; t <= worker_count; ++t) {
+			trace << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << t
+				<< ",\"args\":{\"name\":" << json_string(t == 0 ? "context" : "worker " + std::to_string(t)) << "}},\n";
+		}
+		for (auto const &event : events) {
+			trace << "{\"name\":" << json_string(site_name(jobs[event.job].site)) << ",\"cat\":\"" << event.phase << "\",\"ph\":\"X\""
+				<< ",\"pid\":0,\"tid\":" << event.thread
+				<< ",\"ts\":" << std::fixed << std::setprecision(1) << event.begin_us << ",\"dur\":" << event.wall_us
+				<< ",\"args\":{\"cpu_us\":" << event.cpu_us
+				<< ",\"bytes_read\":" << event.counters.bytes_read
+				<< ",\"bytes_uploaded\":" << event.counters.bytes_uploaded << "}},\n";
+		}
+		trace << "{\"name\":\"call_load_functions\",\"ph\":\"X\",\"pid\":0,\"tid\":0,\"ts\":0,\"dur\":" << total_us << "}\n";
+		trace << "]}\n";
+		std::cout << "Wrote load trace to '" << trace_path << "'." << std::endl;
+	}
+}
+
+void add_load_function(LoadTag tag, std::function< void() > const &fn, void const *key, LoadSite const &site) {
+	assert(tag < MaxLoadTag);
+	LoadJob job;
+	job.tag = tag;
+	job.key = key;
+	job.site = site;
+	job.fn = fn;
+	get_load_jobs().emplace_back(job);
+}
+
+void add_load_function(LoadTag tag, void const *key, LoadAfter const &after, std::function< void() > const &fn, LoadSite const &site) {
+	assert(tag < MaxLoadTag);
+	LoadJob job;
+	job.tag = tag;
+	job.key = key;
+	job.site = site;
+	job.has_after = true;
+	job.after = after.loads;
+	job.fn = fn;
+	get_load_jobs().emplace_back(job);
 }
 
-void add_load_function(LoadTag tag, std::function< void() > const &fn) {
-	auto &load_lists = get_load_lists();
-	assert(tag < load_lists.size());
-	load_lists[tag].emplace_back(fn);
+void add_background_load_function(LoadTag tag, void const *key, LoadAfter const &after, std::function< std::function< void() >() > const &prepare, LoadSite const &site) {
+	assert(tag < MaxLoadTag);
+	LoadJob job;
+	job.tag = tag;
+	job.key = key;
+	job.site = site;
+	job.has_after = true;
+	job.after = after.loads;
+	job.prepare = prepare;
+	get_load_jobs().emplace_back(job);
 }
 
 void call_load_functions() {
 	static bool has_been_called = false;
 	assert(!has_been_called && "call_load_functions should only be called *once*");
 	has_been_called = true;
+	get_context_thread() = std::this_thread::get_id();
+
+	std::vector< LoadJob > &jobs = get_load_jobs();
+
+	//---- resolve dependencies ----
+	std::unordered_map< void const *, uint32_t > by_key;
+	for (uint32_t i = 0; i < jobs.size(); ++i) {
+		if (jobs[i].key) by_key.insert(std::make_pair(jobs[i].key, i));
+	}
+	uint32_t background_jobs = 0;
+	for (uint32_t j = 0; j < jobs.size(); ++j) {
+		LoadJob &job = jobs[j];
+		if (job.prepare) background_jobs += 1;
+		std::vector< uint32_t > deps;
+		if (job.has_after) {
+			for (void const *key : job.after) {
+				auto f = by_key.find(key);
+				if (f == by_key.end()) {
+					throw std::runtime_error("A load waits (LoadAfter) for something that isn't a Load<>.");
+				}
+				deps.emplace_back(f->second);
+			}
+		} else {
+			for (uint32_t i = 0; i < jobs.size(); ++i) {
+				if (jobs[i].tag < job.tag) deps.emplace_back(i);
+			}
+		}
+		std::sort(deps.begin(), deps.end());
+		deps.erase(std::unique(deps.begin(), deps.end()), deps.end());
+		for (uint32_t d : deps) {
+			jobs[d].dependents.emplace_back(j);
+			job.waiting += 1;
+		}
+	}
 
-	auto &load_lists = get_load_lists();
-	for (auto &fn_list : load_lists) {
-		while (!fn_list.empty()) {
-			(*fn_list.begin())(); //call first function in the list
-			fn_list.pop_front(); //remove from list
+	//---- run ----
+	//Context-thread loads run here in the order they were added; background loads' 'prepare' runs on
+	// the worker pool (or here, when there's nothing else to do), and the function it returns runs here.
+
+	std::mutex mutex;
+	std::condition_variable cv;
+	std::set< uint32_t > context_ready; //(std::set so lowest index -- i.e., first added -- runs first)
+	std::deque< uint32_t > background_ready;
+	std::deque< std::pair< uint32_t, std::function< void() > > > finish_ready;
+	uint32_t preparing = 0; //background loads running on workers
+	uint32_t done = 0;
+	bool stop = false;
+	std::exception_ptr error;
+
+	//profiling wraps every call in 'run':
+	std::string const profile_path = load_profile_path();
+	bool const profiling = !profile_path.empty();
+	auto const start = std::chrono::steady_clock::now();
+	std::mutex events_mutex;
+	std::vector< LoadEvent > events;
+	auto run = [&](uint32_t j, char const *phase, uint32_t thread, std::function< void() > const &fn) {
+		if (!profiling) {
+			fn();
+			return;
+		}
+		LoadEvent event;
+		event.job = j;
+		event.phase = phase;
+		event.thread = thread;
+		current_load_counters() = &event.counters;
+		double cpu_before = thread_cpu_us();
+		auto before = std::chrono::steady_clock::now();
+		try {
+			fn();
+		} catch (...) {
+			current_load_counters() = nullptr;
+			throw;
+		}
+		auto after = std::chrono::steady_clock::now();
+		event.cpu_us = thread_cpu_us() - cpu_before;
+		current_load_counters() = nullptr;
+		event.begin_us = std::chrono::duration< double, std::micro >(before - start).count();
+		event.wall_us = std::chrono::duration< double, std::micro >(after - before).count();
+		std::lock_guard< std::mutex > lock(events_mutex);
+		events.emplace_back(event);
+	};
+
+	//(call with mutex held)
+	auto make_ready = [&](uint32_t j) {
+		if (jobs[j].prepare) {
+			background_ready.emplace_back(j);
+			cv.notify_all();
+		} else {
+			context_ready.insert(j);
+		}
+	};
+	auto finished = [&](uint32_t j) {
+		done += 1;
+		for (uint32_t d : jobs[j].dependents) {
+			assert(jobs[d].waiting > 0);
+			jobs[d].waiting -= 1;
+			if (jobs[d].waiting == 0) make_ready(d);
+		}
+	};
+
+	{
+		std::unique_lock< std::mutex > lock(mutex);
+		for (uint32_t j = 0; j < jobs.size(); ++j) {
+			if (jobs[j].waiting == 0) make_ready(j);
 		}
 	}
+
+	//the context thread helps with background work, so one worker per remaining core:
+	uint32_t cores = std::max(1U, std::thread::hardware_concurrency());
+	uint32_t worker_count = std::min(cores - 1, background_jobs);
+	std::vector< std::thread > workers;
+	for (uint32_t w = 0; w < worker_count; ++w) {
+		workers.emplace_back([&,w](){
+			std::unique_lock< std::mutex > lock(mutex);
+			while (true) {
+				cv.wait(lock, [&](){ return stop || !background_ready.empty(); });
+				if (stop) break;
+				uint32_t j = background_ready.front();
+				background_ready.pop_front();
+				preparing += 1;
+
+				lock.unlock();
+				std::function< void() > finish;
+				std::exception_ptr failed;
+				try {
+					run(j, "prepare", w + 1, [&](){ finish = jobs[j].prepare(); });
+				} catch (...) {
+					failed = std::current_exception();
+				}
+				lock.lock();
+
+				preparing -= 1;
+				if (failed) {
+					if (!error) error = failed;
+				} else {
+					finish_ready.emplace_back(j, finish);
+				}
+				cv.notify_all();
+			}
+		});
+	}
+
+	try {
+		std::unique_lock< std::mutex > lock(mutex);
+		while (done < jobs.size() && !error) {
+			if (!finish_ready.empty()) {
+				uint32_t j = finish_ready.front().first;
+				std::function< void() > finish = finish_ready.front().second;
+				finish_ready.pop_front();
+				lock.unlock();
+				run(j, "finish", 0, finish);
+				lock.lock();
+				finished(j);
+			} else if (!context_ready.empty()) {
+				uint32_t j = *context_ready.begin();
+				context_ready.erase(context_ready.begin());
+				lock.unlock();
+				run(j, "load", 0, jobs[j].fn);
+				lock.lock();
+				finished(j);
+			} else if (!background_ready.empty()) {
+				uint32_t j = background_ready.front();
+				background_ready.pop_front();
+				lock.unlock();
+				std::function< void() > finish;
+				run(j, "prepare", 0, [&](){ finish = jobs[j].prepare(); });
+				run(j, "finish", 0, finish);
+				lock.lock();
+				finished(j);
+			} else if (preparing == 0) {
+				throw std::runtime_error("Loads wait (LoadAfter) for each other in a cycle.");
+			} else {
+				cv.wait(lock);
+			}
+		}
+	} catch (...) {
+		std::unique_lock< std::mutex > lock(mutex);
+		if (!error) error = std::current_exception();
+	}
+
+	{
+		std::unique_lock< std::mutex > lock(mutex);
+		stop = true;
+		cv.notify_all();
+	}
+	for (auto &worker : workers) {
+		worker.join();
+	}
+
+	if (error) std::rethrow_exception(error);
+
+	if (profiling) {
+		double total_us = std::chrono::duration< double, std::micro >(std::chrono::steady_clock::now() - start).count();
+		report_load_profile(jobs, events, total_us, worker_count, profile_path);
+	}
+
+	jobs.clear();
+}
+
+LazyLoad::LazyLoad(std::function< std::function< void() >() > const &prepare_, std::function< void() > const &fn_, LoadSite const &site_)
+	: prepare(prepare_), fn(fn_), site(site_) {
+	assert((prepare || fn) && "lazy loads need something to do");
+}
+
+void LazyLoad::prefetch() {
+	if (!prepare || prefetched.valid() || resolving) return;
+	std::function< std::function< void() >() > prepare_ = prepare;
+	LoadCounters *counters_ = &counters;
+	prefetched = std::async(std::launch::async, [prepare_,counters_](){
+		current_load_counters() = counters_; //(only read after resolve() waits for this)
+		std::function< void() > finish;
+		try {
+			finish = prepare_();
+		} catch (...) {
+			current_load_counters() = nullptr;
+			throw;
+		}
+		current_load_counters() = nullptr;
+		return finish;
+	});
+}
+
+void LazyLoad::resolve() {
+	assert((get_context_thread() == std::thread::id() || get_context_thread() == std::this_thread::get_id())
+		&& "lazy loads are used from the OpenGL context thread");
+	if (resolving) {
+		throw std::runtime_error("Lazy load at " + site_name(site) + " was used while it was loading.");
+	}
+	resolving = true;
+
+	bool profiling = !load_profile_path().empty();
+	LoadCounters *outer_counters = current_load_counters();
+	if (profiling) current_load_counters() = &counters;
+
+	auto before = std::chrono::steady_clock::now();
+	bool was_prefetched = prefetched.valid();
+	std::chrono::steady_clock::time_point ready;
+	try {
+		std::function< void() > finish = fn;
+		if (was_prefetched) {
+			finish = prefetched.get(); //(rethrows what prepare threw)
+		} else if (prepare) {
+			finish = prepare();
+		}
+		ready = std::chrono::steady_clock::now();
+		finish();
+	} catch (...) {
+		//leave the load usable (a later resolve() runs prepare again) and stop counting into it:
+		current_load_counters() = outer_counters;
+		resolving = false;
+		throw;
+	}
+	auto after = std::chrono::steady_clock::now();
+
+	if (profiling) {
+		current_load_counters() = outer_counters;
+		std::cout << "Lazily loaded " << site_name(site) << " in " << std::chrono::duration< double, std::milli >(after - before).count() << "ms"
+			<< (was_prefetched ? " (prefetched; waited " : " (not prefetched; prepare ")
+			<< std::chrono::duration< double, std::milli >(ready - before).count() << "ms"
+			<< ", read " << counters.bytes_read / 1024 << " kB, uploaded " << counters.bytes_uploaded / 1024 << " kB)." << std::endl;
+	}
+
+	//done with the functions (and anything they captured):
+	prepare = nullptr;
+	fn = nullptr;
 }
@@ -20,10 +20,37 @@
  * These functions are grouped by 'tags', which allow some sequencing of calls.
  * (particularly, this is useful for loading large data blobs [e.g. Meshes] before looking up individual elements within them.)
  *
+ * Loads can also name exactly what they wait for, and split off work that doesn't need OpenGL so it runs on a worker thread:
+ *
+ * Load< MeshBuffer > level_meshes(LoadTagDefault, LoadAfter{ &some_program }, LoadInBackground(), []() -> LoadFinish< MeshBuffer > {
+ *     MeshBuffer *ret = new MeshBuffer(data_path("level.pnct"), MeshBuffer::Deferred); //worker thread: read + parse
+ *     return [ret]() -> MeshBuffer const * { ret->upload(); return ret; }; //OpenGL context thread: upload
+ * });
+ *
+ * A load with a LoadAfter list waits only for the loads in it (not for earlier tags); its tag still
+ *  says which tag-ordered loads may assume it is done.
+ * Plain tag-ordered loads run on the OpenGL context thread, in order, after every load with an earlier tag.
+ *
+ * Loads that aren't needed right away can be lazy: call_load_functions() skips them, and they load the first time
+ *  they are used instead (on the OpenGL context thread). prefetch() starts a lazy load's worker part early:
+ *
+ * Load< Sound::Sample > fanfare(LoadLazily(), LoadInBackground(), []() -> LoadFinish< Sound::Sample > { ... });
+ * fanfare.prefetch(); //e.g., when the mode that plays it is created
+ * Sound::play(*fanfare); //waits for the prefetch (if it's still running) and finishes the load
+ *
+ * Startup profiling: set the environment variable LOAD_PROFILE to a file name (e.g., LOAD_PROFILE=load-trace.json)
+ *  and call_load_functions() prints each load's wall time, CPU time, bytes read, and bytes uploaded to OpenGL
+ *  (slowest first), and writes a trace of them to that file (open it in chrome://tracing or ui.perfetto.dev).
+ *
  */
 
+#include <cstdint>
 #include <functional>
+#include <future>
+#include <initializer_list>
+#include <memory>
 #include <stdexcept>
+#include <vector>
 
 enum LoadTag : uint32_t {
 	LoadTagEarly,
@@ -32,13 +59,82 @@ enum LoadTag : uint32_t {
 	MaxLoadTag //<-- just used to track # of load tags
 };
 
+//Loads that must be finished before a load starts, named by address (e.g., LoadAfter{ &lit_color_texture_program }):
+// (addresses are fine to take at global scope, whichever order the Load<>s are constructed in)
+struct LoadAfter {
+	LoadAfter() = default;
+	LoadAfter(std::initializer_list< void const * > loads_) : loads(loads_) { }
+	std::vector< void const * > loads;
+};
+
+//Marks a load as having a part that runs on a worker thread (see above):
+struct LoadInBackground { };
+
+//What a background load's worker part returns: the rest of the load, run on the OpenGL context thread:
+template< typename T >
+using LoadFinish = std::function< T const *() >;
+
+//Where a load is declared (for the startup profile); the default is wherever the Load<> is constructed:
+struct LoadSite {
+	#if defined(__GNUC__) || defined(__clang__) || (defined(_MSC_VER) && _MSC_VER >= 1927)
+	LoadSite(char const *file_ = __builtin_FILE(), uint32_t line_ = __builtin_LINE()) : file(file_), line(line_) { }
+	#else
+	LoadSite(char const *file_ = "(unknown)", uint32_t line_ = 0) : file(file_), line(line_) { }
+	#endif
+	char const *file;
+	uint32_t line;
+};
+
 //Add a function to an internal list of loading functions:
 // (only call *before* "call_load_functions()")
-void add_load_function(LoadTag tag, std::function< void() > const &fn);
+//'key' is what LoadAfter lists use to refer to this load (optional):
+void add_load_function(LoadTag tag, std::function< void() > const &fn, void const *key = nullptr, LoadSite const &site = LoadSite());
+//..one that waits only for 'after' (runs on the OpenGL context thread):
+void add_load_function(LoadTag tag, void const *key, LoadAfter const &after, std::function< void() > const &fn, LoadSite const &site = LoadSite());
+//..one whose 'prepare' runs on a worker thread (no OpenGL!) and returns the part to run on the OpenGL context thread:
+void add_background_load_function(LoadTag tag, void const *key, LoadAfter const &after, std::function< std::function< void() >() > const &prepare, LoadSite const &site = LoadSite());
+
+//Loaders report the bytes they read from disk and upload to OpenGL, which the startup profile attributes to the running load:
+struct LoadCounters {
+	uint64_t bytes_read = 0;
+	uint64_t bytes_uploaded = 0;
+};
+//(counters of the load running on this thread; null unless profiling)
+inline LoadCounters *&current_load_counters() {
+	static thread_local LoadCounters *counters = nullptr;
+	return counters;
+}
+inline void count_load_bytes_read(uint64_t bytes) {
+	if (LoadCounters *counters = current_load_counters()) counters->bytes_read += bytes;
+}
+inline void count_load_bytes_uploaded(uint64_t bytes) {
+	if (LoadCounters *counters = current_load_counters()) counters->bytes_uploaded += bytes;
+}
+
+//Marks a load as lazy (see above):
+struct LoadLazily { };
+
+//What a Load<> holds to load lazily:
+struct LazyLoad {
+	//'prepare' (may be empty) runs first, on a background thread if prefetch()'d; the function it returns, or 'fn', runs on the OpenGL context thread:
+	LazyLoad(std::function< std::function< void() >() > const &prepare, std::function< void() > const &fn, LoadSite const &site);
+
+	//start 'prepare' on a background thread (does nothing if it has started, or there is no 'prepare'):
+	void prefetch();
+	//run the rest of the load, waiting for prefetch() if needed; rethrows anything 'prepare' threw (call on the OpenGL context thread):
+	void resolve();
+
+	std::function< std::function< void() >() > prepare;
+	std::function< void() > fn;
+	LoadSite site;
+	std::future< std::function< void() > > prefetched; //valid from prefetch() until resolve()
+	LoadCounters counters; //bytes read + uploaded (for the profile; see LOAD_PROFILE)
+	bool resolving = false;
+};
 
 //Call all loading functions:
 // (loading functions may throw exceptions if they fail.)
-// (only call *once*)
+// (only call *once*, from the thread with the OpenGL context)
 void call_load_functions();
 
 
@@ -49,22 +145,80 @@ T const *new_T() { return new T; }
 template< typename T >
 struct Load {
 	//Constructing a Load< T > adds the passed function to the list of functions to call:
-	Load(LoadTag tag, const std::function< T const *() > &load_fn = new_T< T >) : value(nullptr) {
+	Load(LoadTag tag, const std::function< T const *() > &load_fn = new_T< T >, LoadSite const &site = LoadSite()) : value(nullptr) {
 		add_load_function(tag, [this,load_fn](){
 			this->value = load_fn();
 			if (!(this->value)) {
 				throw std::runtime_error("Loading failed.");
 			}
-		});
+		}, this, site);
+	}
+
+	//..or to call once the loads in 'after' are done:
+	Load(LoadTag tag, LoadAfter const &after, const std::function< T const *() > &load_fn, LoadSite const &site = LoadSite()) : value(nullptr) {
+		add_load_function(tag, this, after, [this,load_fn](){
+			this->value = load_fn();
+			if (!(this->value)) {
+				throw std::runtime_error("Loading failed.");
+			}
+		}, site);
+	}
+
+	//..or to call on a worker thread once the loads in 'after' are done, finishing on the OpenGL context thread:
+	Load(LoadTag tag, LoadAfter const &after, LoadInBackground, const std::function< LoadFinish< T >() > &prepare_fn, LoadSite const &site = LoadSite()) : value(nullptr) {
+		add_background_load_function(tag, this, after, [this,prepare_fn]() -> std::function< void() > {
+			LoadFinish< T > finish_fn = prepare_fn();
+			return [this,finish_fn](){
+				this->value = (finish_fn ? finish_fn() : nullptr);
+				if (!(this->value)) {
+					throw std::runtime_error("Loading failed.");
+				}
+			};
+		}, site);
+	}
+
+	//..or lazily, with a part that prefetch() can start on a background thread:
+	Load(LoadLazily, LoadInBackground, const std::function< LoadFinish< T >() > &prepare_fn, LoadSite const &site = LoadSite()) : value(nullptr) {
+		lazy.reset(new LazyLoad([this,prepare_fn]() -> std::function< void() > {
+			LoadFinish< T > finish_fn = prepare_fn();
+			return [this,finish_fn](){
+				this->value = (finish_fn ? finish_fn() : nullptr);
+				if (!(this->value)) {
+					throw std::runtime_error("Loading failed.");
+				}
+			};
+		}, nullptr, site));
+	}
+
+	//..or lazily, all on the OpenGL context thread:
+	Load(LoadLazily, const std::function< T const *() > &load_fn, LoadSite const &site = LoadSite()) : value(nullptr) {
+		lazy.reset(new LazyLoad(nullptr, [this,load_fn](){
+			this->value = load_fn();
+			if (!(this->value)) {
+				throw std::runtime_error("Loading failed.");
+			}
+		}, site));
+	}
+
+	//Hint that a lazy load will be used soon (does nothing for other loads):
+	void prefetch() {
+		if (!value && lazy) lazy->prefetch();
 	}
 
 	//Make a "Load< T >" behave like a "T const *":
-	explicit operator bool() { return value != nullptr; }
-	operator T const *() { return value; }
-	T const &operator*() { return *value; }
-	T const *operator->() { return value; }
+	// (using a lazy load loads it)
+	explicit operator bool() { return get() != nullptr; }
+	operator T const *() { return get(); }
+	T const &operator*() { return *get(); }
+	T const *operator->() { return get(); }
+
+	T const *get() {
+		if (!value && lazy) lazy->resolve();
+		return value;
+	}
 
 	T const *value;
+	std::unique_ptr< LazyLoad > lazy; //(null for loads run by call_load_functions())
 };
 
 
@@ -73,8 +227,11 @@ struct Load {
 template< >
 struct Load< void > {
 	//Constructing a Load< T > adds the passed function to the list of functions to call:
-	Load( LoadTag tag, const std::function< void() > &load_fn) {
-		add_load_function(tag, load_fn);
+	Load( LoadTag tag, const std::function< void() > &load_fn, LoadSite const &site = LoadSite()) {
+		add_load_function(tag, load_fn, this, site);
+	}
+	Load( LoadTag tag, LoadAfter const &after, const std::function< void() > &load_fn, LoadSite const &site = LoadSite()) {
+		add_load_function(tag, this, after, load_fn, site);
 	}
 };
 
@@ -0,0 +1,26 @@
+#pragma once
+
+/*
+ * MappedFile maps a whole file into memory, read-only, for as long as it exists.
+ * (ChunkFile and Archive read through these.)
+ *
+ */
+
+#include <cstddef>
+#include <string>
+
+struct MappedFile {
+	//map 'filename'; throws if it can't be opened or mapped:
+	explicit MappedFile(std::string const &filename);
+	~MappedFile();
+	MappedFile(MappedFile const &) = delete;
+	MappedFile &operator=(MappedFile const &) = delete;
+
+	char const *data = nullptr; //the mapping (null for empty files)
+	size_t size = 0;
+	std::string filename;
+
+	//---- internals ----
+	void *file_handle = nullptr; //(Windows only)
+	void *mapping_handle = nullptr; //(Windows only)
+};
@@ -10,11 +10,12 @@
 #include "Sound.hpp"
 
 //for loading:
+// (the sounds are lazy, so games that never show a menu don't load them)
 #include "Load.hpp"
 
 #include <random>
 
-Load< Sound::Sample > sound_click(LoadTagDefault, []() -> Sound::Sample *{
+Load< Sound::Sample > sound_click(LoadLazily(), LoadInBackground(), []() -> LoadFinish< Sound::Sample > {
 	std::vector< float > data(size_t(48000 * 0.2f), 0.0f);
 	for (uint32_t i = 0; i < data.size(); ++i) {
 		float t = i / float(48000);
@@ -23,10 +24,11 @@ Load< Sound::Sample > sound_click(LoadTagDefault, []() -> Sound::Sample *{
 		//quadratic falloff:
 		data[i] *= 0.3f * std::pow(std::max(0.0f, (1.0f - t / 0.2f)), 2.0f);
 	}
-	return new Sound::Sample(data);
+	Sound::Sample *ret = new Sound::Sample(data);
+	return [ret]() { return ret; }; //(nothing to do on the OpenGL thread)
 });
 
-Load< Sound::Sample > sound_clonk(LoadTagDefault, []() -> Sound::Sample *{
+Load< Sound::Sample > sound_clonk(LoadLazily(), LoadInBackground(), []() -> LoadFinish< Sound::Sample > {
 	std::vector< float > data(size_t(48000 * 0.2f), 0.0f);
 	for (uint32_t i = 0; i < data.size(); ++i) {
 		float t = i / float(48000);
@@ -35,7 +37,8 @@ Load< Sound::Sample > sound_clonk(LoadTagDefault, []() -> Sound::Sample *{
 		//quadratic falloff:
 		data[i] *= 0.3f * std::pow(std::max(0.0f, (1.0f - t / 0.2f)), 2.0f);
 	}
-	return new Sound::Sample(data);
+	Sound::Sample *ret = new Sound::Sample(data);
+	return [ret]() { return ret; }; //(nothing to do on the OpenGL thread)
 });
 
 
@@ -48,6 +51,10 @@ MenuMode::MenuMode(std::vector< Item > const &items_) : items(items_) {
 			break;
 		}
 	}
+
+	//the first key press will want these:
+	sound_click.prefetch();
+	sound_clonk.prefetch();
 }
 
 MenuMode::~MenuMode() {
@@ -1,40 +1,58 @@
 #include "Mesh.hpp"
-#include "read_write_chunk.hpp"
+#include "ChunkFile.hpp"
+#include "Load.hpp"
+#include "mesh_vertex.hpp"
 
 #include <glm/glm.hpp>
 
+#include <algorithm>
 #include <stdexcept>
-#include <fstream>
 #include <iostream>
 #include <vector>
 #include <string>
 #include <set>
 #include <cstddef>
 
-MeshBuffer::MeshBuffer(std::string const &filename) {
-	glGenBuffers(1, &buffer);
+MeshBuffer::MeshBuffer(std::string const &filename, std::set< std::string > const &keep_positions) : MeshBuffer(filename, Deferred, keep_positions) {
+	upload();
+}
 
-	std::ifstream file(filename, std::ios::binary);
+MeshBuffer::MeshBuffer(std::string const &filename, DeferUpload, std::set< std::string > const &keep_positions) {
+	pending_file = std::make_shared< ChunkFile >(filename);
+	ChunkFile &file = *pending_file;
 
 	GLuint total = 0;
 
-	struct Vertex {
-		glm::vec3 Position;
-		glm::vec3 Normal;
-		glm::u8vec4 Color;
-		glm::vec2 TexCoord;
-	};
-	static_assert(sizeof(Vertex) == 3*4+3*4+4*1+2*4, "Vertex is packed.");
-	std::vector< Vertex > data;
+	typedef MeshVertex Vertex;
+	ChunkFile::Span< Vertex > data;
+	ChunkFile::Span< QuantizedMeshVertex > quantized_data;
+	QuantizedBounds bounds;
+
+	//read data chunk (upload() sends it to the GPU straight from the mapped file):
+	if (filename.size() >= 5 && filename.substr(filename.size()-5) == ".pnct" && file.next_magic() == "qnt0") {
+		//quantized by index-meshes -q (see mesh_vertex.hpp):
+		ChunkFile::Span< QuantizedBounds > bounds_chunk = file.read< QuantizedBounds >("qnt0");
+		if (bounds_chunk.size() != 1) throw std::runtime_error("expected one set of bounds in '" + filename + "'");
+		bounds = bounds_chunk[0];
+		position_offset = bounds.min;
+		position_scale = bounds.max - bounds.min;
 
-	//read + upload data chunk:
-	if (filename.size() >= 5 && filename.substr(filename.size()-5) == ".pnct") {
-		read_chunk(file, "pnct", &data);
+		quantized_data = file.read< QuantizedMeshVertex >("pnq0");
+		pending_data = quantized_data.data();
+		pending_bytes = quantized_data.size() * sizeof(QuantizedMeshVertex);
 
-		//upload data:
-		glBindBuffer(GL_ARRAY_BUFFER, buffer);
-		glBufferData(GL_ARRAY_BUFFER, data.size() * sizeof(Vertex), data.data(), GL_STATIC_DRAW);
-		glBindBuffer(GL_ARRAY_BUFFER, 0);
+		total = GLuint(quantized_data.size()); //store total for later checks on index
+
+		//store attrib locations (OpenGL converts these to floats; positions then span [0,1]^3 and position_offset/scale map them to object space):
+		typedef QuantizedMeshVertex Q;
+		Position = Attrib(3, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(Q), offsetof(Q, Position));
+		Normal = Attrib(4, GL_INT_2_10_10_10_REV, GL_TRUE, sizeof(Q), offsetof(Q, Normal));
+		Color = Attrib(4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Q), offsetof(Q, Color));
+		TexCoord = Attrib(2, GL_HALF_FLOAT, GL_FALSE, sizeof(Q), offsetof(Q, TexCoord));
+	} else if (filename.size() >= 5 && filename.substr(filename.size()-5) == ".pnct") {
+		data = file.read< Vertex >("pnct");
+		pending_data = data.data();
+		pending_bytes = data.size() * sizeof(Vertex);
 
 		total = GLuint(data.size()); //store total for later checks on index
 
@@ -47,8 +65,41 @@ MeshBuffer::MeshBuffer(std::string const &filename) {
 		throw std::runtime_error("Unknown file type '" + filename + "'");
 	}
 
-	std::vector< char > strings;
-	read_chunk(file, "str0", &strings);
+	//read index chunk, if the file was converted by index-meshes (then mesh ranges are ranges of indices):
+	ChunkFile::Span< uint16_t > indices16;
+	ChunkFile::Span< uint32_t > indices32;
+	if (file.next_magic() == "ix16") {
+		indices16 = file.read< uint16_t >("ix16");
+		index_type = GL_UNSIGNED_SHORT;
+		pending_indices = indices16.data();
+		pending_index_bytes = indices16.size() * sizeof(uint16_t);
+		total = GLuint(indices16.size());
+	} else if (file.next_magic() == "ix32") {
+		indices32 = file.read< uint32_t >("ix32");
+		index_type = GL_UNSIGNED_INT;
+		pending_indices = indices32.data();
+		pending_index_bytes = indices32.size() * sizeof(uint32_t);
+		total = GLuint(indices32.size());
+	}
+	size_t vertex_count = data.size() + quantized_data.size();
+	for (auto i : indices16) {
+		if (i >= vertex_count) throw std::runtime_error("index out of range in '" + filename + "'");
+	}
+	for (auto i : indices32) {
+		if (i >= vertex_count) throw std::runtime_error("index out of range in '" + filename + "'");
+	}
+	//object-space position of the vertex drawn 'i'th:
+	auto position = [&](GLuint i) -> glm::vec3 {
+		if (index_type == GL_UNSIGNED_SHORT) i = indices16[i];
+		else if (index_type == GL_UNSIGNED_INT) i = indices32[i];
+		if (!quantized_data.empty()) return dequantize(quantized_data[i], bounds).Position;
+		else return data[i].Position;
+	};
+
+	ChunkFile::Span< char > strings = file.read< char >("str0");
+
+	//meshes by name, numbered (in this order) once their LODs are linked:
+	std::map< std::string, Mesh > named;
 
 	{ //read index chunk, add to meshes:
 		struct IndexEntry {
@@ -57,8 +108,7 @@ MeshBuffer::MeshBuffer(std::string const &filename) {
 		};
 		static_assert(sizeof(IndexEntry) == 16, "Index entry should be packed");
 
-		std::vector< IndexEntry > index;
-		read_chunk(file, "idx0", &index);
+		ChunkFile::Span< IndexEntry > index = file.read< IndexEntry >("idx0");
 
 		for (auto const &entry : index) {
 			if (!(entry.name_begin <= entry.name_end && entry.name_end <= strings.size())) {
@@ -67,52 +117,175 @@ MeshBuffer::MeshBuffer(std::string const &filename) {
 			if (!(entry.vertex_begin <= entry.vertex_end && entry.vertex_end <= total)) {
 				throw std::runtime_error("index entry has out-of-range vertex start/count");
 			}
-			std::string name(&strings[0] + entry.name_begin, &strings[0] + entry.name_end);
+			std::string name(strings.begin() + entry.name_begin, strings.begin() + entry.name_end);
 			Mesh mesh;
 			mesh.type = GL_TRIANGLES;
 			mesh.start = entry.vertex_begin;
 			mesh.count = entry.vertex_end - entry.vertex_begin;
+			mesh.index_type = index_type;
+			mesh.position_offset = position_offset;
+			mesh.position_scale = position_scale;
 			for (uint32_t v = entry.vertex_begin; v < entry.vertex_end; ++v) {
-				mesh.min = glm::min(mesh.min, data[v].Position);
-				mesh.max = glm::max(mesh.max, data[v].Position);
+				mesh.min = glm::min(mesh.min, position(v));
+				mesh.max = glm::max(mesh.max, position(v));
 			}
-			bool inserted = meshes.insert(std::make_pair(name, mesh)).second;
+			bool inserted = named.insert(std::make_pair(name, mesh)).second;
 			if (!inserted) {
 				std::cerr << "WARNING: mesh name '" + name + "' in filename '" + filename + "' collides with existing mesh." << std::endl;
 			}
 		}
 	}
 
-	if (file.peek() != EOF) {
-		std::cerr << "WARNING: trailing data in mesh file '" << filename << "'" << std::endl;
+	//link level-of-detail chains:
+	for (auto &m : named) {
+		if (m.first.find(".lod") != std::string::npos) continue; //LODs don't have LODs of their own
+		Mesh &mesh = m.second;
+		for (uint32_t level = 1; level <= Mesh::MaxLods; ++level) {
+			auto f = named.find(m.first + ".lod" + std::to_string(level));
+			if (f == named.end()) break;
+			if (f->second.type != mesh.type) {
+				throw std::runtime_error("mesh '" + f->first + "' in '" + filename + "' has a different primitive type than '" + m.first + "'");
+			}
+			mesh.lods[mesh.lod_count].start = f->second.start;
+			mesh.lods[mesh.lod_count].count = f->second.count;
+			mesh.lod_count += 1;
+		}
 	}
 
-	//store positions for collision detection use:
-	positions.reserve(data.size());
-	for (auto const &v : data) {
-		positions.emplace_back(v.Position);
+	//store positions of the meshes that need them, for collision detection use:
+	// (everything else is only needed on the GPU, so it stays in the file until upload())
+	for (auto const &name : keep_positions) {
+		auto f = named.find(name);
+		if (f == named.end()) {
+			throw std::runtime_error("Keeping positions of mesh '" + name + "', which isn't in '" + filename + "'.");
+		}
+		Mesh &mesh = f->second;
+		mesh.positions_start = GLuint(positions.size());
+		for (GLuint v = mesh.start; v < mesh.start + mesh.count; ++v) {
+			positions.emplace_back(position(v));
+		}
+	}
+	positions.shrink_to_fit();
+	dropped_positions = total - std::min< size_t >(total, positions.size()); //(kept ranges could overlap, in principle)
+
+	meshes.reserve(named.size());
+	mesh_names.reserve(named.size());
+	for (auto const &m : named) {
+		add(m.first, m.second);
+	}
+
+	if (!file.at_end()) {
+		std::cerr << "WARNING: trailing data in mesh file '" << filename << "'" << std::endl;
 	}
 
 	/* //DEBUG:
 	std::cout << "File '" << filename << "' contained meshes";
-	for (auto const &m : meshes) {
-		if (&m.second == &meshes.rbegin()->second && meshes.size() > 1) std::cout << " and";
-		std::cout << " '" << m.first << "'";
-		if (&m.second != &meshes.rbegin()->second) std::cout << ",";
+	for (MeshId id = 0; id < meshes.size(); ++id) {
+		if (id + 1 == meshes.size() && meshes.size() > 1) std::cout << " and";
+		std::cout << " '" << mesh_names[id] << "'";
+		if (id + 1 != meshes.size()) std::cout << ",";
 	}
 	std::cout << std::endl;
 	*/
 }
 
+void MeshBuffer::upload() {
+	assert(pending_file && "upload() goes with the Deferred constructor, once");
+
+	glGenBuffers(1, &buffer);
+	glBindBuffer(GL_ARRAY_BUFFER, buffer);
+	glBufferData(GL_ARRAY_BUFFER, pending_bytes, pending_data, GL_STATIC_DRAW);
+	count_load_bytes_uploaded(pending_bytes);
+
+	if (index_type != 0) {
+		//(uploaded through GL_ARRAY_BUFFER because GL_ELEMENT_ARRAY_BUFFER belongs to whatever vao is bound; make_vao_for_program binds it)
+		glGenBuffers(1, &index_buffer);
+		glBindBuffer(GL_ARRAY_BUFFER, index_buffer);
+		glBufferData(GL_ARRAY_BUFFER, pending_index_bytes, pending_indices, GL_STATIC_DRAW);
+		count_load_bytes_uploaded(pending_index_bytes);
+	}
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	//done with the file:
+	pending_file.reset();
+	pending_data = nullptr;
+	pending_bytes = 0;
+	pending_indices = nullptr;
+	pending_index_bytes = 0;
+}
+
+//64-bit FNV-1a (as in Archive::hash), on a range so lookups needn't build strings:
+static uint64_t hash_name(char const *begin, char const *end) {
+	uint64_t hash = 0xcbf29ce484222325ULL;
+	for (char const *c = begin; c != end; ++c) {
+		hash ^= uint8_t(*c);
+		hash *= 0x100000001b3ULL;
+	}
+	return hash;
+}
+
 const Mesh &MeshBuffer::lookup(std::string const &name) const {
-	auto f = meshes.find(name);
-	if (f == meshes.end()) {
+	return meshes[lookup_id(name)];
+}
+
+MeshId MeshBuffer::lookup_id(std::string const &name) const {
+	MeshId id = find(name.data(), name.data() + name.size());
+	if (id == -1U) {
 		throw std::runtime_error("Looking up mesh '" + name + "' that doesn't exist.");
 	}
-	return f->second;
+	return id;
+}
+
+MeshId MeshBuffer::find(char const *name_begin, char const *name_end) const {
+	if (name_slots.empty()) return -1U;
+	uint64_t hash = hash_name(name_begin, name_end);
+	size_t length = size_t(name_end - name_begin);
+	for (size_t s = size_t(hash) & (name_slots.size() - 1); name_slots[s].id != -1U; s = (s + 1) & (name_slots.size() - 1)) {
+		NameSlot const &slot = name_slots[s];
+		if (slot.hash != hash) continue;
+		std::string const &name = mesh_names[slot.id];
+		if (name.size() == length && std::equal(name_begin, name_end, name.begin())) return slot.id;
+	}
+	return -1U;
+}
+
+glm::vec3 const *MeshBuffer::positions_of(Mesh const &mesh) const {
+	if (mesh.positions_start == -1U) {
+		throw std::runtime_error("Mesh positions weren't kept (name the mesh in MeshBuffer's 'keep_positions').");
+	}
+	assert(mesh.positions_start + mesh.count <= positions.size());
+	return positions.data() + mesh.positions_start;
 }
 
-GLuint MeshBuffer::make_vao_for_program(GLuint program) const {
+MeshId MeshBuffer::add(std::string const &name, Mesh const &mesh) {
+	if (find(name.data(), name.data() + name.size()) != -1U) {
+		throw std::runtime_error("Adding mesh '" + name + "', which already exists.");
+	}
+	MeshId id = MeshId(meshes.size());
+	meshes.emplace_back(mesh);
+	mesh_names.emplace_back(name);
+
+	auto insert = [this](uint64_t hash, MeshId id) {
+		size_t s = size_t(hash) & (name_slots.size() - 1);
+		while (name_slots[s].id != -1U) s = (s + 1) & (name_slots.size() - 1);
+		name_slots[s].hash = hash;
+		name_slots[s].id = id;
+	};
+	if (2 * meshes.size() > name_slots.size()) {
+		//grow (keeping the table at most half full), reinserting with the stored hashes:
+		std::vector< NameSlot > old;
+		old.swap(name_slots);
+		name_slots.resize(std::max< size_t >(16, 2 * old.size()));
+		for (auto const &slot : old) {
+			if (slot.id != -1U) insert(slot.hash, slot.id);
+		}
+	}
+	insert(hash_name(name.data(), name.data() + name.size()), id);
+
+	return id;
+}
+
+GLuint MeshBuffer::make_vao_for_program(GLuint program, std::function< std::set< GLuint >(GLuint program) > const &link_extra) const {
 	//create a new vertex array object:
 	GLuint vao = 0;
 	glGenVertexArrays(1, &vao);
@@ -134,6 +307,14 @@ GLuint MeshBuffer::make_vao_for_program(GLuint program) const {
 	bind_attribute("Color", Color);
 	bind_attribute("TexCoord", TexCoord);
 	glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	//indices (if any) are part of the vao's state:
+	if (index_buffer != 0) glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, index_buffer);
+
+	if (link_extra) {
+		std::set< GLuint > extra = link_extra(program);
+		bound.insert(extra.begin(), extra.end());
+	}
 	glBindVertexArray(0);
 
 	//Check that all active attributes were bound:
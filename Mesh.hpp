@@ -4,52 +4,111 @@
  * In this code, "Mesh" is a range of vertices that should be sent through
  *  the OpenGL pipeline together.
  * A "MeshBuffer" holds a collection of such meshes (loaded from a file) in
- *  a single OpenGL array buffer. Individual meshes can be looked up by name
- *  using the MeshBuffer::lookup() function.
+ *  a single OpenGL array buffer (and, for files converted by index-meshes,
+ *  a single element array buffer). Individual meshes can be looked up by name
+ *  using the MeshBuffer::lookup() function, or by MeshId (their index in
+ *  MeshBuffer::meshes) once the name has been resolved with lookup_id().
  *
  */
 
 #include "GL.hpp"
 #include <glm/glm.hpp>
+#include <cstdint>
+#include <functional>
 #include <map>
+#include <set>
 #include <limits>
+#include <memory>
 #include <string>
 #include <vector>
 
+struct ChunkFile;
+
+//meshes in a MeshBuffer are numbered in order of name:
+typedef uint32_t MeshId;
 
 struct Mesh {
 	//Meshes are vertex ranges (and primitive types) in their MeshBuffer:
+	// (or, if index_type is set, ranges of their MeshBuffer's indices, drawn with glDrawElements)
 
 	GLenum type = GL_TRIANGLES; //type of primitives in mesh
-	GLuint start = 0; //index of first vertex
-	GLuint count = 0; //count of vertices
+	GLuint start = 0; //index of first vertex (or index)
+	GLuint count = 0; //count of vertices (or indices)
+	GLenum index_type = 0; //GL_UNSIGNED_SHORT or GL_UNSIGNED_INT if indexed (copy to Scene::Drawable::Pipeline::index_type)
+	GLuint positions_start = -1U; //where this mesh's triangle list is in MeshBuffer::positions, if kept (see MeshBuffer::positions_of)
+	//maps the buffer's Position attribute to object space, for quantized positions (copy to Scene::Drawable::Pipeline::position_offset/scale):
+	glm::vec3 position_offset = glm::vec3(0.0f);
+	glm::vec3 position_scale = glm::vec3(1.0f);
 
 	//Bounding box.
 	//useful for debug visualization and collision detection:
 	glm::vec3 min = glm::vec3( std::numeric_limits< float >::infinity());
 	glm::vec3 max = glm::vec3(-std::numeric_limits< float >::infinity());
+
+	//Coarser versions of this mesh, most detailed first.
+	//MeshBuffer fills these from meshes named "name.lod1", "name.lod2", ... (which can also still be looked up themselves):
+	enum : uint32_t { MaxLods = 3 };
+	uint32_t lod_count = 0;
+	struct Lod {
+		GLuint start = 0;
+		GLuint count = 0;
+	} lods[MaxLods];
 };
 
 struct MeshBuffer {
 	//construct from a file:
 	// note: will throw if file fails to read.
-	MeshBuffer(std::string const &filename);
+	//'keep_positions' names the meshes whose positions code needs on the CPU (e.g., colliders; see positions_of()):
+	// note: will throw if one of them isn't in the file.
+	MeshBuffer(std::string const &filename, std::set< std::string > const &keep_positions = {});
+	//..or read the file without touching OpenGL (e.g., in a background load; see Load.hpp), then upload() it later:
+	enum DeferUpload { Deferred };
+	MeshBuffer(std::string const &filename, DeferUpload, std::set< std::string > const &keep_positions = {});
+	//creates 'buffer' from the vertices read by the Deferred constructor (call on the OpenGL context thread):
+	void upload();
+	//..or start empty, to be filled in by code that builds meshes itself (e.g., bake_static_drawables()):
+	MeshBuffer() = default;
 
 	//look up a particular mesh by name:
 	// note: will throw if mesh not found.
 	const Mesh &lookup(std::string const &name) const;
+	//..or resolve its name to an id once (also throws), and index 'meshes' with that from then on:
+	MeshId lookup_id(std::string const &name) const;
+	//..or get -1U if there's no such mesh (the name needn't be in a std::string):
+	MeshId find(char const *name_begin, char const *name_end) const;
+
+	//triangle list of a mesh named in the constructor's 'keep_positions', in drawing order (mesh.count positions, in object space):
+	// note: will throw if the mesh's positions weren't kept.
+	glm::vec3 const *positions_of(Mesh const &mesh) const;
+
+	//add a mesh (called by the constructor, or by code that builds meshes itself), returning its id:
+	// note: will throw if the name is already taken.
+	MeshId add(std::string const &name, Mesh const &mesh);
 	
 	//build a vertex array object that links this vbo to attributes to a program:
 	// note: will throw if program defines attributes not contained in this buffer
-	GLuint make_vao_for_program(GLuint program) const;
+	//'link_extra' (optional) is called with the new vao bound so it can link attributes from other buffers (e.g., per-instance data);
+	// it returns the locations it linked, which are then also considered bound.
+	GLuint make_vao_for_program(GLuint program, std::function< std::set< GLuint >(GLuint program) > const &link_extra = nullptr) const;
 
 	//This is the OpenGL vertex buffer object containing the mesh data:
 	GLuint buffer = 0;
+	//..and the element buffer with its indices, if the file was indexed (make_vao_for_program binds it to the vao):
+	GLuint index_buffer = 0;
+	GLenum index_type = 0; //GL_UNSIGNED_SHORT or GL_UNSIGNED_INT (0 if not indexed)
 
 	//-- internals ---
 
-	//used by the lookup() function:
-	std::map< std::string, Mesh > meshes;
+	//meshes and their names, by id:
+	std::vector< Mesh > meshes;
+	std::vector< std::string > mesh_names;
+
+	//used by the lookup functions: names' hashes (64-bit FNV-1a, computed once by add()) in a linear-probing table at most half full:
+	struct NameSlot {
+		uint64_t hash = 0;
+		MeshId id = -1U;
+	};
+	std::vector< NameSlot > name_slots;
 
 	//These 'Attrib' structures describe the location of various attributes within the buffer (in exactly format wanted by glVertexAttribPointer). They are set when the file is loaded and are used by the "make_vao_for_program" call:
 	struct Attrib {
@@ -69,6 +128,20 @@ struct MeshBuffer {
 	Attrib Color;
 	Attrib TexCoord;
 
-	//local copy of vertex information: (for collision detection)
+	//quantized files (see mesh_vertex.hpp) store positions as [0,1]^3; this maps them to object space:
+	// (identity otherwise; meshes carry a copy)
+	glm::vec3 position_offset = glm::vec3(0.0f);
+	glm::vec3 position_scale = glm::vec3(1.0f);
+
+	//local copy of the positions of the 'keep_positions' meshes, one after another: (for collision detection)
+	// (each in drawing order, so [mesh.positions_start, mesh.positions_start+mesh.count) is that mesh's triangle list, indexed or not)
 	std::vector< glm::vec3 > positions;
+	size_t dropped_positions = 0; //positions of the file's other meshes, which aren't kept
+
+	//vertices (and indices) waiting for upload() (they point into 'pending_file'):
+	std::shared_ptr< ChunkFile > pending_file;
+	void const *pending_data = nullptr;
+	size_t pending_bytes = 0;
+	void const *pending_indices = nullptr;
+	size_t pending_index_bytes = 0;
 };
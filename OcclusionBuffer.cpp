@@ -0,0 +1,384 @@
+#include "OcclusionBuffer.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <tuple>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#include <emmintrin.h>
+#define OCCLUSION_SSE2 1
+#endif
+
+//clip-space w below this is treated as crossing the near plane:
+static constexpr float MinW = 1.0e-3f;
+
+OcclusionBuffer::OcclusionBuffer(glm::uvec2 size_, uint32_t threads) : size((size_.x + 3) / 4 * 4, size_.y) {
+	assert(size.x > 0 && size.y > 0);
+
+	//mip chain down to 1x1:
+	glm::uvec2 level_size = size;
+	while (true) {
+		level_sizes.emplace_back(level_size);
+		levels.emplace_back(level_size.x * level_size.y, 1.0f);
+		if (level_size == glm::uvec2(1)) break;
+		level_size = glm::max((level_size + glm::uvec2(1)) / 2U, glm::uvec2(1));
+	}
+
+	if (threads == 0) {
+		//leave a core for the main thread's other work:
+		threads = std::max(1U, std::min(4U, std::thread::hardware_concurrency() / 2U));
+	}
+	bands = std::min(threads, size.y);
+
+	for (uint32_t w = 1; w < bands; ++w) {
+		workers.emplace_back([this,w](){
+			uint32_t seen = 0;
+			while (true) {
+				{
+					std::unique_lock< std::mutex > lock(mutex);
+					work_cv.wait(lock, [&](){ return quit || generation != seen; });
+					if (quit) return;
+					seen = generation;
+				}
+				rasterize_band(w);
+				{
+					std::unique_lock< std::mutex > lock(mutex);
+					remaining -= 1;
+					if (remaining == 0) done_cv.notify_one();
+				}
+			}
+		});
+	}
+}
+
+OcclusionBuffer::~OcclusionBuffer() {
+	{
+		std::unique_lock< std::mutex > lock(mutex);
+		quit = true;
+	}
+	work_cv.notify_all();
+	for (auto &worker : workers) {
+		worker.join();
+	}
+}
+
+void OcclusionBuffer::clear(glm::mat4 const &world_to_clip_) {
+	world_to_clip = world_to_clip_;
+	triangles.clear();
+	stats = Stats();
+	std::fill(levels[0].begin(), levels[0].end(), 1.0f);
+}
+
+//twice the signed area of triangle (a,b,c); positive if counterclockwise:
+template< typename A, typename B, typename C >
+static float orient(A const &a, B const &b, C const &c) {
+	return (b.x - a.x) * (c.y - a.y) - (c.x - a.x) * (b.y - a.y);
+}
+
+void OcclusionBuffer::add_occluder(glm::mat4 const &object_to_world, glm::vec3 const *positions, uint32_t count) {
+	assert(count % 3 == 0);
+	stats.occluders += 1;
+	uint32_t triangle_count = count / 3;
+
+	//pair up triangles that share an edge (e.g. the halves of a quad), so they can be drawn as one polygon:
+	occluder_edges.clear();
+	for (uint32_t v = 0; v < 3 * triangle_count; ++v) {
+		Edge edge;
+		edge.a = positions[v];
+		edge.b = positions[v - v % 3 + (v + 1) % 3];
+		if (edge.a == edge.b) continue;
+		if (std::tie(edge.b.x, edge.b.y, edge.b.z) < std::tie(edge.a.x, edge.a.y, edge.a.z)) std::swap(edge.a, edge.b);
+		edge.vertex = v;
+		occluder_edges.emplace_back(edge);
+	}
+	std::sort(occluder_edges.begin(), occluder_edges.end(), [](Edge const &x, Edge const &y){
+		return std::tie(x.a.x, x.a.y, x.a.z, x.b.x, x.b.y, x.b.z) < std::tie(y.a.x, y.a.y, y.a.z, y.b.x, y.b.y, y.b.z);
+	});
+	partners.assign(triangle_count, Partner());
+	for (size_t i = 0; i + 1 < occluder_edges.size(); ++i) {
+		Edge const &x = occluder_edges[i];
+		Edge const &y = occluder_edges[i+1];
+		if (x.a != y.a || x.b != y.b) continue;
+		uint32_t tx = x.vertex / 3, ty = y.vertex / 3;
+		if (tx == ty || partners[tx].start != -1U || partners[ty].start != -1U) continue;
+		partners[tx].start = x.vertex;
+		partners[tx].opposite = 3 * ty + (y.vertex + 2) % 3;
+		partners[ty].start = y.vertex;
+		partners[ty].opposite = 3 * tx + (x.vertex + 2) % 3;
+	}
+
+	//vertices in buffer pixels:
+	glm::mat4 object_to_clip = world_to_clip * object_to_world;
+	glm::vec2 half_size = 0.5f * glm::vec2(size);
+	screen.resize(3 * triangle_count);
+	for (uint32_t v = 0; v < 3 * triangle_count; ++v) {
+		glm::vec4 clip = object_to_clip * glm::vec4(positions[v], 1.0f);
+		if (clip.w < MinW) {
+			screen[v] = glm::vec4(0.0f, 0.0f, 0.0f, -1.0f);
+			continue;
+		}
+		glm::vec3 ndc = glm::vec3(clip) / clip.w;
+		screen[v] = glm::vec4((ndc.x + 1.0f) * half_size.x, (ndc.y + 1.0f) * half_size.y, 0.5f * ndc.z + 0.5f, 1.0f);
+	}
+	auto behind = [&](uint32_t t) {
+		return screen[3*t+0].w < 0.0f || screen[3*t+1].w < 0.0f || screen[3*t+2].w < 0.0f;
+	};
+
+	for (uint32_t t = 0; t < triangle_count; ++t) {
+		Partner const &partner = partners[t];
+		if (partner.merged) continue;
+		if (behind(t)) {
+			//dropping an occluder triangle only makes culling more conservative:
+			stats.skipped_triangles += 1;
+			continue;
+		}
+
+		//merge with the other triangle if it lies across the shared edge on screen (if it folds back over this one, the edge is a silhouette):
+		uint32_t other = partner.opposite / 3;
+		if (partner.start != -1U && other > t && !behind(other)) {
+			glm::vec4 const &a = screen[partner.start];
+			glm::vec4 const &b = screen[partner.start - partner.start % 3 + (partner.start + 1) % 3];
+			glm::vec4 const &c = screen[partner.start - partner.start % 3 + (partner.start + 2) % 3];
+			glm::vec4 const &d = screen[partner.opposite];
+			if (orient(a, b, c) * orient(a, b, d) < 0.0f) {
+				glm::vec3 quad[4] = { glm::vec3(b), glm::vec3(c), glm::vec3(a), glm::vec3(d) };
+				add_polygon(quad, 4);
+				partners[other].merged = true;
+				continue;
+			}
+		}
+
+		glm::vec3 tri[3] = { glm::vec3(screen[3*t+0]), glm::vec3(screen[3*t+1]), glm::vec3(screen[3*t+2]) };
+		add_polygon(tri, 3);
+	}
+}
+
+//corners[0..2] are a triangle; corners[3] (if present) is across its corners[2]-corners[0] edge:
+void OcclusionBuffer::add_polygon(glm::vec3 *v, uint32_t count) {
+	assert(count == 3 || count == 4);
+
+	//flip clockwise polygons so both windings rasterize (this keeps corners[3] across the corners[2]-corners[0] edge):
+	float area = orient(v[0], v[1], v[2]);
+	if (area < 0.0f) {
+		std::swap(v[0], v[2]);
+		area = -area;
+	}
+	float total_area = area + (count == 4 ? orient(v[0], v[2], v[3]) : 0.0f);
+	if (0.5f * total_area < min_triangle_area) {
+		stats.skipped_triangles += count - 2;
+		return;
+	}
+
+	Triangle tri;
+	glm::vec2 min = glm::vec2(v[0]), max = glm::vec2(v[0]);
+	for (uint32_t i = 1; i < count; ++i) {
+		min = glm::min(min, glm::vec2(v[i]));
+		max = glm::max(max, glm::vec2(v[i]));
+	}
+	//pixel centers are at +0.5:
+	tri.min_x = std::max(0, int32_t(std::ceil(min.x - 0.5f)));
+	tri.max_x = std::min(int32_t(size.x) - 1, int32_t(std::floor(max.x - 0.5f)));
+	tri.min_y = std::max(0, int32_t(std::ceil(min.y - 0.5f)));
+	tri.max_y = std::min(int32_t(size.y) - 1, int32_t(std::floor(max.y - 0.5f)));
+	if (tri.min_x > tri.max_x || tri.min_y > tri.max_y) {
+		stats.skipped_triangles += count - 2;
+		return;
+	}
+
+	for (uint32_t e = 0; e < 4; ++e) {
+		if (e >= count) {
+			//always inside:
+			tri.edges[e][0] = 0.0f;
+			tri.edges[e][1] = 0.0f;
+			tri.edges[e][2] = 1.0f;
+			continue;
+		}
+		glm::vec3 const &a = v[e];
+		glm::vec3 const &b = v[(e + 1) % count];
+		tri.edges[e][0] = a.y - b.y;
+		tri.edges[e][1] = b.x - a.x;
+		tri.edges[e][2] = a.x * b.y - a.y * b.x;
+		//the smallest value over a pixel is at the corner half a pixel out from its center along each axis:
+		tri.edges[e][2] -= 0.5f * (std::abs(tri.edges[e][0]) + std::abs(tri.edges[e][1]));
+	}
+	//depth plane through the first three corners:
+	float inv_area = 1.0f / area;
+	float dz1 = v[1].z - v[0].z, dz2 = v[2].z - v[0].z;
+	tri.depth[0] = (dz1 * (v[2].y - v[0].y) - dz2 * (v[1].y - v[0].y)) * inv_area;
+	tri.depth[1] = (dz2 * (v[1].x - v[0].x) - dz1 * (v[2].x - v[0].x)) * inv_area;
+	tri.depth[2] = v[0].z - tri.depth[0] * v[0].x - tri.depth[1] * v[0].y;
+	//the second triangle of a quad meets the plane along the shared edge, so it is nowhere farther than at its last corner:
+	float beyond = 0.0f;
+	if (count == 4) beyond = std::max(0.0f, v[3].z - (tri.depth[0] * v[3].x + tri.depth[1] * v[3].y + tri.depth[2]));
+	//the largest value over a pixel is half a pixel out from its center along each axis:
+	tri.depth[2] += 0.5f * (std::abs(tri.depth[0]) + std::abs(tri.depth[1])) + beyond;
+
+	triangles.emplace_back(tri);
+	stats.triangles += count - 2;
+}
+
+void OcclusionBuffer::finish() {
+	auto before = std::chrono::high_resolution_clock::now();
+
+	//rasterize in bands:
+	if (!workers.empty()) {
+		{
+			std::unique_lock< std::mutex > lock(mutex);
+			generation += 1;
+			remaining = uint32_t(workers.size());
+		}
+		work_cv.notify_all();
+	}
+	rasterize_band(0);
+	if (!workers.empty()) {
+		std::unique_lock< std::mutex > lock(mutex);
+		done_cv.wait(lock, [&](){ return remaining == 0; });
+	}
+
+	//build max-depth mips:
+	for (uint32_t l = 1; l < levels.size(); ++l) {
+		glm::uvec2 src_size = level_sizes[l-1];
+		glm::uvec2 dst_size = level_sizes[l];
+		std::vector< float > const &src = levels[l-1];
+		std::vector< float > &dst = levels[l];
+		for (uint32_t y = 0; y < dst_size.y; ++y) {
+			uint32_t y0 = 2 * y, y1 = std::min(2 * y + 1, src_size.y - 1);
+			for (uint32_t x = 0; x < dst_size.x; ++x) {
+				uint32_t x0 = 2 * x, x1 = std::min(2 * x + 1, src_size.x - 1);
+				dst[y * dst_size.x + x] = std::max(
+					std::max(src[y0 * src_size.x + x0], src[y0 * src_size.x + x1]),
+					std::max(src[y1 * src_size.x + x0], src[y1 * src_size.x + x1])
+				);
+			}
+		}
+	}
+
+	auto after = std::chrono::high_resolution_clock::now();
+	stats.rasterize_ms = std::chrono::duration< float, std::milli >(after - before).count();
+}
+
+void OcclusionBuffer::rasterize_band(uint32_t band) {
+	int32_t band_min_y = int32_t(band * size.y / bands);
+	int32_t band_max_y = int32_t((band + 1) * size.y / bands) - 1;
+	float *depth = levels[0].data();
+
+	for (auto const &tri : triangles) {
+		int32_t min_y = std::max(tri.min_y, band_min_y);
+		int32_t max_y = std::min(tri.max_y, band_max_y);
+		if (min_y > max_y) continue;
+		//spans start on a multiple of four, and size.x is a multiple of four, so all four pixels are in the buffer:
+		int32_t min_x = tri.min_x & ~3;
+		int32_t max_x = tri.max_x;
+
+		for (int32_t y = min_y; y <= max_y; ++y) {
+			float py = float(y) + 0.5f;
+			float *row = depth + y * int32_t(size.x);
+#ifdef OCCLUSION_SSE2
+			if (use_sse2) {
+				__m128 const zero = _mm_setzero_ps();
+				__m128 const lane = _mm_set_ps(3.5f, 2.5f, 1.5f, 0.5f);
+				__m128 e_a[4], e_row[4];
+				for (uint32_t e = 0; e < 4; ++e) {
+					e_a[e] = _mm_set1_ps(tri.edges[e][0]);
+					e_row[e] = _mm_set1_ps(tri.edges[e][1] * py + tri.edges[e][2]);
+				}
+				__m128 z_a = _mm_set1_ps(tri.depth[0]);
+				__m128 z_row = _mm_set1_ps(tri.depth[1] * py + tri.depth[2]);
+				for (int32_t x = min_x; x <= max_x; x += 4) {
+					__m128 px = _mm_add_ps(_mm_set1_ps(float(x)), lane);
+					__m128 inside = _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(e_a[0], px), e_row[0]), zero);
+					inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(e_a[1], px), e_row[1]), zero));
+					inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(e_a[2], px), e_row[2]), zero));
+					inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(e_a[3], px), e_row[3]), zero));
+					if (_mm_movemask_ps(inside) == 0) continue;
+					__m128 z = _mm_add_ps(_mm_mul_ps(z_a, px), z_row);
+					__m128 old = _mm_loadu_ps(row + x);
+					__m128 nearer = _mm_min_ps(old, z);
+					_mm_storeu_ps(row + x, _mm_or_ps(_mm_and_ps(inside, nearer), _mm_andnot_ps(inside, old)));
+				}
+				continue;
+			}
+#endif
+			//(row terms are summed first, as above, so both loops round alike)
+			float e_row[4];
+			for (uint32_t e = 0; e < 4; ++e) {
+				e_row[e] = tri.edges[e][1] * py + tri.edges[e][2];
+			}
+			float z_row = tri.depth[1] * py + tri.depth[2];
+			for (int32_t x = min_x; x <= max_x; x += 4) {
+				for (int32_t i = 0; i < 4; ++i) {
+					float px = float(x) + (float(i) + 0.5f);
+					bool inside = true;
+					for (uint32_t e = 0; e < 4; ++e) {
+						inside = inside && (tri.edges[e][0] * px + e_row[e] >= 0.0f);
+					}
+					if (!inside) continue;
+					float z = tri.depth[0] * px + z_row;
+					row[x + i] = std::min(row[x + i], z);
+				}
+			}
+		}
+	}
+}
+
+//pixel rectangle and nearest depth of a box; returns false if it crosses the near plane:
+static bool project_box(glm::mat4 const &object_to_clip, glm::vec3 const &min, glm::vec3 const &max, glm::uvec2 const &size,
+	glm::vec2 *lo, glm::vec2 *hi, float *nearest) {
+	*lo = glm::vec2(std::numeric_limits< float >::infinity());
+	*hi = glm::vec2(-std::numeric_limits< float >::infinity());
+	*nearest = 1.0f;
+	for (uint32_t c = 0; c < 8; ++c) {
+		glm::vec3 corner((c & 1 ? max.x : min.x), (c & 2 ? max.y : min.y), (c & 4 ? max.z : min.z));
+		glm::vec4 clip = object_to_clip * glm::vec4(corner, 1.0f);
+		if (clip.w < MinW) return false;
+		glm::vec3 ndc = glm::vec3(clip) / clip.w;
+		glm::vec2 px = (glm::vec2(ndc) + 1.0f) * 0.5f * glm::vec2(size);
+		*lo = glm::min(*lo, px);
+		*hi = glm::max(*hi, px);
+		*nearest = std::min(*nearest, 0.5f * ndc.z + 0.5f);
+	}
+	return true;
+}
+
+bool OcclusionBuffer::occluded(glm::mat4 const &object_to_clip, glm::vec3 const &min, glm::vec3 const &max) const {
+	glm::vec2 lo, hi;
+	float nearest;
+	if (!project_box(object_to_clip, min, max, size, &lo, &hi, &nearest)) return false;
+
+	//pixels covered (clamped to the buffer):
+	int32_t x0 = std::max(0, int32_t(std::floor(lo.x)));
+	int32_t y0 = std::max(0, int32_t(std::floor(lo.y)));
+	int32_t x1 = std::min(int32_t(size.x) - 1, int32_t(std::floor(hi.x)));
+	int32_t y1 = std::min(int32_t(size.y) - 1, int32_t(std::floor(hi.y)));
+	if (x0 > x1 || y0 > y1) return false; //off-screen; that's the frustum test's job
+
+	//find the level where the rectangle spans at most 2x2 texels:
+	uint32_t level = 0;
+	while (level + 1 < levels.size() && (x1 - x0 > 1 || y1 - y0 > 1)) {
+		x0 >>= 1; y0 >>= 1; x1 >>= 1; y1 >>= 1;
+		level += 1;
+	}
+
+	std::vector< float > const &depth = levels[level];
+	uint32_t width = level_sizes[level].x;
+	for (int32_t y = y0; y <= y1; ++y) {
+		for (int32_t x = x0; x <= x1; ++x) {
+			//something behind the box's nearest point is visible there, so the box might be too:
+			if (depth[y * width + x] >= nearest) return false;
+		}
+	}
+	return true;
+}
+
+float OcclusionBuffer::screen_area(glm::mat4 const &object_to_clip, glm::vec3 const &min, glm::vec3 const &max) const {
+	glm::vec2 lo, hi;
+	float nearest;
+	if (!project_box(object_to_clip, min, max, size, &lo, &hi, &nearest)) return float(size.x) * float(size.y);
+	lo = glm::max(lo, glm::vec2(0.0f));
+	hi = glm::min(hi, glm::vec2(size));
+	if (lo.x >= hi.x || lo.y >= hi.y) return 0.0f;
+	return (hi.x - lo.x) * (hi.y - lo.y);
+}
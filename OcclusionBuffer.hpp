@@ -0,0 +1,103 @@
+#pragma once
+
+/*
+ * OcclusionBuffer is a small software depth buffer used to skip drawables hidden behind big occluders.
+ *
+ * Each frame:
+ *  - clear() with the camera's world-to-clip matrix
+ *  - add_occluder() a few large meshes (triangles are set up here, tiny or near-clipped ones are skipped)
+ *     occluders are rasterized conservatively: a pixel is only written if the occluder covers all of it,
+ *     with the farthest depth the occluder has inside it
+ *  - finish() rasterizes them (in horizontal bands, in parallel, four pixels at a time)
+ *     and builds mips holding the *farthest* depth of each 2x2 block
+ *  - occluded() tests bounding boxes against the coarsest mip that covers them in a few texels
+ *
+ * Everything happens on the CPU, so it doesn't need (or touch) OpenGL.
+ *
+ */
+
+#include <glm/glm.hpp>
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct OcclusionBuffer {
+	//'size.x' is rounded up to a multiple of four; 'threads' of zero picks from the hardware:
+	OcclusionBuffer(glm::uvec2 size = glm::uvec2(256, 128), uint32_t threads = 0);
+	~OcclusionBuffer();
+	OcclusionBuffer(OcclusionBuffer const &) = delete;
+	OcclusionBuffer &operator=(OcclusionBuffer const &) = delete;
+
+	void clear(glm::mat4 const &world_to_clip);
+	//'positions' is a triangle list (count a multiple of three):
+	void add_occluder(glm::mat4 const &object_to_world, glm::vec3 const *positions, uint32_t count);
+	void finish();
+
+	//true if the box is certainly hidden behind what was rasterized:
+	// (boxes crossing the near plane or off-screen are never reported as occluded)
+	bool occluded(glm::mat4 const &object_to_clip, glm::vec3 const &min, glm::vec3 const &max) const;
+
+	//screen area (in buffer pixels) of a box; boxes crossing the near plane count as covering the whole buffer:
+	float screen_area(glm::mat4 const &object_to_clip, glm::vec3 const &min, glm::vec3 const &max) const;
+
+	//triangles smaller than this (in buffer pixels) aren't worth rasterizing:
+	float min_triangle_area = 2.0f;
+
+	//rasterize four pixels at a time with SSE2, where it's compiled in (false draws with the scalar loop; see test-occlusion):
+	bool use_sse2 = true;
+
+	glm::uvec2 size;
+	glm::mat4 world_to_clip = glm::mat4(1.0f);
+
+	//triangle set up for rasterization in buffer pixels:
+	// edges[i] and depth are plane equations a*x + b*y + c, tested at pixel centers
+	// edges are moved in by half a pixel (so only pixels entirely inside pass) and depth is moved back
+	//  by half a pixel's slope (so it is the farthest depth over the pixel)
+	// two triangles sharing an edge are set up as one quad, since the pixels along the shared edge
+	//  are covered by neither triangle alone (a quad with three edges is a triangle)
+	struct Triangle {
+		float edges[4][3]; //positive inside
+		float depth[3]; //depth in [0,1] (or a bit more)
+		int32_t min_x, min_y, max_x, max_y; //inclusive pixel bounds, clamped to the buffer
+	};
+	std::vector< Triangle > triangles;
+
+	//levels[0] is the full-resolution depth buffer (nearest depth), levels[i] the max of 2x2 blocks of levels[i-1]:
+	std::vector< std::vector< float > > levels;
+	std::vector< glm::uvec2 > level_sizes;
+
+	//work counters for the last frame:
+	struct Stats {
+		uint32_t occluders = 0;
+		uint32_t triangles = 0; //rasterized
+		uint32_t skipped_triangles = 0; //too small, behind the camera, or off-screen
+		float rasterize_ms = 0.0f; //finish() (CPU, wall clock)
+	} stats;
+
+	//internals:
+	void add_polygon(glm::vec3 *corners, uint32_t count); //3 or 4 (pixel x, pixel y, depth) corners
+	void rasterize_band(uint32_t band);
+	//add_occluder() scratch space:
+	struct Edge {
+		glm::vec3 a, b; //object-space endpoints, in sorted order
+		uint32_t vertex; //index of the edge's first vertex in the occluder
+	};
+	std::vector< Edge > occluder_edges;
+	struct Partner {
+		uint32_t start = -1U; //index of the first vertex of the shared edge (in this triangle)
+		uint32_t opposite = -1U; //index of the other triangle's vertex that isn't on the shared edge
+		bool merged = false; //already drawn as part of the other triangle's quad
+	};
+	std::vector< Partner > partners; //per occluder triangle
+	std::vector< glm::vec4 > screen; //per occluder vertex: (pixel x, pixel y, depth, w < 0 if behind the camera)
+	uint32_t bands = 1;
+	std::vector< std::thread > workers; //band i+1 is drawn by workers[i]; the calling thread draws band 0
+	std::mutex mutex;
+	std::condition_variable work_cv, done_cv;
+	uint32_t generation = 0; //bumped to start a frame's work
+	uint32_t remaining = 0; //workers still busy
+	bool quit = false;
+};
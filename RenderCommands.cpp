@@ -0,0 +1,285 @@
+#include "RenderCommands.hpp"
+
+#include "gl_errors.hpp"
+
+#include <glm/gtc/type_ptr.hpp>
+
+#include <cassert>
+#include <iostream>
+#include <stdexcept>
+
+char const *RenderCommands::name(Op op) {
+	switch (op) {
+		case OpUseProgram: return "UseProgram";
+		case OpBindVertexArray: return "BindVertexArray";
+		case OpBindTexture: return "BindTexture";
+		case OpBindBufferBase: return "BindBufferBase";
+		case OpBindBufferRange: return "BindBufferRange";
+		case OpBufferData: return "BufferData";
+		case OpWriteBuffer: return "WriteBuffer";
+		case OpUniform: return "Uniform";
+		case OpDrawArrays: return "DrawArrays";
+		case OpDrawArraysInstanced: return "DrawArraysInstanced";
+		case OpDrawElements: return "DrawElements";
+		case OpDrawElementsInstanced: return "DrawElementsInstanced";
+		case OpColorMask: return "ColorMask";
+		case OpDepthFunc: return "DepthFunc";
+		case OpDepthMask: return "DepthMask";
+		case OpCount: break;
+	}
+	return "(unknown)";
+}
+
+void RenderCommands::uniform(GLint location, int32_t value) {
+	add(Uniform{ location, Uniform::Int }, &value, sizeof(value));
+}
+void RenderCommands::uniform(GLint location, float value) {
+	add(Uniform{ location, Uniform::Float }, &value, sizeof(value));
+}
+void RenderCommands::uniform(GLint location, glm::vec2 const &value) {
+	add(Uniform{ location, Uniform::Vec2 }, glm::value_ptr(value), sizeof(value));
+}
+void RenderCommands::uniform(GLint location, glm::vec3 const &value) {
+	add(Uniform{ location, Uniform::Vec3 }, glm::value_ptr(value), sizeof(value));
+}
+void RenderCommands::uniform(GLint location, glm::vec4 const &value) {
+	add(Uniform{ location, Uniform::Vec4 }, glm::value_ptr(value), sizeof(value));
+}
+void RenderCommands::uniform(GLint location, glm::mat3 const &value) {
+	add(Uniform{ location, Uniform::Mat3 }, glm::value_ptr(value), sizeof(value));
+}
+void RenderCommands::uniform(GLint location, glm::mat4x3 const &value) {
+	add(Uniform{ location, Uniform::Mat4x3 }, glm::value_ptr(value), sizeof(value));
+}
+void RenderCommands::uniform(GLint location, glm::mat4 const &value) {
+	add(Uniform{ location, Uniform::Mat4 }, glm::value_ptr(value), sizeof(value));
+}
+
+//bytes per index of an element array:
+static size_t index_size(GLenum type) {
+	assert(type == GL_UNSIGNED_SHORT || type == GL_UNSIGNED_INT);
+	return (type == GL_UNSIGNED_SHORT ? 2 : 4);
+}
+
+void RenderCommands::clear() {
+	arena.clear();
+	count = 0;
+}
+
+//walk the arena, handing each record's header, command, and data to 'fn':
+template< typename F >
+static void for_each_command(std::vector< uint64_t > const &arena, F const &fn) {
+	char const *at = reinterpret_cast< char const * >(arena.data());
+	char const *end = at + arena.size() * sizeof(arena[0]);
+	while (at < end) {
+		RenderCommands::Header header;
+		std::memcpy(&header, at, sizeof(header));
+		assert(header.op < RenderCommands::OpCount);
+		fn(header, at + sizeof(header), at + RenderCommands::data_offset(header));
+		at += RenderCommands::record_size(header);
+	}
+	assert(at == end);
+}
+
+//copy a command out of the arena (asserting it is the expected type):
+template< typename T >
+static T read(RenderCommands::Header const &header, char const *command) {
+	assert(header.op == T::op && header.size == sizeof(T));
+	T ret;
+	std::memcpy(&ret, command, sizeof(T));
+	return ret;
+}
+
+void RenderCommands::execute() const {
+	GLuint active_unit = 0;
+	for_each_command(arena, [&active_unit](Header const &header, char const *command, char const *data) {
+		switch (Op(header.op)) {
+			case OpUseProgram: {
+				glUseProgram(read< UseProgram >(header, command).program);
+				break;
+			}
+			case OpBindVertexArray: {
+				glBindVertexArray(read< BindVertexArray >(header, command).vao);
+				break;
+			}
+			case OpBindTexture: {
+				BindTexture c = read< BindTexture >(header, command);
+				if (c.unit != active_unit) {
+					glActiveTexture(GL_TEXTURE0 + c.unit);
+					active_unit = c.unit;
+				}
+				glBindTexture(c.target, c.texture);
+				break;
+			}
+			case OpBindBufferBase: {
+				BindBufferBase c = read< BindBufferBase >(header, command);
+				glBindBufferBase(c.target, c.index, c.buffer);
+				break;
+			}
+			case OpBindBufferRange: {
+				BindBufferRange c = read< BindBufferRange >(header, command);
+				glBindBufferRange(c.target, c.index, c.buffer, c.offset, c.size);
+				break;
+			}
+			case OpBufferData: {
+				BufferData c = read< BufferData >(header, command);
+				assert(header.bytes == 0 || GLsizeiptr(header.bytes) == c.size);
+				glBindBuffer(c.target, c.buffer);
+				glBufferData(c.target, c.size, (header.bytes != 0 ? data : nullptr), c.usage);
+				glBindBuffer(c.target, 0);
+				break;
+			}
+			case OpWriteBuffer: {
+				WriteBuffer c = read< WriteBuffer >(header, command);
+				glBindBuffer(c.target, c.buffer);
+				void *mapped = glMapBufferRange(c.target, c.offset, header.bytes,
+					GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+				if (!mapped) throw std::runtime_error("Failed to map buffer for WriteBuffer command.");
+				std::memcpy(mapped, data, header.bytes);
+				glUnmapBuffer(c.target);
+				glBindBuffer(c.target, 0);
+				break;
+			}
+			case OpUniform: {
+				Uniform c = read< Uniform >(header, command);
+				GLfloat const *v = reinterpret_cast< GLfloat const * >(data);
+				switch (c.type) {
+					case Uniform::Int: glUniform1iv(c.location, 1, reinterpret_cast< GLint const * >(data)); break;
+					case Uniform::Float: glUniform1fv(c.location, 1, v); break;
+					case Uniform::Vec2: glUniform2fv(c.location, 1, v); break;
+					case Uniform::Vec3: glUniform3fv(c.location, 1, v); break;
+					case Uniform::Vec4: glUniform4fv(c.location, 1, v); break;
+					case Uniform::Mat3: glUniformMatrix3fv(c.location, 1, GL_FALSE, v); break;
+					case Uniform::Mat4x3: glUniformMatrix4x3fv(c.location, 1, GL_FALSE, v); break;
+					case Uniform::Mat4: glUniformMatrix4fv(c.location, 1, GL_FALSE, v); break;
+				}
+				break;
+			}
+			case OpDrawArrays: {
+				DrawArrays c = read< DrawArrays >(header, command);
+				glDrawArrays(c.mode, c.first, c.count);
+				break;
+			}
+			case OpDrawArraysInstanced: {
+				DrawArraysInstanced c = read< DrawArraysInstanced >(header, command);
+				glDrawArraysInstanced(c.mode, c.first, c.count, c.instances);
+				break;
+			}
+			case OpDrawElements: {
+				DrawElements c = read< DrawElements >(header, command);
+				glDrawElements(c.mode, c.count, c.type, (GLbyte *)0 + c.first * index_size(c.type));
+				break;
+			}
+			case OpDrawElementsInstanced: {
+				DrawElementsInstanced c = read< DrawElementsInstanced >(header, command);
+				glDrawElementsInstanced(c.mode, c.count, c.type, (GLbyte *)0 + c.first * index_size(c.type), c.instances);
+				break;
+			}
+			case OpColorMask: {
+				GLboolean mask = read< ColorMask >(header, command).mask;
+				glColorMask(mask, mask, mask, mask);
+				break;
+			}
+			case OpDepthFunc: {
+				glDepthFunc(read< DepthFunc >(header, command).func);
+				break;
+			}
+			case OpDepthMask: {
+				glDepthMask(read< DepthMask >(header, command).mask);
+				break;
+			}
+			case OpCount: break;
+		}
+	});
+	if (active_unit != 0) glActiveTexture(GL_TEXTURE0);
+	GL_ERRORS();
+}
+
+void RenderCommands::dump(std::ostream &out) const {
+	uint32_t index = 0;
+	for_each_command(arena, [&](Header const &header, char const *command, char const *) {
+		out << index << ": " << name(Op(header.op));
+		switch (Op(header.op)) {
+			case OpUseProgram: {
+				out << " program=" << read< UseProgram >(header, command).program;
+				break;
+			}
+			case OpBindVertexArray: {
+				out << " vao=" << read< BindVertexArray >(header, command).vao;
+				break;
+			}
+			case OpBindTexture: {
+				BindTexture c = read< BindTexture >(header, command);
+				out << " unit=" << c.unit << " target=0x" << std::hex << c.target << std::dec << " texture=" << c.texture;
+				break;
+			}
+			case OpBindBufferBase: {
+				BindBufferBase c = read< BindBufferBase >(header, command);
+				out << " target=0x" << std::hex << c.target << std::dec << " index=" << c.index << " buffer=" << c.buffer;
+				break;
+			}
+			case OpBindBufferRange: {
+				BindBufferRange c = read< BindBufferRange >(header, command);
+				out << " target=0x" << std::hex << c.target << std::dec << " index=" << c.index << " buffer=" << c.buffer
+					<< " offset=" << c.offset << " size=" << c.size;
+				break;
+			}
+			case OpBufferData: {
+				BufferData c = read< BufferData >(header, command);
+				out << " target=0x" << std::hex << c.target << std::dec << " buffer=" << c.buffer << " size=" << c.size
+					<< " usage=0x" << std::hex << c.usage << std::dec;
+				break;
+			}
+			case OpWriteBuffer: {
+				WriteBuffer c = read< WriteBuffer >(header, command);
+				out << " target=0x" << std::hex << c.target << std::dec << " buffer=" << c.buffer << " offset=" << c.offset;
+				break;
+			}
+			case OpUniform: {
+				Uniform c = read< Uniform >(header, command);
+				static char const *types[] = { "int", "float", "vec2", "vec3", "vec4", "mat3", "mat4x3", "mat4" };
+				out << " location=" << c.location << " type=" << (c.type < 8 ? types[c.type] : "?");
+				break;
+			}
+			case OpDrawArrays: {
+				DrawArrays c = read< DrawArrays >(header, command);
+				out << " mode=0x" << std::hex << c.mode << std::dec << " first=" << c.first << " count=" << c.count;
+				break;
+			}
+			case OpDrawArraysInstanced: {
+				DrawArraysInstanced c = read< DrawArraysInstanced >(header, command);
+				out << " mode=0x" << std::hex << c.mode << std::dec << " first=" << c.first << " count=" << c.count
+					<< " instances=" << c.instances;
+				break;
+			}
+			case OpDrawElements: {
+				DrawElements c = read< DrawElements >(header, command);
+				out << " mode=0x" << std::hex << c.mode << " type=0x" << c.type << std::dec << " first=" << c.first << " count=" << c.count;
+				break;
+			}
+			case OpDrawElementsInstanced: {
+				DrawElementsInstanced c = read< DrawElementsInstanced >(header, command);
+				out << " mode=0x" << std::hex << c.mode << " type=0x" << c.type << std::dec << " first=" << c.first << " count=" << c.count
+					<< " instances=" << c.instances;
+				break;
+			}
+			case OpColorMask: {
+				out << " mask=" << int(read< ColorMask >(header, command).mask);
+				break;
+			}
+			case OpDepthFunc: {
+				out << " func=0x" << std::hex << read< DepthFunc >(header, command).func << std::dec;
+				break;
+			}
+			case OpDepthMask: {
+				out << " mask=" << int(read< DepthMask >(header, command).mask);
+				break;
+			}
+			case OpCount: break;
+		}
+		if (header.bytes != 0) out << " (+" << header.bytes << " bytes)";
+		out << '\n';
+		index += 1;
+	});
+	out << count << " commands, " << bytes() << " bytes." << std::endl;
+}
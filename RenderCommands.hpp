@@ -0,0 +1,225 @@
+#pragma once
+
+/*
+ * RenderCommands records OpenGL work as a stream of small plain-old-data
+ *  commands packed into one byte arena; execute() is the one place that turns
+ *  them into GL calls.
+ *
+ * Recording never touches OpenGL, so a producer (Scene::draw, ~DrawLines,
+ *  ~DrawSprites) can build its stream anywhere -- e.g., on a worker thread,
+ *  handing the finished RenderCommands to the GL thread -- and a stream can be
+ *  inspected or dump()'d as text for offline analysis.
+ *
+ * Usage:
+ *   RenderCommands commands;
+ *   commands.add(RenderCommands::BufferData{ GL_ARRAY_BUFFER, buffer, GL_STREAM_DRAW, bytes }, attribs.data(), bytes);
+ *   commands.add(RenderCommands::UseProgram{ program });
+ *   commands.uniform(program->OBJECT_TO_CLIP_mat4, object_to_clip);
+ *   commands.add(RenderCommands::DrawArrays{ GL_TRIANGLES, 0, count });
+ *   commands.execute();
+ *
+ * Commands that carry data (BufferData, WriteBuffer, Uniform) copy it into the
+ *  arena right behind the command, so the source doesn't need to outlive add().
+ *
+ */
+
+#include "GL.hpp"
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <iosfwd>
+#include <type_traits>
+#include <vector>
+
+struct RenderCommands {
+	enum Op : uint16_t {
+		OpUseProgram,
+		OpBindVertexArray,
+		OpBindTexture,
+		OpBindBufferBase,
+		OpBindBufferRange,
+		OpBufferData,
+		OpWriteBuffer,
+		OpUniform,
+		OpDrawArrays,
+		OpDrawArraysInstanced,
+		OpDrawElements,
+		OpDrawElementsInstanced,
+		OpColorMask,
+		OpDepthFunc,
+		OpDepthMask,
+		OpCount
+	};
+	static char const *name(Op op);
+
+	//---- commands ----
+	struct UseProgram {
+		static constexpr Op op = OpUseProgram;
+		GLuint program;
+	};
+	struct BindVertexArray {
+		static constexpr Op op = OpBindVertexArray;
+		GLuint vao;
+	};
+	//bind 'texture' to texture unit 'unit' (execute() leaves unit zero active afterward):
+	struct BindTexture {
+		static constexpr Op op = OpBindTexture;
+		GLuint unit;
+		GLenum target;
+		GLuint texture;
+	};
+	struct BindBufferBase {
+		static constexpr Op op = OpBindBufferBase;
+		GLenum target;
+		GLuint index;
+		GLuint buffer;
+	};
+	struct BindBufferRange {
+		static constexpr Op op = OpBindBufferRange;
+		GLenum target;
+		GLuint index;
+		GLuint buffer;
+		GLintptr offset;
+		GLsizeiptr size;
+	};
+	//replace the storage of 'buffer' with 'size' bytes of the data that follows
+	// (or, with no data following, with 'size' undefined bytes -- i.e., orphan it):
+	struct BufferData {
+		static constexpr Op op = OpBufferData;
+		GLenum target;
+		GLuint buffer;
+		GLenum usage;
+		GLsizeiptr size;
+	};
+	//write the data that follows to 'buffer' at 'offset', without waiting on the GPU
+	// (the producer makes sure the range isn't being read -- e.g., by only writing fresh parts of a ring buffer):
+	struct WriteBuffer {
+		static constexpr Op op = OpWriteBuffer;
+		GLenum target;
+		GLuint buffer;
+		GLintptr offset;
+	};
+	//set the uniform at 'location' of the bound program to the values that follow:
+	struct Uniform {
+		static constexpr Op op = OpUniform;
+		enum Type : uint32_t { Int, Float, Vec2, Vec3, Vec4, Mat3, Mat4x3, Mat4 };
+		GLint location;
+		Type type;
+	};
+	struct DrawArrays {
+		static constexpr Op op = OpDrawArrays;
+		GLenum mode;
+		GLint first;
+		GLsizei count;
+	};
+	struct DrawArraysInstanced {
+		static constexpr Op op = OpDrawArraysInstanced;
+		GLenum mode;
+		GLint first;
+		GLsizei count;
+		GLsizei instances;
+	};
+	//draw indices [first, first+count) of the bound vao's element array buffer:
+	struct DrawElements {
+		static constexpr Op op = OpDrawElements;
+		GLenum mode;
+		GLenum type; //GL_UNSIGNED_SHORT or GL_UNSIGNED_INT
+		GLuint first;
+		GLsizei count;
+	};
+	struct DrawElementsInstanced {
+		static constexpr Op op = OpDrawElementsInstanced;
+		GLenum mode;
+		GLenum type;
+		GLuint first;
+		GLsizei count;
+		GLsizei instances;
+	};
+	//mask (or un-mask) all four color channels:
+	struct ColorMask {
+		static constexpr Op op = OpColorMask;
+		GLboolean mask;
+	};
+	struct DepthFunc {
+		static constexpr Op op = OpDepthFunc;
+		GLenum func;
+	};
+	struct DepthMask {
+		static constexpr Op op = OpDepthMask;
+		GLboolean mask;
+	};
+
+	//---- recording ----
+
+	//append a command, followed by 'bytes' of 'data':
+	template< typename T >
+	void add(T const &command, void const *data = nullptr, size_t bytes = 0) {
+		void *space = add_space(command, bytes);
+		if (bytes != 0) std::memcpy(space, data, bytes);
+	}
+
+	//append a command followed by 'bytes' of space, returned to be filled in by the caller
+	// (only valid until the next add):
+	template< typename T >
+	void *add_space(T const &command, size_t bytes) {
+		static_assert(std::is_trivially_copyable< T >::value, "Commands are plain old data.");
+		static_assert(sizeof(T) <= 0xffff, "Commands are small.");
+		Header header;
+		header.op = T::op;
+		header.size = uint16_t(sizeof(T));
+		header.bytes = uint32_t(bytes);
+		char *at = allocate(header);
+		std::memcpy(at, &header, sizeof(header));
+		std::memcpy(at + sizeof(header), &command, sizeof(T));
+		return at + data_offset(header);
+	}
+
+	//convenience for Uniform:
+	void uniform(GLint location, int32_t value);
+	void uniform(GLint location, float value);
+	void uniform(GLint location, glm::vec2 const &value);
+	void uniform(GLint location, glm::vec3 const &value);
+	void uniform(GLint location, glm::vec4 const &value);
+	void uniform(GLint location, glm::mat3 const &value);
+	void uniform(GLint location, glm::mat4x3 const &value);
+	void uniform(GLint location, glm::mat4 const &value);
+
+	//forget all commands (keeping the arena's memory):
+	void clear();
+
+	//---- replay ----
+
+	//issue every command, in order, on the current GL context:
+	void execute() const;
+
+	//write one line of text per command (with its fields, but not its data):
+	void dump(std::ostream &out) const;
+
+	//---- internals ----
+
+	//each command is stored as a Header, the command itself, then its data; each part starts 8-byte aligned:
+	struct Header {
+		uint16_t op;
+		uint16_t size; //sizeof the command
+		uint32_t bytes; //size of the data that follows
+	};
+	static_assert(sizeof(Header) == 8, "Header is packed.");
+
+	static size_t align(size_t offset) { return (offset + 7) & ~size_t(7); }
+	static size_t data_offset(Header const &header) { return align(sizeof(Header) + header.size); }
+	static size_t record_size(Header const &header) { return data_offset(header) + align(header.bytes); }
+
+	char *allocate(Header const &header) {
+		size_t at = arena.size();
+		arena.resize(at + record_size(header) / sizeof(arena[0]));
+		count += 1;
+		return reinterpret_cast< char * >(arena.data() + at);
+	}
+
+	std::vector< uint64_t > arena; //(uint64_t so records stay 8-byte aligned)
+	uint32_t count = 0; //commands in arena
+
+	size_t bytes() const { return arena.size() * sizeof(arena[0]); }
+};
@@ -0,0 +1,147 @@
+#include "RenderTargets.hpp"
+
+#include "gl_errors.hpp"
+
+#include <cassert>
+#include <stdexcept>
+#include <string>
+
+RenderTargets render_targets;
+
+bool RenderTargets::Format::operator==(Format const &other) const {
+	for (uint32_t i = 0; i < MaxColors; ++i) {
+		if (colors[i] != other.colors[i]) return false;
+	}
+	return depth == other.depth;
+}
+
+//format + type to pass to glTexImage2D when allocating a texture with a given internal format:
+static void upload_format(GLenum internal_format, GLenum *format, GLenum *type) {
+	switch (internal_format) {
+		case GL_R11F_G11F_B10F: *format = GL_RGB; *type = GL_FLOAT; break;
+		case GL_RGB8: *format = GL_RGB; *type = GL_UNSIGNED_BYTE; break;
+		case GL_RGBA16F: *format = GL_RGBA; *type = GL_FLOAT; break;
+		default: *format = GL_RGBA; *type = GL_UNSIGNED_BYTE; break;
+	}
+}
+
+//approximate bytes per pixel:
+static size_t pixel_bytes(GLenum internal_format) {
+	switch (internal_format) {
+		case GL_NONE: return 0;
+		case GL_RGBA16F: return 8;
+		case GL_DEPTH_COMPONENT32F: return 4;
+		default: return 4; //RGBA8, R11F_G11F_B10F, DEPTH_COMPONENT24 (usually padded), ...
+	}
+}
+
+RenderTargets::Target &RenderTargets::acquire(glm::uvec2 size, Format const &format) {
+	assert(size.x > 0 && size.y > 0);
+	for (auto &target : targets) {
+		if (target.in_use || target.size != size || !(target.format == format)) continue;
+		target.in_use = true;
+		target.last_used = frame;
+		return target;
+	}
+
+	targets.emplace_back();
+	Target &target = targets.back();
+	target.size = size;
+	target.format = format;
+
+	glGenFramebuffers(1, &target.framebuffer);
+	glBindFramebuffer(GL_FRAMEBUFFER, target.framebuffer);
+
+	GLenum draw_buffers[MaxColors];
+	GLsizei draw_buffer_count = 0;
+	for (uint32_t i = 0; i < MaxColors && format.colors[i] != GL_NONE; ++i) {
+		GLenum upload, type;
+		upload_format(format.colors[i], &upload, &type);
+		glGenTextures(1, &target.colors[i]);
+		glBindTexture(GL_TEXTURE_2D, target.colors[i]);
+		glTexImage2D(GL_TEXTURE_2D, 0, format.colors[i], size.x, size.y, 0, upload, type, NULL);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + i, GL_TEXTURE_2D, target.colors[i], 0);
+		draw_buffers[i] = GL_COLOR_ATTACHMENT0 + i;
+		draw_buffer_count += 1;
+	}
+	glBindTexture(GL_TEXTURE_2D, 0);
+	glDrawBuffers(draw_buffer_count, draw_buffers);
+
+	if (format.depth != GL_NONE) {
+		glGenRenderbuffers(1, &target.depth);
+		glBindRenderbuffer(GL_RENDERBUFFER, target.depth);
+		glRenderbufferStorage(GL_RENDERBUFFER, format.depth, size.x, size.y);
+		glBindRenderbuffer(GL_RENDERBUFFER, 0);
+		glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, target.depth);
+	}
+
+	GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	GL_ERRORS();
+	if (status != GL_FRAMEBUFFER_COMPLETE) {
+		free(target);
+		targets.pop_back();
+		throw std::runtime_error("Render target of size " + std::to_string(size.x) + "x" + std::to_string(size.y) + " is incomplete (status " + std::to_string(status) + ").");
+	}
+
+	target.in_use = true;
+	target.last_used = frame;
+	return target;
+}
+
+void RenderTargets::release(Target &target) {
+	assert(target.in_use);
+	target.in_use = false;
+}
+
+void RenderTargets::end_frame() {
+	frame += 1;
+	for (auto t = targets.begin(); t != targets.end(); /* later */) {
+		if (!t->in_use && t->last_used + keep_frames < frame) {
+			free(*t);
+			t = targets.erase(t);
+		} else {
+			++t;
+		}
+	}
+}
+
+void RenderTargets::resize(glm::uvec2 drawable_size_) {
+	drawable_size = drawable_size_;
+	//targets are (mostly) sized from the drawable, so none of the old ones are worth keeping:
+	for (auto t = targets.begin(); t != targets.end(); /* later */) {
+		if (!t->in_use) {
+			free(*t);
+			t = targets.erase(t);
+		} else {
+			++t;
+		}
+	}
+}
+
+size_t RenderTargets::bytes() const {
+	size_t total = 0;
+	for (auto const &target : targets) {
+		size_t per_pixel = pixel_bytes(target.format.depth);
+		for (uint32_t i = 0; i < MaxColors; ++i) {
+			per_pixel += pixel_bytes(target.format.colors[i]);
+		}
+		total += per_pixel * target.size.x * target.size.y;
+	}
+	return total;
+}
+
+void RenderTargets::free(Target &target) {
+	for (uint32_t i = 0; i < MaxColors; ++i) {
+		if (target.colors[i] != 0) glDeleteTextures(1, &target.colors[i]);
+		target.colors[i] = 0;
+	}
+	if (target.depth != 0) glDeleteRenderbuffers(1, &target.depth);
+	target.depth = 0;
+	if (target.framebuffer != 0) glDeleteFramebuffers(1, &target.framebuffer);
+	target.framebuffer = 0;
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+/*
+ * RenderTargets hands out framebuffers (with attached textures) for offscreen passes.
+ *
+ * Targets are shared by everything that draws:
+ *  - acquire() returns an unused target of the requested size and format, making one if needed
+ *  - release() gives it back, so the next pass asking for the same size and format gets the same
+ *    memory (passes that don't overlap alias each other's targets)
+ *  - targets not acquired for a few frames are freed by end_frame(), and resize() frees everything
+ *    not in use, so storage follows the drawable size as the window changes
+ *
+ */
+
+#include "GL.hpp"
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <list>
+
+struct RenderTargets {
+	enum : uint32_t { MaxColors = 2 };
+
+	struct Format {
+		//internal formats of color attachments 0..MaxColors-1 (GL_NONE after the last one):
+		GLenum colors[MaxColors] = { GL_NONE, GL_NONE };
+		//internal format of depth renderbuffer (GL_NONE for no depth):
+		GLenum depth = GL_NONE;
+
+		bool operator==(Format const &other) const;
+	};
+
+	struct Target {
+		GLuint framebuffer = 0;
+		GLuint colors[MaxColors] = { 0, 0 }; //textures (linear filtering, clamped to edge)
+		GLuint depth = 0; //renderbuffer
+		glm::uvec2 size = glm::uvec2(0);
+		Format format;
+
+		//bookkeeping:
+		bool in_use = false;
+		uint32_t last_used = 0; //frame number
+	};
+
+	//get a target nobody else is using (its contents are undefined):
+	// throws if the framebuffer can't be completed
+	Target &acquire(glm::uvec2 size, Format const &format);
+	//done with target (for this frame):
+	void release(Target &target);
+
+	//call once per frame, after drawing:
+	void end_frame();
+	//call when the drawable size changes:
+	void resize(glm::uvec2 drawable_size);
+
+	//approximate video memory used by all targets:
+	size_t bytes() const;
+
+	//most recent size passed to resize():
+	glm::uvec2 drawable_size = glm::uvec2(0);
+
+	//a std::list so references returned by acquire() stay valid:
+	std::list< Target > targets;
+	uint32_t frame = 0;
+	//unused targets are kept this many frames before being freed:
+	uint32_t keep_frames = 3;
+
+	void free(Target &target);
+};
+
+//the shared pool:
+extern RenderTargets render_targets;
@@ -2,10 +2,14 @@
 #include "data_path.hpp"
 #include "LitColorTextureProgram.hpp"
 #include "BloomProgram.hpp"
+#include "ImpostorProgram.hpp"
+#include "bake_static.hpp"
 #include <glm/gtc/type_ptr.hpp>
 
 #include <unordered_set>
 #include <unordered_map>
+#include <set>
+#include <string>
 #include <iostream>
 
 //used for lookup later:
@@ -21,18 +25,35 @@ Mesh const *mesh_player = nullptr;
 //names of mesh-to-collider-mesh:
 std::unordered_map< Mesh const *, Mesh const * > mesh_to_collider;
 
+//meshes that are also collision geometry (roll_meshes keeps CPU-side positions for just these):
+static std::set< std::string > const collider_mesh_names = {
+  "city", "window1", "window2", "window3", "window4", "window5", "window6"
+};
+
 GLuint roll_meshes_for_lit_color_texture_program = 0;
+GLuint roll_meshes_for_lit_color_texture_program_instanced = 0;
 
 //Load the meshes used in Sphere Roll levels:
-Load< MeshBuffer > roll_meshes(LoadTagDefault, []() -> MeshBuffer * {
-  MeshBuffer *ret = new MeshBuffer(data_path("test_scene.pnct"));
+// (read + parsed on a loader worker while the programs compile; see roll_meshes_setup for the rest)
+Load< MeshBuffer > roll_meshes(LoadTagDefault, LoadAfter{}, LoadInBackground(), []() -> LoadFinish< MeshBuffer > {
+  MeshBuffer *ret = new MeshBuffer(data_path("test_scene.pnct"), MeshBuffer::Deferred, collider_mesh_names);
+  return [ret]() -> MeshBuffer const * {
+    ret->upload();
+    return ret;
+  };
+});
+
+static Load< void > roll_meshes_setup(LoadTagDefault,
+  LoadAfter{ &roll_meshes, &lit_color_texture_program, &lit_color_texture_program_instanced }, [](){
+  MeshBuffer const *ret = roll_meshes.value;
 
-  for (auto p : ret->meshes) {
-    std::cout << p.first << std::endl;
+  for (auto const &name : ret->mesh_names) {
+    std::cout << name << std::endl;
   }
 
   //Build vertex array object for the program we're using to shade these meshes:
   roll_meshes_for_lit_color_texture_program = ret->make_vao_for_program(lit_color_texture_program->program);
+  roll_meshes_for_lit_color_texture_program_instanced = ret->make_vao_for_program(lit_color_texture_program_instanced->program, Scene::link_instance_attribs);
 
   //key objects:
   mesh_window1 = &ret->lookup("window1");
@@ -40,19 +61,17 @@ Load< MeshBuffer > roll_meshes(LoadTagDefault, []() -> MeshBuffer * {
   mesh_window3 = &ret->lookup("window3");
   mesh_window4 = &ret->lookup("window4");
   mesh_window5 = &ret->lookup("window5");
-  mesh_window5 = &ret->lookup("window6");
+  mesh_window6 = &ret->lookup("window6");
   mesh_letter = &ret->lookup("letter");
   mesh_player = &ret->lookup("player");
   
-  mesh_to_collider.insert(std::make_pair(&ret->lookup("city"), &ret->lookup("city")));
-  mesh_to_collider.insert(std::make_pair(&ret->lookup("window1"), &ret->lookup("window1")));
-  mesh_to_collider.insert(std::make_pair(&ret->lookup("window2"), &ret->lookup("window2")));
-  mesh_to_collider.insert(std::make_pair(&ret->lookup("window3"), &ret->lookup("window3")));
-  mesh_to_collider.insert(std::make_pair(&ret->lookup("window4"), &ret->lookup("window4")));
-  mesh_to_collider.insert(std::make_pair(&ret->lookup("window5"), &ret->lookup("window5")));
-  mesh_to_collider.insert(std::make_pair(&ret->lookup("window6"), &ret->lookup("window6")));
+  for (auto const &name : collider_mesh_names) {
+    mesh_to_collider.insert(std::make_pair(&ret->lookup(name), &ret->lookup(name)));
+  }
 
-  return ret;
+  std::cout << "Kept positions of " << collider_mesh_names.size() << " collider meshes: "
+    << ret->positions.size() * sizeof(glm::vec3) / 1024 << " kB (" << ret->dropped_positions * sizeof(glm::vec3) / 1024
+    << " kB of render-only positions not kept)." << std::endl;
 });
 
 //Load sphere roll level:
@@ -72,33 +91,41 @@ RollLevel::RollLevel(std::string const &scene_file) {
 
   srand48(time(NULL));
   post_processing_program = bloom_program->program;
+  impostor_program = ::impostor_program->program;
 
   //Load scene (using Scene::load function), building proper associations as needed:
-  load(scene_file, [this,&scene_file](Scene &, Transform *transform, std::string const &mesh_name){
-    Mesh const *mesh = &roll_meshes->lookup(mesh_name);
+  //(mesh names are resolved to ids once per name, not once per object)
+  load(scene_file, [](std::string const &mesh_name){
+    return roll_meshes->lookup_id(mesh_name);
+  }, [this,&scene_file](Scene &, Transform *transform, MeshId mesh_id){
+    Mesh const *mesh = &roll_meshes->meshes[mesh_id];
   
     drawables.emplace_back(transform);
     Drawable::Pipeline &pipeline = drawables.back().pipeline;
-    glm::vec4 *custom_col = drawables.back().custom_col;
-    assert(custom_col);
     
     //set up drawable to draw mesh from buffer:
     pipeline = lit_color_texture_program_pipeline;
     pipeline.vao = roll_meshes_for_lit_color_texture_program;
+    pipeline.instanced.vao = roll_meshes_for_lit_color_texture_program_instanced;
     pipeline.type = mesh->type;
     pipeline.start = mesh->start;
     pipeline.count = mesh->count;
-    pipeline.set_uniforms = [&pipeline, custom_col, transform](){
-      GLuint loc = glGetUniformLocation(pipeline.program, "CUSTOM_COL");
-      assert(loc != -1U);
-      assert (custom_col);
-      glm::vec4 c = *custom_col;
-      glUniform4f(loc, c.x, c.y, c.z, c.w);
-      loc = glGetUniformLocation(pipeline.program, "ANCHOR_POS");
-      assert(loc != -1U);
-      glm::vec3 pos = transform->position;
-      glUniform3f(loc, pos.x, pos.y, pos.z);
-    };
+    pipeline.index_type = mesh->index_type;
+    pipeline.position_offset = mesh->position_offset;
+    pipeline.position_scale = mesh->position_scale;
+
+    //bounds let the scene skip drawing this if it's out of view:
+    drawables.back().has_bounds = true;
+    drawables.back().min = mesh->min;
+    drawables.back().max = mesh->max;
+
+    //coarser versions to draw when it's small on screen:
+    static_assert(uint32_t(Drawable::MaxLods) == uint32_t(Mesh::MaxLods), "drawables can hold every mesh LOD");
+    drawables.back().lod_count = mesh->lod_count;
+    for (uint32_t l = 0; l < mesh->lod_count; ++l) {
+      drawables.back().lods[l].start = mesh->lods[l].start;
+      drawables.back().lods[l].count = mesh->lods[l].count;
+    }
 
     //associate level info with the drawable:
     if (mesh == mesh_player) {
@@ -106,9 +133,11 @@ RollLevel::RollLevel(std::string const &scene_file) {
         throw std::runtime_error("Level '" + scene_file + "' contains more than one Sphere (starting location).");
       }
       player.transform = transform;
+      transform->dynamic = true;
     } else if (mesh==mesh_window1 || mesh==mesh_window2 || mesh==mesh_window3 ||
         mesh==mesh_window4 || mesh==mesh_window5 || mesh==mesh_window6) {
-      Window window = Window(transform, custom_col);
+      Window window = Window(transform, drawables.back().custom_col = make_custom_col());
+      transform->dynamic = true; //windows change color when they become delivery destinations
       if (drand48() > 0.25f) window.light_on = true;
       *window.custom_col = window.light_on ? glm::vec4(1,0,1,1) : glm::vec4(0.3, 0.3, 0.3, 1);
       windows.push_back(window);
@@ -116,8 +145,9 @@ RollLevel::RollLevel(std::string const &scene_file) {
       mesh_colliders.emplace_back(transform, *f->second, *roll_meshes);
     } else if (mesh == mesh_letter) {
       letter.transform = transform;
+      transform->dynamic = true;
       letter.default_rotation = transform->rotation;
-      letter.custom_col = custom_col;
+      letter.custom_col = drawables.back().custom_col = make_custom_col();
     } else {
       auto f = mesh_to_collider.find(mesh);
       assert (f != mesh_to_collider.end());
@@ -134,8 +164,29 @@ RollLevel::RollLevel(std::string const &scene_file) {
     << windows.size() << " windows "
     << std::endl;
   
+  //Windows light up their surroundings:
+  first_window_lamp = lamps.size();
+  for (auto const &window : windows) {
+    lamps.emplace_back(window.transform);
+    lamps.back().type = Lamp::Point;
+    lamps.back().distance = window_lamp_distance;
+  }
+
+  //Collision meshes double as occluders:
+  for (auto const &collider : mesh_colliders) {
+    occluders.emplace_back(Occluder{
+      collider.transform,
+      collider.positions, collider.mesh->count,
+      collider.mesh->min, collider.mesh->max
+    });
+  }
+
+  //Merge everything that doesn't change after load into per-cell batches:
+  static_meshes = bake_static_drawables(*this, *roll_meshes, { roll_meshes_for_lit_color_texture_program }, 64.0f);
+
   //Create player camera:
   transforms.emplace_back();
+  transforms.back().dynamic = true;
   cameras.emplace_back(&transforms.back());
   camera = &cameras.back();
 
@@ -143,9 +194,27 @@ RollLevel::RollLevel(std::string const &scene_file) {
   camera->near = 0.05f;
 
   generate_letter();
+  update_window_lamps();
 
 }
 
+void RollLevel::update_window_lamps() {
+  auto lamp = lamps.begin();
+  std::advance(lamp, first_window_lamp);
+  for (auto const &window : windows) {
+    assert(lamp != lamps.end() && lamp->transform == window.transform);
+    glm::vec4 const &col = *window.custom_col;
+    if (col == glm::vec4(1, 0, 1, 1)) {
+      lamp->energy = window_lamp_color; //lit (magenta means "show vertex colors")
+    } else if (col == glm::vec4(0.3, 0.3, 0.3, 1)) {
+      lamp->energy = glm::vec3(0.0f); //unlit
+    } else {
+      lamp->energy = glm::vec3(col) * 3.0f; //delivery destination
+    }
+    ++lamp;
+  }
+}
+
 float safe_drand() {
   float r = drand48();
   return r==1.0f ? 0.99999999f : r;
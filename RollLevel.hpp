@@ -21,10 +21,11 @@ struct RollLevel : Scene {
 
   //Solid parts of level are tracked as MeshColliders:
   struct MeshCollider {
-    MeshCollider(Scene::Transform *transform_, Mesh const &mesh_, MeshBuffer const &buffer_) : transform(transform_), mesh(&mesh_), buffer(&buffer_) { }
+    MeshCollider(Scene::Transform *transform_, Mesh const &mesh_, MeshBuffer const &buffer_) : transform(transform_), mesh(&mesh_), buffer(&buffer_), positions(buffer_.positions_of(mesh_)) { }
     Scene::Transform *transform;
     Mesh const *mesh;
     MeshBuffer const *buffer;
+    glm::vec3 const *positions; //mesh's triangle list (mesh->count positions), kept by buffer
   };
 
   std::vector<glm::vec4> letter_colors = {
@@ -63,9 +64,19 @@ struct RollLevel : Scene {
 
   void generate_letter();
 
+  //Every window has a point lamp (at the end of 'lamps', in the same order as 'windows'):
+  // lit windows glow window_lamp_color, the delivery destination glows its own color, and unlit windows are dark.
+  //Call update_window_lamps() after changing windows, e.g. once before each draw:
+  void update_window_lamps();
+  glm::vec3 window_lamp_color = glm::vec3(3.0f, 2.4f, 1.6f);
+  float window_lamp_distance = 12.0f;
+  size_t first_window_lamp = 0;
+
   //Additional information for things in the level:
   Scene::Camera *camera = nullptr;
   std::vector< MeshCollider > mesh_colliders = {};
+  //baked static geometry (see bake_static.hpp); shared by copies of the level, freed with the last of them:
+  std::shared_ptr< MeshBuffer const > static_meshes;
   std::vector< Window > windows = {};
   Letter letter;
   Player player;
@@ -7,17 +7,27 @@
 #include "Sound.hpp"
 #include "collide.hpp"
 #include "gl_errors.hpp"
+#include "RenderTargets.hpp"
+#include "OcclusionBuffer.hpp"
+#include "ImpostorCache.hpp"
 
 //for glm::pow(quaternion, float):
 #include <glm/gtx/quaternion.hpp>
+#include <glm/gtc/matrix_transform.hpp>
 
 #include <algorithm>
+#include <cmath>
+#include <fstream>
 #include <iostream>
 
 extern Load< RollLevel > game_scene;
 
-Load< SpriteAtlas > trade_font_atlas(LoadTagDefault, []() -> SpriteAtlas const * {
-  return new SpriteAtlas(data_path("trade-font"));
+Load< SpriteAtlas > trade_font_atlas(LoadTagDefault, LoadAfter{}, LoadInBackground(), []() -> LoadFinish< SpriteAtlas > {
+  SpriteAtlas *ret = new SpriteAtlas(data_path("trade-font"), SpriteAtlas::Deferred); //decode png off the main thread
+  return [ret]() -> SpriteAtlas const * {
+    ret->upload();
+    return ret;
+  };
 });
 
 RollMode::RollMode(RollLevel level_) : level(level_)  {
@@ -46,6 +56,40 @@ bool RollMode::handle_event(SDL_Event const &evt, glm::uvec2 const &window_size)
     if (evt.type==SDL_KEYDOWN && evt.key.keysym.sym==SDLK_SPACE) {
       display_text = !display_text;
     }
+    if (evt.type==SDL_KEYDOWN && evt.key.keysym.sym==SDLK_r) {
+      report_draw_stats = true;
+    }
+    if (evt.type==SDL_KEYDOWN && evt.key.keysym.sym==SDLK_2) {
+      //report the time with the old setting, so it can be compared with the new one (press 'r' in a moment):
+      std::cout << "First pass took " << level.first_pass_timer.milliseconds << " ms on the GPU with depth pre-pass "
+        << (level.depth_prepass ? "on" : "off") << "; turning it " << (level.depth_prepass ? "off" : "on") << "." << std::endl;
+      level.depth_prepass = !level.depth_prepass;
+    }
+    if (evt.type==SDL_KEYDOWN && evt.key.keysym.sym==SDLK_7) {
+      //the commands recorded by the last frame's first pass:
+      std::ofstream out("render-commands.txt");
+      level.commands.dump(out);
+      std::cout << "Wrote " << level.commands.count << " render commands to render-commands.txt." << std::endl;
+    }
+    if (evt.type==SDL_KEYDOWN && evt.key.keysym.sym==SDLK_6) {
+      benchmark_light_binning();
+    }
+    if (evt.type==SDL_KEYDOWN && evt.key.keysym.sym==SDLK_5) {
+      level.draw_impostors = !level.draw_impostors;
+      std::cout << "Impostors " << (level.draw_impostors ? "on" : "off") << "." << std::endl;
+    }
+    if (evt.type==SDL_KEYDOWN && evt.key.keysym.sym==SDLK_4) {
+      level.lod_selection = !level.lod_selection;
+      std::cout << "LOD selection " << (level.lod_selection ? "on" : "off") << "." << std::endl;
+    }
+    if (evt.type==SDL_KEYDOWN && evt.key.keysym.sym==SDLK_3) {
+      level.occlusion_culling = !level.occlusion_culling;
+      std::cout << "Occlusion culling " << (level.occlusion_culling ? "on" : "off") << "." << std::endl;
+    }
+    if (evt.type==SDL_KEYDOWN && evt.key.keysym.sym==SDLK_1) {
+      dynamic_resolution.enabled = !dynamic_resolution.enabled;
+      std::cout << "Dynamic resolution " << (dynamic_resolution.enabled ? "on" : "off") << "." << std::endl;
+    }
   }
 
   return false;
@@ -142,9 +186,9 @@ void RollMode::update(float elapsed) {
         for (GLuint v = 0; v + 2 < collider.mesh->count; v += 3) {
           //get vertex positions from associated positions buffer:
           //  (and transform to world space)
-          glm::vec3 a = collider_to_world * glm::vec4(collider.buffer->positions[collider.mesh->start+v+0], 1.0f);
-          glm::vec3 b = collider_to_world * glm::vec4(collider.buffer->positions[collider.mesh->start+v+1], 1.0f);
-          glm::vec3 c = collider_to_world * glm::vec4(collider.buffer->positions[collider.mesh->start+v+2], 1.0f);
+          glm::vec3 a = collider_to_world * glm::vec4(collider.positions[v+0], 1.0f);
+          glm::vec3 b = collider_to_world * glm::vec4(collider.positions[v+1], 1.0f);
+          glm::vec3 c = collider_to_world * glm::vec4(collider.positions[v+2], 1.0f);
           //check triangle:
           bool did_collide = collide_swept_sphere_vs_triangle(
             sphere_sweep_from, sphere_sweep_to, sphere_radius,
@@ -255,9 +299,9 @@ void RollMode::update(float elapsed) {
         for (GLuint v = 0; v + 2 < collider.mesh->count; v += 3) {
           //get vertex positions from associated positions buffer:
           //  (and transform to world space)
-          glm::vec3 a = collider_to_world * glm::vec4(collider.buffer->positions[collider.mesh->start+v+0], 1.0f);
-          glm::vec3 b = collider_to_world * glm::vec4(collider.buffer->positions[collider.mesh->start+v+1], 1.0f);
-          glm::vec3 c = collider_to_world * glm::vec4(collider.buffer->positions[collider.mesh->start+v+2], 1.0f);
+          glm::vec3 a = collider_to_world * glm::vec4(collider.positions[v+0], 1.0f);
+          glm::vec3 b = collider_to_world * glm::vec4(collider.positions[v+1], 1.0f);
+          glm::vec3 c = collider_to_world * glm::vec4(collider.positions[v+2], 1.0f);
           //check triangle:
           bool did_collide = collide_swept_sphere_vs_triangle(
             sphere_sweep_from, sphere_sweep_to, sphere_radius,
@@ -298,7 +342,48 @@ void RollMode::draw(glm::uvec2 const &drawable_size) {
   glDepthFunc(GL_LEQUAL);
 
   level.camera->aspect = drawable_size.x / float(drawable_size.y);
+  level.resolution_scale = dynamic_resolution.scale;
+  level.update_window_lamps();
+  dynamic_resolution.begin();
   level.draw(drawable_size, *level.camera);
+  dynamic_resolution.end();
+
+  if (report_draw_stats) {
+    report_draw_stats = false;
+    Scene::DrawStats const &stats = level.stats;
+    std::cout << "Drew " << stats.drawables << " drawables in " << stats.draw_calls << " draw calls ("
+      << stats.instanced_draw_calls << " instanced, " << stats.prepass_draw_calls << " depth pre-pass); "
+      << stats.state_changes() << " state changes ("
+      << stats.program_binds << " program, "
+      << stats.vao_binds << " vao, "
+      << stats.texture_binds << " texture), unsorted would have been "
+      << stats.unsorted_state_changes << "." << std::endl;
+    std::cout << "Submitted " << stats.triangles << " triangles; " << stats.coarse_lods << " drawables used a coarser LOD, "
+      << stats.impostors << " were drawn as impostors";
+    if (level.impostor_cache) {
+      std::cout << " (" << level.impostor_cache->impostors.size() << "/" << level.impostor_cache->max_impostors << " impostors cached)";
+    }
+    std::cout << "." << std::endl;
+    if (level.light_clusters) {
+      LightClusters::Stats const &lights = level.light_clusters->stats;
+      std::cout << "Binned " << lights.lights << " point lights into " << lights.indices << " light grid entries (at most "
+        << lights.max_per_cluster << " per cell, " << lights.dropped << " dropped) in " << lights.bin_ms << " ms." << std::endl;
+    }
+    std::cout << "Culled " << stats.culled << " drawables outside the view and " << stats.occluded << " hidden by occluders";
+    if (level.occlusion_culling && level.occlusion_buffer) {
+      OcclusionBuffer::Stats const &occlusion = level.occlusion_buffer->stats;
+      std::cout << " (" << occlusion.occluders << " occluders, " << occlusion.triangles << " triangles rasterized, "
+        << occlusion.skipped_triangles << " skipped, in " << occlusion.rasterize_ms << " ms)";
+    }
+    std::cout << "." << std::endl;
+    std::cout << "Recorded " << level.commands.count << " render commands (" << level.commands.bytes() / 1024 << " kB) for the first pass." << std::endl;
+    std::cout << "First pass took " << level.first_pass_timer.milliseconds << " ms and post processing (bloom + composite) took "
+      << level.post_processing_timer.milliseconds << " ms on the GPU; "
+      << render_targets.targets.size() << " render targets use " << render_targets.bytes() / 1024 << " kB." << std::endl;
+    std::cout << "Resolution scale " << level.resolution_scale << " (dynamic " << (dynamic_resolution.enabled ? "on" : "off")
+      << "); drawing takes " << dynamic_resolution.gpu_ms << " ms GPU, " << dynamic_resolution.cpu_ms << " ms CPU; frames every "
+      << dynamic_resolution.frame_ms << " ms." << std::endl;
+  }
 
   if (display_text) { //help text overlay:
     glDisable(GL_DEPTH_TEST);
@@ -333,3 +418,73 @@ void RollMode::restart() {
   level.camera->transform->position = target_position;
   
 }
+
+void RollMode::benchmark_light_binning() {
+  glm::mat4 world_to_clip = level.camera->make_projection() * level.camera->transform->make_world_to_local();
+  glm::vec3 center = level.player.transform->position;
+
+  LightClusters clusters;
+  std::vector< LightClusters::Light > lights;
+  uint32_t seed = 1; //(same lights every time, so runs can be compared)
+  auto next = [&seed]() {
+    seed = seed * 1664525u + 1013904223u;
+    return (seed >> 8) / float(1 << 24);
+  };
+  for (uint32_t count : { 100u, 500u, 2000u }) {
+    lights.clear();
+    for (uint32_t i = 0; i < count; ++i) {
+      LightClusters::Light light;
+      light.position = center + glm::vec3(next() - 0.5f, next() - 0.5f, 0.5f * next()) * 200.0f;
+      light.radius = level.window_lamp_distance;
+      light.color = level.window_lamp_color;
+      lights.emplace_back(light);
+    }
+    uint32_t const runs = 50;
+    float total_ms = 0.0f;
+    float worst_ms = 0.0f;
+    for (uint32_t run = 0; run < runs; ++run) {
+      clusters.build(world_to_clip, lights);
+      total_ms += clusters.stats.bin_ms;
+      worst_ms = std::max(worst_ms, clusters.stats.bin_ms);
+    }
+    std::cout << "Binning " << count << " point lights: " << total_ms / runs << " ms average, " << worst_ms << " ms worst ("
+      << clusters.stats.lights << " on screen, " << clusters.stats.indices << " light grid entries, at most "
+      << clusters.stats.max_per_cluster << " per cell)." << std::endl;
+  }
+
+  //A light just in front of the near plane, seen from an angle: its sphere is entirely in front of the camera,
+  // but a corner of its bounding cube is behind it. Every tile showing part of the sphere must list the light:
+  {
+    glm::vec3 forward = glm::normalize(glm::vec3(-0.65f, 0.03f, 0.76f));
+    glm::vec3 right = glm::normalize(glm::cross(forward, glm::vec3(0.0f, 0.0f, 1.0f)));
+    glm::vec3 up = glm::cross(right, forward);
+    glm::mat4 near_to_clip = glm::infinitePerspective(glm::radians(60.0f), 16.0f / 9.0f, 0.01f)
+      * glm::lookAt(glm::vec3(0.0f), forward, glm::vec3(0.0f, 0.0f, 1.0f));
+    LightClusters::Light light;
+    light.radius = 2.0f;
+    light.position = 2.83f * forward + 0.22f * right - 0.1f * up; //(w - radius is 0.83, a cube corner's w is below zero)
+    light.color = level.window_lamp_color;
+    clusters.build(near_to_clip, std::vector< LightClusters::Light >{ light });
+
+    bool ok = true;
+    for (uint32_t i = 0; ok && i < 16; ++i) {
+      for (uint32_t j = 0; ok && j < 32; ++j) {
+        float theta = 3.1415926f * (i + 0.5f) / 16.0f, phi = 2.0f * 3.1415926f * j / 32.0f;
+        glm::vec3 normal = glm::vec3(std::sin(theta) * std::cos(phi), std::sin(theta) * std::sin(phi), std::cos(theta));
+        glm::vec4 clip = near_to_clip * glm::vec4(light.position + light.radius * normal, 1.0f);
+        if (clip.w <= 1e-3f) continue; //(behind the camera)
+        glm::vec2 ndc = glm::vec2(clip) / clip.w;
+        if (std::abs(ndc.x) > 1.0f || std::abs(ndc.y) > 1.0f) continue;
+        uint32_t x = std::min(uint32_t((ndc.x * 0.5f + 0.5f) * LightClusters::TilesX), uint32_t(LightClusters::TilesX - 1));
+        uint32_t y = std::min(uint32_t((ndc.y * 0.5f + 0.5f) * LightClusters::TilesY), uint32_t(LightClusters::TilesY - 1));
+        if (clusters.boxes.empty()) {
+          ok = false;
+          break;
+        }
+        LightClusters::Box const &box = clusters.boxes[0];
+        ok = (box.x0 <= x && x <= box.x1 && box.y0 <= y && y <= box.y1);
+      }
+    }
+    std::cout << "Light just in front of the near plane: " << (ok ? "binned into every tile it reaches." : "MISSING from tiles it reaches!") << std::endl;
+  }
+}
@@ -3,6 +3,7 @@
 #include "Mode.hpp"
 #include "RollLevel.hpp"
 #include "DrawLines.hpp"
+#include "DynamicResolution.hpp"
 
 #include <memory>
 
@@ -18,6 +19,10 @@ struct RollMode : Mode {
 	void restart();
 	RollLevel level;
   bool display_text = true;
+  bool report_draw_stats = false; //print level.stats after the next draw
+  DynamicResolution dynamic_resolution; //picks level.resolution_scale
+  //time LightClusters::build with a few hundred to a few thousand synthetic lights around the player:
+  void benchmark_light_binning();
 
 	//Current control signals:
 	struct {
@@ -1,11 +1,19 @@
 #include "Scene.hpp"
 
 #include "gl_errors.hpp"
-#include "read_write_chunk.hpp"
+#include "ChunkFile.hpp"
+#include "ImpostorCache.hpp"
+#include "OcclusionBuffer.hpp"
+#include "RenderTargets.hpp"
 
 #include <glm/gtc/type_ptr.hpp>
 
-#include <fstream>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <cstddef>
+#include <limits>
+#include <tuple>
 
 //-------------------------
 
@@ -69,6 +77,186 @@ glm::mat4 Scene::Camera::make_projection() const {
 
 //-------------------------
 
+//Sort key layout (most significant first):
+// [program:12][vao:12][texture0:16][depth:24]
+//Name collisions in the truncated fields only cost a redundant bind, since submission compares actual state.
+static uint64_t make_sort_key(GLuint program, GLuint vao, GLuint texture0, float depth) {
+  //non-negative IEEE floats sort the same way as their bit patterns:
+  depth = std::max(depth, 0.0f);
+  uint32_t depth_bits;
+  static_assert(sizeof(depth_bits) == sizeof(depth), "float is 32 bits");
+  std::memcpy(&depth_bits, &depth, sizeof(depth_bits));
+
+  return (uint64_t(program & 0xfff) << 52)
+       | (uint64_t(vao & 0xfff) << 40)
+       | (uint64_t(texture0 & 0xffff) << 24)
+       | uint64_t(depth_bits >> 8);
+}
+
+//Check if an (object-space) box is entirely outside one of the clipping planes:
+static bool outside_frustum(glm::mat4 const &object_to_clip, glm::vec3 const &min, glm::vec3 const &max) {
+  glm::vec4 corners[8];
+  for (uint32_t i = 0; i < 8; ++i) {
+    corners[i] = object_to_clip * glm::vec4(
+      (i & 1 ? max.x : min.x),
+      (i & 2 ? max.y : min.y),
+      (i & 4 ? max.z : min.z),
+      1.0f
+    );
+  }
+  //clip-space planes are -w <= x,y,z <= w:
+  for (uint32_t axis = 0; axis < 3; ++axis) {
+    bool all_below = true;
+    bool all_above = true;
+    for (auto const &c : corners) {
+      if (c[axis] >= -c.w) all_below = false;
+      if (c[axis] <= c.w) all_above = false;
+    }
+    if (all_below || all_above) return true;
+  }
+  return false;
+}
+
+//Size of a box's screen-space bounds as a fraction of the screen (in whichever direction is larger);
+// boxes reaching behind the camera count as filling the screen:
+static float projected_size(glm::mat4 const &object_to_clip, glm::vec3 const &min, glm::vec3 const &max) {
+  glm::vec2 lo = glm::vec2( std::numeric_limits< float >::infinity());
+  glm::vec2 hi = glm::vec2(-std::numeric_limits< float >::infinity());
+  for (uint32_t i = 0; i < 8; ++i) {
+    glm::vec4 corner = object_to_clip * glm::vec4(
+      (i & 1 ? max.x : min.x),
+      (i & 2 ? max.y : min.y),
+      (i & 4 ? max.z : min.z),
+      1.0f
+    );
+    if (corner.w < 1e-3f) return 1.0f;
+    glm::vec2 ndc = glm::vec2(corner) / corner.w;
+    lo = glm::min(lo, ndc);
+    hi = glm::max(hi, ndc);
+  }
+  //(normalized device coordinates span [-1,1]):
+  return 0.5f * std::max(hi.x - lo.x, hi.y - lo.y);
+}
+
+//Drawables can share an instanced draw if everything but their per-object data matches:
+static auto instance_batch_tie(Scene::QueueEntry const &e) {
+  Scene::Drawable::Pipeline const &p = e.drawable->pipeline;
+  return std::make_tuple(p.instanced.program, p.instanced.vao, p.type, p.index_type, e.start, e.count,
+    p.textures[0].texture, p.textures[1].texture, p.textures[2].texture, p.textures[3].texture,
+    p.textures[0].target, p.textures[1].target, p.textures[2].target, p.textures[3].target);
+}
+static_assert(Scene::Drawable::Pipeline::TextureCount == 4, "instance_batch_tie covers all textures");
+
+GLuint Scene::instance_buffer = 0;
+
+std::set< GLuint > Scene::link_instance_attribs(GLuint program) {
+  if (instance_buffer == 0) {
+    glGenBuffers(1, &instance_buffer);
+    //buffer is (re-)filled during draw()
+  }
+
+  std::set< GLuint > bound;
+  glBindBuffer(GL_ARRAY_BUFFER, instance_buffer);
+  auto link = [&](char const *name, GLint size, size_t offset) {
+    GLint location = glGetAttribLocation(program, name);
+    if (location == -1) return; //program doesn't use this attribute
+    glVertexAttribPointer(location, size, GL_FLOAT, GL_FALSE, sizeof(Instance), (GLbyte *)0 + offset);
+    glVertexAttribDivisor(location, 1); //advance once per instance, not per vertex
+    glEnableVertexAttribArray(location);
+    bound.insert(location);
+  };
+  link("InstanceToWorld0", 4, offsetof(Instance, object_to_world) + 0 * sizeof(glm::vec4));
+  link("InstanceToWorld1", 4, offsetof(Instance, object_to_world) + 1 * sizeof(glm::vec4));
+  link("InstanceToWorld2", 4, offsetof(Instance, object_to_world) + 2 * sizeof(glm::vec4));
+  link("InstanceNormal0", 3, offsetof(Instance, normal_to_light) + 0 * sizeof(glm::vec3));
+  link("InstanceNormal1", 3, offsetof(Instance, normal_to_light) + 1 * sizeof(glm::vec3));
+  link("InstanceNormal2", 3, offsetof(Instance, normal_to_light) + 2 * sizeof(glm::vec3));
+  link("InstanceColor", 4, offsetof(Instance, custom_col));
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+  return bound;
+}
+
+Scene::MaterialLayout::MaterialLayout(GLuint program, std::initializer_list< Param > const &params_) {
+  if (params_.size() > MaxParams) {
+    throw std::runtime_error("Material layout has " + std::to_string(params_.size()) + " parameters, more than the " + std::to_string(MaxParams) + " allowed.");
+  }
+  uint32_t offset = 0;
+  for (auto const &param : params_) {
+    params[count] = param;
+    locations[count] = glGetUniformLocation(program, param.name);
+    offsets[count] = uint8_t(offset);
+    offset += (param.type == Int ? 1 : uint32_t(param.type));
+    if (offset > MaxValues) {
+      throw std::runtime_error("Material layout parameter '" + std::string(param.name) + "' doesn't fit in " + std::to_string(MaxValues) + " values.");
+    }
+    count += 1;
+  }
+}
+
+void Scene::Material::set(uint32_t param, float value) {
+  assert(layout && param < layout->count && layout->params[param].type == MaterialLayout::Float);
+  values[layout->offsets[param]] = value;
+}
+
+void Scene::Material::set(uint32_t param, glm::vec2 const &value) {
+  assert(layout && param < layout->count && layout->params[param].type == MaterialLayout::Vec2);
+  std::memcpy(values + layout->offsets[param], &value, sizeof(value));
+}
+
+void Scene::Material::set(uint32_t param, glm::vec3 const &value) {
+  assert(layout && param < layout->count && layout->params[param].type == MaterialLayout::Vec3);
+  std::memcpy(values + layout->offsets[param], &value, sizeof(value));
+}
+
+void Scene::Material::set(uint32_t param, glm::vec4 const &value) {
+  assert(layout && param < layout->count && layout->params[param].type == MaterialLayout::Vec4);
+  std::memcpy(values + layout->offsets[param], &value, sizeof(value));
+}
+
+void Scene::Material::set(uint32_t param, int32_t value) {
+  assert(layout && param < layout->count && layout->params[param].type == MaterialLayout::Int);
+  std::memcpy(values + layout->offsets[param], &value, sizeof(value));
+}
+
+void Scene::Material::apply(RenderCommands &commands) const {
+  assert(layout);
+  for (uint32_t i = 0; i < layout->count; ++i) {
+    GLint location = layout->locations[i];
+    if (location == -1) continue;
+    float const *v = values + layout->offsets[i];
+    //(Int values are stored bit-for-bit, so all types can be copied as floats)
+    switch (layout->params[i].type) {
+      case MaterialLayout::Float: commands.add(RenderCommands::Uniform{ location, RenderCommands::Uniform::Float }, v, 1 * sizeof(float)); break;
+      case MaterialLayout::Vec2: commands.add(RenderCommands::Uniform{ location, RenderCommands::Uniform::Vec2 }, v, 2 * sizeof(float)); break;
+      case MaterialLayout::Vec3: commands.add(RenderCommands::Uniform{ location, RenderCommands::Uniform::Vec3 }, v, 3 * sizeof(float)); break;
+      case MaterialLayout::Vec4: commands.add(RenderCommands::Uniform{ location, RenderCommands::Uniform::Vec4 }, v, 4 * sizeof(float)); break;
+      case MaterialLayout::Int: commands.add(RenderCommands::Uniform{ location, RenderCommands::Uniform::Int }, v, sizeof(int32_t)); break;
+    }
+  }
+}
+
+glm::vec4 *Scene::make_custom_col(glm::vec4 const &value) {
+  custom_cols->emplace_back(value);
+  return &custom_cols->back();
+}
+
+void Scene::bind_uniform_blocks(GLuint program) {
+  GLuint frame = glGetUniformBlockIndex(program, "Frame");
+  if (frame != GL_INVALID_INDEX) glUniformBlockBinding(program, frame, FrameBinding);
+  GLuint object = glGetUniformBlockIndex(program, "Object");
+  if (object != GL_INVALID_INDEX) glUniformBlockBinding(program, object, ObjectBinding);
+}
+
+//uniform buffers shared by all scenes:
+static GLuint frame_uniform_buffer = 0;
+//per-object blocks are appended to a ring buffer; when it fills up, its storage is orphaned and
+// writing restarts at the front, so ranges the GPU may still be reading are never overwritten:
+static GLuint object_ring_buffer = 0;
+static GLsizeiptr object_ring_size = 0;
+static GLintptr object_ring_head = 0;
+static GLsizeiptr object_stride = 0; //sizeof(ObjectUniforms) rounded up to GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT
+
 void Scene::draw(glm::uvec2 drawable_size, Camera const &camera) const {
   assert(camera.transform);
   glm::mat4 world_to_clip = camera.make_projection() * camera.transform->make_world_to_local();
@@ -76,13 +264,79 @@ void Scene::draw(glm::uvec2 drawable_size, Camera const &camera) const {
   draw(drawable_size, world_to_clip, world_to_light);
 }
 
+//first pass: color, bright color (input to bloom), depth:
+static RenderTargets::Format make_first_pass_format() {
+  RenderTargets::Format format;
+  format.colors[0] = GL_RGBA8;
+  format.colors[1] = GL_RGBA8;
+  format.depth = GL_DEPTH_COMPONENT24;
+  return format;
+}
+static RenderTargets::Format const first_pass_format = make_first_pass_format();
+
+//bloom levels accumulate several layers of bright color, so need more than 8-bit range:
+static RenderTargets::Format make_bloom_format() {
+  RenderTargets::Format format;
+  format.colors[0] = GL_R11F_G11F_B10F;
+  return format;
+}
+static RenderTargets::Format const bloom_format = make_bloom_format();
+
 void Scene::draw(glm::uvec2 drawable_size, glm::mat4 const &world_to_clip, glm::mat4x3 const &world_to_light) const {
 
-  glBindFramebuffer(GL_FRAMEBUFFER, firstpass_fbo);
-  glViewport(0, 0, drawable_size.x, drawable_size.y);
-  glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+  //with post processing, the first pass is drawn offscreen (possibly at reduced resolution):
+  RenderTargets::Target *first_pass = nullptr;
+  if (post_processing_program != 0) {
+    glm::uvec2 render_size = glm::max(glm::uvec2(glm::round(glm::vec2(drawable_size) * resolution_scale)), glm::uvec2(1));
+    first_pass = &render_targets.acquire(render_size, first_pass_format);
+    glBindFramebuffer(GL_FRAMEBUFFER, first_pass->framebuffer);
+    glViewport(0, 0, render_size.x, render_size.y);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+  }
+  first_pass_timer.begin();
+
+  stats = DrawStats();
+
+  //Rasterize the largest occluders on screen, so the gather loop can skip what they hide:
+  bool test_occlusion = false;
+  if (occlusion_culling && !occluders.empty()) {
+    if (!occlusion_buffer) occlusion_buffer = std::make_shared< OcclusionBuffer >();
+    OcclusionBuffer &buffer = *occlusion_buffer;
+    buffer.clear(world_to_clip);
+
+    float screen = float(buffer.size.x) * float(buffer.size.y);
+    occluder_candidates.clear();
+    for (auto const &occluder : occluders) {
+      assert(occluder.transform);
+      glm::mat4 object_to_clip = world_to_clip * occluder.transform->make_local_to_world();
+      float area = buffer.screen_area(object_to_clip, occluder.min, occluder.max);
+      if (area >= min_occluder_area * screen) occluder_candidates.emplace_back(area, &occluder);
+    }
+    auto largest = occluder_candidates.begin() + std::min< size_t >(max_occluders, occluder_candidates.size());
+    std::partial_sort(occluder_candidates.begin(), largest, occluder_candidates.end(),
+      [](std::pair< float, Occluder const * > const &a, std::pair< float, Occluder const * > const &b) {
+        return a.first > b.first;
+      });
+    for (auto c = occluder_candidates.begin(); c != largest; ++c) {
+      Occluder const &occluder = *c->second;
+      buffer.add_occluder(occluder.transform->make_local_to_world(), occluder.positions, occluder.count);
+    }
+    buffer.finish();
+    test_occlusion = (buffer.stats.triangles != 0);
+  }
+
+  //Impostors need the camera position, which (for perspective projections) is where clip-space (0,0,1,0) comes from:
+  glm::vec4 eye = glm::inverse(world_to_clip) * glm::vec4(0.0f, 0.0f, 1.0f, 0.0f);
+  bool use_impostors = draw_impostors && impostor_program != 0 && std::abs(eye.w) > 1e-6f;
+  if (use_impostors) {
+    eye /= eye.w;
+    if (!impostor_cache) impostor_cache = std::make_shared< ImpostorCache >();
+  }
 
-  //Iterate through all drawables, sending each one to OpenGL:
+  //Gather all drawables into the render queue, computing their sort keys:
+  render_queue.clear();
+  instance_candidates.clear();
+  instances.clear();
   for (auto const &drawable : drawables) {
     //Reference to drawable's pipeline for convenience:
     Scene::Drawable::Pipeline const &pipeline = drawable.pipeline;
@@ -90,117 +344,485 @@ void Scene::draw(glm::uvec2 drawable_size, glm::mat4 const &world_to_clip, glm::
     //skip any drawables without a shader program set:
     if (pipeline.program == 0) continue;
     //skip any drawables that don't contain any vertices:
-    if (pipeline.count == 0) continue;
+    if (pipeline.count == 0 && drawable.lod_count == 0) continue;
 
+    assert(drawable.transform); //drawables *must* have a transform
+    glm::mat4 object_to_world = drawable.transform->make_local_to_world();
+    glm::mat4 object_to_clip = world_to_clip * object_to_world;
 
-    //Set shader program:
-    glUseProgram(pipeline.program);
+    if (drawable.has_bounds) {
+      //skip drawables that are entirely out of view:
+      if (outside_frustum(object_to_clip, drawable.min, drawable.max)) {
+        stats.culled += 1;
+        continue;
+      }
+      //skip drawables that are hidden behind occluders:
+      if (test_occlusion && occlusion_buffer->occluded(object_to_clip, drawable.min, drawable.max)) {
+        stats.occluded += 1;
+        continue;
+      }
+    }
 
-    //Set attribute sources:
-    glBindVertexArray(pipeline.vao);
+    //far-away static drawables are drawn as impostors (once their picture from this direction is ready):
+    if (use_impostors && impostor_cache->use(drawable, object_to_world, glm::vec3(eye), impostor_distance)) {
+      stats.impostors += 1;
+      continue;
+    }
 
-    //Configure program uniforms:
+    //pick a level of detail from the drawable's size on screen, moving only once it is well past a threshold:
+    uint32_t lod = 0;
+    if (lod_selection && drawable.has_bounds && drawable.lod_count != 0) {
+      assert(drawable.lod_count <= Drawable::MaxLods);
+      float size = projected_size(object_to_clip, drawable.min, drawable.max);
+      lod = std::min(drawable.lod, drawable.lod_count);
+      while (lod < drawable.lod_count && size < lod_sizes[lod] * (1.0f - lod_hysteresis)) ++lod;
+      while (lod > 0 && size > lod_sizes[lod - 1] * (1.0f + lod_hysteresis)) --lod;
+    }
+    drawable.lod = lod;
+    if (lod != 0) stats.coarse_lods += 1;
+    GLuint start = (lod == 0 ? pipeline.start : drawable.lods[lod - 1].start);
+    GLuint count = (lod == 0 ? pipeline.count : drawable.lods[lod - 1].count);
+    if (count == 0) continue;
+
+    //clip-space w of the object's origin is its distance along the view direction:
+    float depth = glm::dot(glm::vec4(world_to_clip[0][3], world_to_clip[1][3], world_to_clip[2][3], world_to_clip[3][3]), object_to_world[3]);
+
+    QueueEntry entry{ make_sort_key(pipeline.program, pipeline.vao, pipeline.textures[0].texture, depth), &drawable, object_to_world, depth };
+    entry.start = start;
+    entry.count = count;
+    if (pipeline.instanced.program != 0 && pipeline.instanced.vao != 0 && pipeline.material.layout == nullptr) {
+      instance_candidates.emplace_back(entry);
+    } else {
+      render_queue.emplace_back(entry);
+    }
 
-    //the object-to-world matrix is used in all three of these uniforms:
-    assert(drawable.transform); //drawables *must* have a transform
-    glm::mat4 object_to_world = drawable.transform->make_local_to_world();
+    //the unsorted path bound program + vao, then bound and un-bound every texture:
+    stats.unsorted_state_changes += 2;
+    for (uint32_t i = 0; i < Drawable::Pipeline::TextureCount; ++i) {
+      if (pipeline.textures[i].texture != 0) stats.unsorted_state_changes += 2;
+    }
+  }
+
+  //Group instancing candidates that share a pipeline and mesh range into instanced entries:
+  std::sort(instance_candidates.begin(), instance_candidates.end(), [](QueueEntry const &a, QueueEntry const &b) {
+    auto ta = instance_batch_tie(a);
+    auto tb = instance_batch_tie(b);
+    if (ta != tb) return ta < tb;
+    return a.depth < b.depth;
+  });
+  for (auto begin = instance_candidates.begin(); begin != instance_candidates.end(); /* later */) {
+    auto end = begin + 1;
+    while (end != instance_candidates.end() && instance_batch_tie(*end) == instance_batch_tie(*begin)) {
+      ++end;
+    }
 
-    //OBJECT_TO_CLIP takes vertices from object space to clip space:
-    if (pipeline.OBJECT_TO_CLIP_mat4 != -1U) {
-      glm::mat4 object_to_clip = world_to_clip * object_to_world;
-      glUniformMatrix4fv(pipeline.OBJECT_TO_CLIP_mat4, 1, GL_FALSE, glm::value_ptr(object_to_clip));
+    if (end - begin == 1) {
+      //nothing to share a draw with, so draw normally:
+      render_queue.emplace_back(*begin);
+    } else {
+      //'begin' is the nearest member of the batch, so the batch sorts by it:
+      Scene::Drawable::Pipeline const &pipeline = begin->drawable->pipeline;
+      QueueEntry batch = *begin;
+      batch.key = make_sort_key(pipeline.instanced.program, pipeline.instanced.vao, pipeline.textures[0].texture, begin->depth);
+      batch.instance_begin = uint32_t(instances.size());
+      batch.instance_count = uint32_t(end - begin);
+      for (auto c = begin; c != end; ++c) {
+        glm::mat4 const &object_to_world = c->object_to_world;
+        glm::mat4 position_to_world = object_to_world * c->drawable->pipeline.position_to_object(); //(normals don't get this)
+        instances.emplace_back();
+        Instance &instance = instances.back();
+        for (uint32_t r = 0; r < 3; ++r) {
+          instance.object_to_world[r] = glm::vec4(position_to_world[0][r], position_to_world[1][r], position_to_world[2][r], position_to_world[3][r]);
+        }
+        glm::mat3 normal_to_light = glm::inverse(glm::transpose(glm::mat3(world_to_light * object_to_world)));
+        for (uint32_t col = 0; col < 3; ++col) {
+          instance.normal_to_light[col] = normal_to_light[col];
+        }
+        instance.custom_col = (c->drawable->custom_col ? *c->drawable->custom_col : glm::vec4(1.0f, 0.0f, 1.0f, 1.0f));
+      }
+      render_queue.emplace_back(batch);
     }
 
-    //the object-to-light matrix is used in the next two uniforms:
-    glm::mat4x3 object_to_light = world_to_light * object_to_world;
+    begin = end;
+  }
+
+  std::sort(render_queue.begin(), render_queue.end(), [](QueueEntry const &a, QueueEntry const &b) {
+    return a.key < b.key;
+  });
+
+  //Write the per-frame block, then every queued drawable's per-object block in one mapped range:
+  if (frame_uniform_buffer == 0) {
+    glGenBuffers(1, &frame_uniform_buffer);
+    glGenBuffers(1, &object_ring_buffer);
+    GLint alignment = 256;
+    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+    object_stride = (GLsizeiptr(sizeof(ObjectUniforms)) + alignment - 1) / alignment * alignment;
+  }
+
+  FrameUniforms frame;
+  frame.world_to_clip = world_to_clip;
+  for (uint32_t col = 0; col < 4; ++col) {
+    frame.world_to_light[col] = glm::vec4(world_to_light[col], 0.0f);
+  }
+  frame.fog_color = glm::vec4(fog_color, 1.0f);
+  frame.fog_range = glm::vec4(fog_range, 0.0f, 0.0f);
+  frame.cluster_scale = glm::vec4(0.0f);
+  frame.cluster_counts = glm::uvec4(0);
+
+  //Bin point lamps into the light grid:
+  bool use_clusters = false;
+  if (clustered_lights && !lamps.empty()) {
+    cluster_lights.clear();
+    for (auto const &lamp : lamps) {
+      if (lamp.type != Lamp::Point || lamp.energy == glm::vec3(0.0f)) continue;
+      LightClusters::Light light;
+      light.position = glm::vec3(lamp.transform->make_local_to_world()[3]);
+      light.radius = lamp.distance;
+      light.color = lamp.energy;
+      cluster_lights.emplace_back(light);
+    }
+    if (!light_clusters) light_clusters = std::make_shared< LightClusters >();
+    light_clusters->build(world_to_clip, cluster_lights);
+    light_clusters->upload();
+    light_clusters->bind();
+    use_clusters = true;
+    frame.cluster_scale = light_clusters->cluster_scale(first_pass ? first_pass->size : drawable_size);
+    frame.cluster_counts = glm::uvec4(LightClusters::TilesX, LightClusters::TilesY, LightClusters::Slices, light_clusters->stats.lights);
+  }
+
+  //render impostor pictures requested while gathering (this uses the uniform block bindings, so goes first):
+  if (use_impostors) impostor_cache->refresh(frame);
+
+  //the color pass restores these after drawing pre-passed entries with GL_EQUAL depth testing:
+  GLint depth_func = GL_LESS;
+  GLboolean depth_mask = GL_TRUE;
+  glGetIntegerv(GL_DEPTH_FUNC, &depth_func);
+  glGetBooleanv(GL_DEPTH_WRITEMASK, &depth_mask);
 
-    //OBJECT_TO_CLIP takes vertices from object space to light space:
-    if (pipeline.OBJECT_TO_LIGHT_mat4x3 != -1U) {
-      glUniformMatrix4x3fv(pipeline.OBJECT_TO_LIGHT_mat4x3, 1, GL_FALSE, glm::value_ptr(object_to_light));
+  //The rest of the first pass is recorded (without touching GL) and then executed in one go:
+  commands.clear();
+  commands.add(RenderCommands::BufferData{ GL_UNIFORM_BUFFER, frame_uniform_buffer, GL_STREAM_DRAW, GLsizeiptr(sizeof(frame)) }, &frame, sizeof(frame));
+  commands.add(RenderCommands::BindBufferBase{ GL_UNIFORM_BUFFER, FrameBinding, frame_uniform_buffer });
+
+  GLsizeiptr object_bytes = 0;
+  for (auto const &entry : render_queue) {
+    if (entry.instance_count == 0 && entry.drawable->pipeline.uniform_blocks) object_bytes += object_stride;
+  }
+  if (object_bytes != 0) {
+    if (object_bytes > object_ring_size) {
+      //grow (which also orphans the old storage):
+      object_ring_size = std::max< GLsizeiptr >(object_ring_size, 1 << 20);
+      while (object_ring_size < object_bytes) object_ring_size *= 2;
+      commands.add(RenderCommands::BufferData{ GL_UNIFORM_BUFFER, object_ring_buffer, GL_STREAM_DRAW, object_ring_size });
+      object_ring_head = 0;
+    } else if (object_ring_head + object_bytes > object_ring_size) {
+      //wrap around (orphaning what the GPU may still be reading):
+      commands.add(RenderCommands::BufferData{ GL_UNIFORM_BUFFER, object_ring_buffer, GL_STREAM_DRAW, object_ring_size });
+      object_ring_head = 0;
     }
+    //(the blocks are written straight into the command's data; padding between them is zeroed so dumps are repeatable)
+    char *mapped = reinterpret_cast< char * >(commands.add_space(RenderCommands::WriteBuffer{ GL_UNIFORM_BUFFER, object_ring_buffer, object_ring_head }, object_bytes));
+    std::memset(mapped, 0, object_bytes);
+
+    GLintptr offset = 0;
+    for (auto &entry : render_queue) {
+      Drawable::Pipeline const &pipeline = entry.drawable->pipeline;
+      if (entry.instance_count != 0 || !pipeline.uniform_blocks) continue;
 
-    //NORMAL_TO_CLIP takes normals from object space to light space:
-    if (pipeline.NORMAL_TO_LIGHT_mat3 != -1U) {
+      glm::mat4x3 object_to_light = world_to_light * entry.object_to_world;
       glm::mat3 normal_to_light = glm::inverse(glm::transpose(glm::mat3(object_to_light)));
-      glUniformMatrix3fv(pipeline.NORMAL_TO_LIGHT_mat3, 1, GL_FALSE, glm::value_ptr(normal_to_light));
+      //(positions may be quantized; normals aren't affected by that)
+      glm::mat4 position_to_world = entry.object_to_world * pipeline.position_to_object();
+      glm::mat4x3 position_to_light = world_to_light * position_to_world;
+
+      ObjectUniforms object;
+      object.object_to_clip = world_to_clip * position_to_world;
+      for (uint32_t col = 0; col < 4; ++col) {
+        object.object_to_light[col] = glm::vec4(position_to_light[col], 0.0f);
+      }
+      for (uint32_t col = 0; col < 3; ++col) {
+        object.normal_to_light[col] = glm::vec4(normal_to_light[col], 0.0f);
+      }
+      object.custom_col = (entry.drawable->custom_col ? *entry.drawable->custom_col : glm::vec4(1.0f, 0.0f, 1.0f, 1.0f));
+      std::memcpy(mapped + offset, &object, sizeof(object));
+
+      entry.object_offset = object_ring_head + offset;
+      offset += object_stride;
     }
+    object_ring_head += object_bytes;
+  }
 
-    //set any requested custom uniforms:
-    if (pipeline.set_uniforms) pipeline.set_uniforms();
+  //Submit the sorted queue, only changing state when it differs from what is already bound:
+  GLuint bound_program = 0;
+  GLuint bound_vao = 0;
+  Drawable::Pipeline::TextureInfo bound_textures[Drawable::Pipeline::TextureCount];
 
-    //set up textures:
+  auto use_program = [&](GLuint program) {
+    if (program != bound_program) {
+      commands.add(RenderCommands::UseProgram{ program });
+      bound_program = program;
+      stats.program_binds += 1;
+    }
+  };
+  auto bind_vao = [&](GLuint vao) {
+    if (vao != bound_vao) {
+      commands.add(RenderCommands::BindVertexArray{ vao });
+      bound_vao = vao;
+      stats.vao_binds += 1;
+    }
+  };
+  auto bind_textures = [&](Drawable::Pipeline const &pipeline) {
     for (uint32_t i = 0; i < Drawable::Pipeline::TextureCount; ++i) {
-      if (pipeline.textures[i].texture != 0) {
-        glActiveTexture(GL_TEXTURE0 + i);
-        glBindTexture(pipeline.textures[i].target, pipeline.textures[i].texture);
+      Drawable::Pipeline::TextureInfo const &want = pipeline.textures[i];
+      Drawable::Pipeline::TextureInfo &have = bound_textures[i];
+      if (want.texture == 0) continue;
+      if (want.texture == have.texture && want.target == have.target) continue;
+      if (have.texture != 0 && have.target != want.target) {
+        commands.add(RenderCommands::BindTexture{ i, have.target, 0 });
+        stats.texture_binds += 1;
       }
+      commands.add(RenderCommands::BindTexture{ i, want.target, want.texture });
+      have = want;
+      stats.texture_binds += 1;
     }
+  };
 
-    //draw the object:
-    glDrawArrays(pipeline.type, pipeline.start, pipeline.count);
+  //Draw one entry; 'depth_only' draws with the pipeline's depth program, skipping textures and material:
+  auto submit = [&](QueueEntry const &entry, bool depth_only) {
+    Scene::Drawable const &drawable = *entry.drawable;
+    Scene::Drawable::Pipeline const &pipeline = drawable.pipeline;
 
-    //un-bind textures:
-    for (uint32_t i = 0; i < Drawable::Pipeline::TextureCount; ++i) {
-      if (pipeline.textures[i].texture != 0) {
-        glActiveTexture(GL_TEXTURE0 + i);
-        glBindTexture(pipeline.textures[i].target, 0);
+    if (entry.instance_count != 0) {
+      //---- instanced draw ----
+      use_program(depth_only ? pipeline.instanced.depth_program : pipeline.instanced.program);
+      bind_vao(pipeline.instanced.vao);
+
+      //upload this batch's instances (orphaning the previous contents):
+      GLsizeiptr bytes = entry.instance_count * sizeof(Instance);
+      commands.add(RenderCommands::BufferData{ GL_ARRAY_BUFFER, instance_buffer, GL_STREAM_DRAW, bytes }, instances.data() + entry.instance_begin, bytes);
+
+      if (!depth_only) bind_textures(pipeline);
+
+      if (pipeline.index_type != 0) {
+        commands.add(RenderCommands::DrawElementsInstanced{ pipeline.type, pipeline.index_type, entry.start, GLsizei(entry.count), GLsizei(entry.instance_count) });
+      } else {
+        commands.add(RenderCommands::DrawArraysInstanced{ pipeline.type, GLint(entry.start), GLsizei(entry.count), GLsizei(entry.instance_count) });
       }
+      stats.draw_calls += 1;
+      if (pipeline.type == GL_TRIANGLES) stats.triangles += entry.count / 3 * entry.instance_count;
+      stats.instanced_draw_calls += 1;
+      if (!depth_only) stats.drawables += entry.instance_count;
+      return;
     }
-    glActiveTexture(GL_TEXTURE0);
 
+    //---- ordinary draw ----
+
+    //Set shader program:
+    use_program(depth_only ? pipeline.depth_program : pipeline.program);
+
+    //Set attribute sources:
+    bind_vao(pipeline.vao);
+
+    //Configure program uniforms:
+    if (pipeline.uniform_blocks) {
+      //per-object data was already written to the ring buffer, so just point the "Object" block at it:
+      commands.add(RenderCommands::BindBufferRange{ GL_UNIFORM_BUFFER, ObjectBinding, object_ring_buffer, entry.object_offset, GLsizeiptr(sizeof(ObjectUniforms)) });
+    } else {
+      //(depth programs are only supported with uniform blocks)
+      assert(!depth_only);
+
+      //the object-to-world matrix is used in all three of these uniforms:
+      glm::mat4 const &object_to_world = entry.object_to_world;
+
+      //(positions may be quantized, in which case they take a detour through object space first:)
+      glm::mat4 position_to_world = object_to_world * pipeline.position_to_object();
+
+      //OBJECT_TO_CLIP takes vertices from object space to clip space:
+      if (pipeline.OBJECT_TO_CLIP_mat4 != -1U) {
+        glm::mat4 object_to_clip = world_to_clip * position_to_world;
+        commands.uniform(pipeline.OBJECT_TO_CLIP_mat4, object_to_clip);
+      }
+
+      //the object-to-light matrix is used in the next two uniforms:
+      glm::mat4x3 object_to_light = world_to_light * object_to_world;
+
+      //OBJECT_TO_CLIP takes vertices from object space to light space:
+      if (pipeline.OBJECT_TO_LIGHT_mat4x3 != -1U) {
+        glm::mat4x3 position_to_light = world_to_light * position_to_world;
+        commands.uniform(pipeline.OBJECT_TO_LIGHT_mat4x3, position_to_light);
+      }
+
+      //NORMAL_TO_CLIP takes normals from object space to light space:
+      if (pipeline.NORMAL_TO_LIGHT_mat3 != -1U) {
+        glm::mat3 normal_to_light = glm::inverse(glm::transpose(glm::mat3(object_to_light)));
+        commands.uniform(pipeline.NORMAL_TO_LIGHT_mat3, normal_to_light);
+      }
+    }
+
+    if (!depth_only) {
+      //set any per-drawable material parameters:
+      if (pipeline.material.layout) pipeline.material.apply(commands);
+
+      //set up textures (leaving already-bound ones alone):
+      bind_textures(pipeline);
+    }
+
+    //draw the object:
+    if (pipeline.index_type != 0) {
+      commands.add(RenderCommands::DrawElements{ pipeline.type, pipeline.index_type, entry.start, GLsizei(entry.count) });
+    } else {
+      commands.add(RenderCommands::DrawArrays{ pipeline.type, GLint(entry.start), GLsizei(entry.count) });
+    }
+    stats.draw_calls += 1;
+    if (pipeline.type == GL_TRIANGLES) stats.triangles += entry.count / 3;
+    if (!depth_only) stats.drawables += 1;
+  };
+
+  auto has_depth_program = [](QueueEntry const &entry) {
+    Scene::Drawable::Pipeline const &pipeline = entry.drawable->pipeline;
+    if (entry.instance_count != 0) return pipeline.instanced.depth_program != 0;
+    else return pipeline.depth_program != 0 && pipeline.uniform_blocks;
+  };
+
+  if (depth_prepass) {
+    //---- depth pre-pass: lay down depth front-to-back, so the color pass only shades visible fragments ----
+    prepass_queue.clear();
+    for (auto const &entry : render_queue) {
+      if (has_depth_program(entry)) prepass_queue.emplace_back(&entry);
+    }
+    std::sort(prepass_queue.begin(), prepass_queue.end(), [](QueueEntry const *a, QueueEntry const *b) {
+      return a->depth < b->depth;
+    });
+    commands.add(RenderCommands::ColorMask{ GL_FALSE });
+    for (QueueEntry const *entry : prepass_queue) {
+      submit(*entry, true);
+      stats.prepass_draw_calls += 1;
+    }
+    commands.add(RenderCommands::ColorMask{ GL_TRUE });
+  }
+
+  //---- color pass ----
+  //(entries already in the depth buffer only pass where their depth is exactly equal)
+  bool equal_test = false;
+  for (auto const &entry : render_queue) {
+    bool prepassed = depth_prepass && has_depth_program(entry);
+    if (prepassed != equal_test) {
+      equal_test = prepassed;
+      commands.add(RenderCommands::DepthFunc{ equal_test ? GLenum(GL_EQUAL) : GLenum(depth_func) });
+      commands.add(RenderCommands::DepthMask{ equal_test ? GLboolean(GL_FALSE) : depth_mask });
+    }
+    submit(entry, false);
+  }
+  if (equal_test) {
+    commands.add(RenderCommands::DepthFunc{ GLenum(depth_func) });
+    commands.add(RenderCommands::DepthMask{ depth_mask });
+  }
+
+  //un-bind textures:
+  for (uint32_t i = 0; i < Drawable::Pipeline::TextureCount; ++i) {
+    if (bound_textures[i].texture != 0) {
+      commands.add(RenderCommands::BindTexture{ i, bound_textures[i].target, 0 });
+      stats.texture_binds += 1;
+    }
+  }
+
+  commands.execute();
+
+  //all impostors in one draw:
+  if (use_impostors) {
+    uint32_t quads = impostor_cache->draw(impostor_program);
+    if (quads != 0) {
+      stats.draw_calls += 1;
+      stats.program_binds += 1;
+      stats.vao_binds += 1;
+      stats.texture_binds += 2;
+      stats.triangles += 2 * quads;
+    }
   }
 
+  if (use_clusters) light_clusters->unbind();
+
   glUseProgram(0);
   glBindVertexArray(0);
+  first_pass_timer.end();
   GL_ERRORS();
 
   if (post_processing_program != 0) {
+    assert(first_pass);
+    post_processing_timer.begin();
+
+    RenderTargets::Target *bloom[BloomLevels];
+    for (uint32_t i = 0; i < BloomLevels; ++i) {
+      glm::uvec2 above = (i == 0 ? first_pass->size : bloom[i-1]->size);
+      bloom[i] = &render_targets.acquire(glm::max((above + glm::uvec2(1)) / 2U, glm::uvec2(1)), bloom_format);
+    }
+
     glUseProgram(post_processing_program);
     glBindVertexArray(trivial_vao);
-    glBindBuffer(GL_ARRAY_BUFFER, trivial_vbo);
     glActiveTexture(GL_TEXTURE0);
-
-    bool horizontal = true, first_iteration = true;
-    int amount = 6;
-    for (unsigned int i = 0; i < amount; i++) {
-      glBindFramebuffer(GL_FRAMEBUFFER, pingpong_fbo[horizontal]); 
-      // set horizontal uniform
-      GLuint loc = glGetUniformLocation(post_processing_program, "TASK");
-      assert (loc != -1U);
-      glUniform1i(loc, (int)horizontal);
-      // bind input texture
-      glBindTexture(
-          GL_TEXTURE_2D, first_iteration ? colorBuffers[1] : pingpongBuffers[!horizontal]
-      ); 
+    GLint TASK = glGetUniformLocation(post_processing_program, "TASK");
+    assert(TASK != -1);
+
+    // ---- keep bright pixels (at half size), noting whether there were any:
+    static GLfloat const zero[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    glBindFramebuffer(GL_FRAMEBUFFER, bloom[0]->framebuffer);
+    glViewport(0, 0, bloom[0]->size.x, bloom[0]->size.y);
+    glClearBufferfv(GL_COLOR, 0, zero);
+    glUniform1i(TASK, 0);
+    glBindTexture(GL_TEXTURE_2D, first_pass->colors[1]);
+    glBeginQuery(GL_ANY_SAMPLES_PASSED, bright_query);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    glEndQuery(GL_ANY_SAMPLES_PASSED);
+
+    // ---- blur by downsampling then adding back up, but only if something was bright:
+    // (GL_QUERY_WAIT has the GPU -- not the CPU -- wait for the query result)
+    glBeginConditionalRender(bright_query, GL_QUERY_WAIT);
+    glUniform1i(TASK, 1);
+    for (uint32_t i = 1; i < BloomLevels; ++i) {
+      glBindFramebuffer(GL_FRAMEBUFFER, bloom[i]->framebuffer);
+      glViewport(0, 0, bloom[i]->size.x, bloom[i]->size.y);
+      glBindTexture(GL_TEXTURE_2D, bloom[i-1]->colors[0]);
+      glDrawArrays(GL_TRIANGLES, 0, 6);
+    }
+    glUniform1i(TASK, 2);
+    glEnable(GL_BLEND);
+    glBlendEquation(GL_FUNC_ADD);
+    glBlendFunc(GL_ONE, GL_ONE);
+    for (uint32_t i = BloomLevels - 1; i > 0; --i) {
+      glBindFramebuffer(GL_FRAMEBUFFER, bloom[i-1]->framebuffer);
+      glViewport(0, 0, bloom[i-1]->size.x, bloom[i-1]->size.y);
+      glBindTexture(GL_TEXTURE_2D, bloom[i]->colors[0]);
       glDrawArrays(GL_TRIANGLES, 0, 6);
-      horizontal = !horizontal;
-      if (first_iteration)
-        first_iteration = false;
     }
+    glDisable(GL_BLEND);
+    glEndConditionalRender();
 
-    // ---- draw to screen
+    // ---- draw to screen (scaling the first pass up to the drawable size, if it was drawn smaller)
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glViewport(0, 0, drawable_size.x, drawable_size.y);
     // set uniform so the shader draws the last pass
-    GLuint loc = glGetUniformLocation(post_processing_program, "TASK");
-    assert (loc != -1U);
-    glUniform1i(loc, 2);
-    // bind texture(s)
-    glUniform1i(glGetUniformLocation(post_processing_program, "IMG"), 0);
-    glUniform1i(glGetUniformLocation(post_processing_program, "FRAME"), 1);
-    glUniform1i(glGetUniformLocation(post_processing_program, "HIGHLIGHT"), 2);
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_2D, pingpongBuffers[1]);
+    glUniform1i(TASK, 3);
+    // bind texture(s) -- IMG is unit 0, FRAME is unit 1 (see BloomProgram)
+    glBindTexture(GL_TEXTURE_2D, bloom[0]->colors[0]);
     glActiveTexture(GL_TEXTURE1);
-    glBindTexture(GL_TEXTURE_2D, colorBuffers[0]);
-    glActiveTexture(GL_TEXTURE2);
-    glBindTexture(GL_TEXTURE_2D, colorBuffers[1]);
+    glBindTexture(GL_TEXTURE_2D, first_pass->colors[0]);
 
     glDrawArrays(GL_TRIANGLES, 0, 6);
-    GL_ERRORS();
 
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, 0);
     glBindVertexArray(0);
     glUseProgram(0);
+
+    post_processing_timer.end();
+    GL_ERRORS();
+
+    //done with the targets for this frame, so other passes may reuse them:
+    for (uint32_t i = 0; i < BloomLevels; ++i) {
+      render_targets.release(*bloom[i]);
+    }
+    render_targets.release(*first_pass);
   }
 
 }
@@ -208,36 +830,20 @@ void Scene::draw(glm::uvec2 drawable_size, glm::mat4 const &world_to_clip, glm::
 
 void Scene::load(std::string const &filename,
   std::function< void(Scene &, Transform *, std::string const &) > const &on_drawable) {
-  
-  // ------ generate framebuffer for first pass
-  glGenFramebuffers(1, &firstpass_fbo);
-  glBindFramebuffer(GL_FRAMEBUFFER, firstpass_fbo);
-
-  glGenTextures(2, colorBuffers);
-  for (GLuint i=0; i<2; i++) {
-    glBindTexture(GL_TEXTURE_2D, colorBuffers[i]);
-    glTexImage2D(
-      // ended up disabling high resolution draw so the program runs at a reasonable framerate...
-      GL_TEXTURE_2D, 0, GL_RGBA, 800, 540, 0, GL_RGBA, GL_FLOAT, NULL    
-    );
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    glFramebufferTexture2D(
-      GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0+i, GL_TEXTURE_2D, colorBuffers[i], 0    
-    );
-  }
-  // setup associated depth buffer
-  glGenRenderbuffers(1, &depthBuffer);
-  glBindRenderbuffer(GL_RENDERBUFFER, depthBuffer);
-  glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT, 800, 540);
-  glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depthBuffer);
-
-  glDrawBuffers(2, color_attachments);
-  glBindFramebuffer(GL_FRAMEBUFFER, 0);
-  assert(glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE);
+  //(ids are indices into the names seen so far)
+  std::vector< std::string > mesh_names;
+  load(filename, [&mesh_names](std::string const &name) {
+    mesh_names.emplace_back(name);
+    return uint32_t(mesh_names.size() - 1);
+  }, [&mesh_names,&on_drawable](Scene &scene, Transform *transform, uint32_t mesh) {
+    if (on_drawable) on_drawable(scene, transform, mesh_names[mesh]);
+  });
+}
 
+void Scene::load(std::string const &filename,
+  std::function< uint32_t(std::string const &) > const &resolve_mesh,
+  std::function< void(Scene &, Transform *, uint32_t) > const &on_drawable) {
+  
   // ------ set up 2nd pass pipeline
   glGenVertexArrays(1, &trivial_vao);
   glBindVertexArray(trivial_vao);
@@ -257,29 +863,14 @@ void Scene::load(std::string const &filename,
   glBindVertexArray(0);
   GL_ERRORS();
 
-  // ------ ping pong framebuffers for gaussian blur
-  glGenFramebuffers(2, pingpong_fbo);
-  glGenTextures(2, pingpongBuffers);
-  for (unsigned int i = 0; i < 2; i++) {
-    glBindFramebuffer(GL_FRAMEBUFFER, pingpong_fbo[i]);
-    glBindTexture(GL_TEXTURE_2D, pingpongBuffers[i]);
-    glTexImage2D(
-        GL_TEXTURE_2D, 0, GL_RGBA, 800, 540, 0, GL_RGBA, GL_FLOAT, NULL
-    );
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    glFramebufferTexture2D(
-        GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, pingpongBuffers[i], 0
-    );
-  }
+  // ------ bloom
+  glGenQueries(1, &bright_query);
+  GL_ERRORS();
 
   // ------
-  std::ifstream file(filename, std::ios::binary);
+  ChunkFile file(filename);
 
-  std::vector< char > names;
-  read_chunk(file, "str0", &names);
+  ChunkFile::Span< char > names = file.read< char >("str0");
 
   struct HierarchyEntry {
     uint32_t parent;
@@ -290,8 +881,7 @@ void Scene::load(std::string const &filename,
     glm::vec3 scale;
   };
   static_assert(sizeof(HierarchyEntry) == 4 + 4 + 4 + 4*3 + 4*4 + 4*3, "HierarchyEntry is packed.");
-  std::vector< HierarchyEntry > hierarchy;
-  read_chunk(file, "xfh0", &hierarchy);
+  ChunkFile::Span< HierarchyEntry > hierarchy = file.read< HierarchyEntry >("xfh0");
 
   struct MeshEntry {
     uint32_t transform;
@@ -299,8 +889,7 @@ void Scene::load(std::string const &filename,
     uint32_t name_end;
   };
   static_assert(sizeof(MeshEntry) == 4 + 4 + 4, "MeshEntry is packed.");
-  std::vector< MeshEntry > meshes;
-  read_chunk(file, "msh0", &meshes);
+  ChunkFile::Span< MeshEntry > meshes = file.read< MeshEntry >("msh0");
 
   struct CameraEntry {
     uint32_t transform;
@@ -309,8 +898,7 @@ void Scene::load(std::string const &filename,
     float clip_near, clip_far;
   };
   static_assert(sizeof(CameraEntry) == 4 + 4 + 4 + 4 + 4, "CameraEntry is packed.");
-  std::vector< CameraEntry > cameras;
-  read_chunk(file, "cam0", &cameras);
+  ChunkFile::Span< CameraEntry > cameras = file.read< CameraEntry >("cam0");
 
   struct LightEntry {
     uint32_t transform;
@@ -321,10 +909,9 @@ void Scene::load(std::string const &filename,
     float fov;
   };
   static_assert(sizeof(LightEntry) == 4 + 1 + 3 + 4 + 4 + 4, "LightEntry is packed.");
-  std::vector< LightEntry > lamps;
-  read_chunk(file, "lmp0", &lamps);
+  ChunkFile::Span< LightEntry > lamps = file.read< LightEntry >("lmp0");
 
-  if (file.peek() != EOF) {
+  if (!file.at_end()) {
     std::cerr << "WARNING: trailing data in scene file '" << filename << "'" << std::endl;
   }
 
@@ -358,6 +945,10 @@ void Scene::load(std::string const &filename,
   }
   assert(hierarchy_transforms.size() == hierarchy.size());
 
+  //mesh names resolved so far, as (name_end, id), by name_begin:
+  // (export-scene.py writes each name once, so entries naming the same mesh share a range)
+  std::vector< std::pair< uint32_t, uint32_t > > resolved(names.size() + 1, std::make_pair(-1U, -1U));
+
   for (auto const &m : meshes) {
     if (m.transform >= hierarchy_transforms.size()) {
       throw std::runtime_error("scene file '" + filename + "' contains mesh entry with invalid transform index (" + std::to_string(m.transform) + ")");
@@ -365,10 +956,14 @@ void Scene::load(std::string const &filename,
     if (!(m.name_begin <= m.name_end && m.name_end <= names.size())) {
       throw std::runtime_error("scene file '" + filename + "' contains mesh entry with invalid name indices");
     }
-    std::string name = std::string(names.begin() + m.name_begin, names.begin() + m.name_end);
+    std::pair< uint32_t, uint32_t > &r = resolved[m.name_begin];
+    if (r.first != m.name_end) {
+      r.first = m.name_end;
+      r.second = resolve_mesh(std::string(names.begin() + m.name_begin, names.begin() + m.name_end));
+    }
 
     if (on_drawable) {
-      on_drawable(*this, hierarchy_transforms[m.transform], name);
+      on_drawable(*this, hierarchy_transforms[m.transform], r.second);
     }
 
   }
@@ -407,7 +1002,8 @@ void Scene::load(std::string const &filename,
     this->lamps.emplace_back(hierarchy_transforms[l.transform]);
     Lamp *lamp = &this->lamps.back();
     lamp->type = static_cast<Lamp::Type>(l.type);
-    lamp->energy = glm::vec3(l.color) * l.energy;
+    lamp->energy = glm::vec3(l.color) / 255.0f * l.energy;
+    lamp->distance = l.distance;
     lamp->spot_fov = l.fov / 180.0f * 3.1415926f; //FOV is stored in degrees; convert to radians.
   }
 
@@ -13,16 +13,25 @@
  */
 
 #include "GL.hpp"
+#include "gl_timer.hpp"
+#include "LightClusters.hpp"
+#include "RenderCommands.hpp"
 
 #include <glm/glm.hpp>
 #include <glm/gtc/quaternion.hpp>
 
+#include <deque>
 #include <list>
 #include <memory>
 #include <functional>
+#include <initializer_list>
+#include <set>
 #include <string>
 #include <vector>
 
+struct OcclusionBuffer;
+struct ImpostorCache;
+
 struct Scene {
 	struct Transform {
 		//Transform names are useful for debugging and looking up locations in a loaded scene:
@@ -36,6 +45,10 @@ struct Scene {
 		//The transform above may be relative to some parent transform:
 		Transform *parent = nullptr;
 
+		//Transforms whose drawables change after load (they move, or their custom_col changes) should be marked dynamic:
+		// (drawables under non-dynamic transforms may be merged into static batches -- see bake_static.hpp)
+		bool dynamic = false;
+
 		//It is often convenient to construct matrices representing this transformation:
 		// ..relative to its parent:
 		glm::mat4 make_local_to_parent() const;
@@ -51,14 +64,19 @@ struct Scene {
 	};
 
   //---- stuff for post processing (bloom) ----
+  //(if post_processing_program is set, the first pass draws into color + bright color targets borrowed
+  // from render_targets -- see RenderTargets.hpp -- which post processing then combines onto the screen)
 
-  GLuint firstpass_fbo = 0;
-  GLuint colorBuffers[2];
-  GLuint depthBuffer = 0;
-  GLuint color_attachments[2] = { GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1 };
+  //the first pass is drawn at this fraction of the drawable size and scaled up by the final composite
+  // (see DynamicResolution.hpp for something that picks it):
+  float resolution_scale = 1.0f;
 
-  GLuint pingpong_fbo[2];
-  GLuint pingpongBuffers[2];
+  //bloom is blurred by downsampling the bright color to 1/2, 1/4, 1/8 size and adding it back up:
+  enum : uint32_t { BloomLevels = 3 };
+  //counts pixels that survive the bloom's brightness prefilter; if there are none, the rest of the chain is skipped:
+  GLuint bright_query = 0;
+  //GPU time taken by all of the post processing (see gl_timer.hpp):
+  mutable GLTimer post_processing_timer;
 
   GLuint post_processing_program = 0;
   std::vector<float> trivial_vector = {
@@ -74,11 +92,67 @@ struct Scene {
 
   //--------
 
+	//Material parameters are the extra per-drawable uniforms of programs that don't read the "Object" uniform block
+	// (programs that do get their per-drawable values from Scene::ObjectUniforms instead; see e.g. ShowSceneProgram for one that doesn't).
+	// The program declares them once in a MaterialLayout (which looks up their locations),
+	// and each drawable stores its values inline in its pipeline's Material:
+	struct MaterialLayout {
+		enum Type : uint8_t { Float = 1, Vec2 = 2, Vec3 = 3, Vec4 = 4, Int = 5 };
+		struct Param {
+			char const *name;
+			Type type;
+		};
+		enum : uint32_t {
+			MaxParams = 4, //parameters per program
+			MaxValues = 16 //floats of parameter storage per drawable
+		};
+
+		MaterialLayout() = default;
+		//looks up 'params' in 'program'; throws if they don't fit in MaxParams / MaxValues:
+		MaterialLayout(GLuint program, std::initializer_list< Param > const &params);
+
+		uint32_t count = 0;
+		Param params[MaxParams];
+		GLint locations[MaxParams]; //-1 if the program doesn't use the parameter
+		uint8_t offsets[MaxParams]; //index of the parameter's first value in Material::values
+	};
+
+	struct Material {
+		MaterialLayout const *layout = nullptr; //(no parameters if null)
+		float values[MaterialLayout::MaxValues] = { }; //Int parameters are stored bit-for-bit
+
+		void set(uint32_t param, float value);
+		void set(uint32_t param, glm::vec2 const &value);
+		void set(uint32_t param, glm::vec3 const &value);
+		void set(uint32_t param, glm::vec4 const &value);
+		void set(uint32_t param, int32_t value);
+
+		//record uploading values to the (already bound) program:
+		void apply(RenderCommands &commands) const;
+	};
+
 	struct Drawable {
 		//a 'Drawable' attaches attribute data to a transform:
 		Drawable(Transform *transform_) : transform(transform_) { assert(transform); }
 		Transform * transform;
-    glm::vec4 *custom_col = new glm::vec4(1, 0, 1, 1);
+		//(optional) color to draw with instead of vertex colors (magenta means "use vertex colors" too);
+		// usually points into Scene::custom_cols, see make_custom_col():
+		glm::vec4 *custom_col = nullptr;
+
+		//(optional) object-space bounding box; drawables with bounds are skipped when entirely outside the view:
+		bool has_bounds = false;
+		glm::vec3 min = glm::vec3(0.0f);
+		glm::vec3 max = glm::vec3(0.0f);
+
+		//(optional) coarser versions of pipeline.start/count, most detailed first (e.g., copied from Mesh::lods);
+		// drawables with bounds draw one of these instead when they are small on screen (see Scene::lod_sizes):
+		enum : uint32_t { MaxLods = 3 };
+		uint32_t lod_count = 0;
+		struct Lod {
+			GLuint start = 0;
+			GLuint count = 0;
+		} lods[MaxLods];
+		mutable uint32_t lod = 0; //level drawn last time (0 being pipeline.start/count); kept so selection has hysteresis
 
 		//Contains all the data needed to run the OpenGL pipeline:
 		struct Pipeline {
@@ -90,12 +164,31 @@ struct Scene {
 			GLenum type = GL_TRIANGLES; //what sort of primitive to draw; passed to glDrawArrays
 			GLuint start = 0; //first vertex to draw; passed to glDrawArrays
 			GLuint count = 0; //number of vertices to draw; passed to glDrawArrays
+			//if set (GL_UNSIGNED_SHORT or GL_UNSIGNED_INT, e.g. copied from Mesh::index_type), start/count are a range of the
+			// vao's element array buffer instead, drawn with glDrawElements:
+			GLenum index_type = 0;
+			//maps the vao's Position attribute to object space, for quantized positions (e.g., copied from Mesh::position_offset/scale);
+			// draw() folds it into the matrices it hands the program, so shaders see quantized positions as if they were object-space ones:
+			glm::vec3 position_offset = glm::vec3(0.0f);
+			glm::vec3 position_scale = glm::vec3(1.0f);
+			glm::mat4 position_to_object() const {
+				return glm::mat4(
+					glm::vec4(position_scale.x, 0.0f, 0.0f, 0.0f),
+					glm::vec4(0.0f, position_scale.y, 0.0f, 0.0f),
+					glm::vec4(0.0f, 0.0f, position_scale.z, 0.0f),
+					glm::vec4(position_offset, 1.0f)
+				);
+			}
 
 			//uniforms:
 			GLuint OBJECT_TO_CLIP_mat4 = -1U; //uniform location for object to clip space matrix
 			GLuint OBJECT_TO_LIGHT_mat4x3 = -1U; //uniform location for object to light space (== world space) matrix
 			GLuint NORMAL_TO_LIGHT_mat3 = -1U; //uniform location for normal to light space (== world space) matrix
-			std::function< void() > set_uniforms; //(optional) function to set any other useful uniforms
+			Material material; //(optional) values for any other per-drawable uniforms
+			//if set, the program reads per-object data from the "Object" uniform block (see Scene::ObjectUniforms) instead of the locations above:
+			bool uniform_blocks = false;
+			//(optional) program that writes the same depth as 'program' (from the same vao and uniform blocks) but no color; used by Scene::depth_prepass:
+			GLuint depth_program = 0;
 
 			//texture objects to bind for the first TextureCount textures:
 			enum : uint32_t { TextureCount = 4 };
@@ -103,9 +196,65 @@ struct Scene {
 				GLuint texture = 0;
 				GLenum target = GL_TEXTURE_2D;
 			} textures[TextureCount];
+
+			//(optional) instanced variant of this pipeline:
+			// drawables whose pipelines share the instanced program+vao, primitive range, and textures are drawn with one glDrawArraysInstanced (or glDrawElementsInstanced) call.
+			// per-object data then comes from per-instance attributes (see Scene::Instance) instead of the uniforms above; drawables with a material are never instanced.
+			struct Instanced {
+				GLuint program = 0; //program reading per-instance attributes, plus world_to_clip/world_to_light from the "Frame" uniform block
+				GLuint vao = 0; //must also link the instance attributes (see Scene::link_instance_attribs); if program or vao is 0, the drawable is never instanced
+				GLuint depth_program = 0; //(optional) depth-only version of 'program'
+			} instanced;
 		} pipeline;
 	};
 
+	//Per-instance data for instanced drawing, as read by the Instance* attributes:
+	struct Instance {
+		glm::vec4 object_to_world[3]; //rows of the object-to-world matrix (InstanceToWorld0-2)
+		glm::vec3 normal_to_light[3]; //columns of the normal-to-light matrix (InstanceNormal0-2)
+		glm::vec4 custom_col; //copy of *Drawable::custom_col (InstanceColor)
+	};
+	static_assert(sizeof(Instance) == 4*4*3 + 4*3*3 + 4*4, "Instance is packed.");
+
+	//Buffer holding instance data during draw(); shared by all scenes:
+	static GLuint instance_buffer;
+	//Link Instance* attributes of 'program' to instance_buffer in the currently bound vao:
+	// (meant to be passed as the 'link_extra' argument of MeshBuffer::make_vao_for_program)
+	static std::set< GLuint > link_instance_attribs(GLuint program);
+
+	//Programs may read per-frame and per-object data from std140 uniform blocks named "Frame" and "Object":
+	// (call bind_uniform_blocks() on such programs once after compiling them)
+	enum : GLuint {
+		FrameBinding = 0, //uniform buffer binding point for "Frame" -- filled once per draw()
+		ObjectBinding = 1 //uniform buffer binding point for "Object" -- a range of a ring buffer, re-bound per drawable
+	};
+	struct FrameUniforms {
+		glm::mat4 world_to_clip;
+		glm::vec4 world_to_light[4]; //mat4x3 columns (std140 pads each to a vec4)
+		glm::vec4 fog_color;
+		glm::vec4 fog_range; //x: depth at which fog starts, y: depth at which fog is complete
+		glm::vec4 cluster_scale; //see LightClusters::cluster_scale()
+		glm::uvec4 cluster_counts; //xyz: light grid size (zero if there are no point lights), w: lights binned
+	};
+	static_assert(sizeof(FrameUniforms) == 4*16 + 4*16 + 16 + 16 + 16 + 16, "FrameUniforms matches std140 layout.");
+	struct ObjectUniforms {
+		glm::mat4 object_to_clip;
+		glm::vec4 object_to_light[4]; //mat4x3 columns
+		glm::vec4 normal_to_light[3]; //mat3 columns
+		glm::vec4 custom_col; //copy of *Drawable::custom_col
+	};
+	static_assert(sizeof(ObjectUniforms) == 4*16 + 4*16 + 3*16 + 16, "ObjectUniforms matches std140 layout.");
+	static void bind_uniform_blocks(GLuint program);
+
+	//fog constants passed through FrameUniforms:
+	glm::vec3 fog_color = glm::vec3(0.5f, 0.56f, 0.6f);
+	glm::vec2 fog_range = glm::vec2(0.1f, 200.0f);
+
+	//storage for Drawable::custom_col values:
+	// a deque never moves its elements, and copies of this scene share it (their drawables point into it too)
+	std::shared_ptr< std::deque< glm::vec4 > > custom_cols = std::make_shared< std::deque< glm::vec4 > >();
+	glm::vec4 *make_custom_col(glm::vec4 const &value = glm::vec4(1.0f, 0.0f, 1.0f, 1.0f));
+
 	struct Camera {
 		//a 'Camera' attaches camera data to a transform:
 		Camera(Transform *transform_) : transform(transform_) { assert(transform); }
@@ -136,6 +285,9 @@ struct Scene {
 		//light energy at our conventional three wavelengths:
 		glm::vec3 energy = glm::vec3(1.0f);
 
+		//Point and spot lights have no effect farther than this:
+		float distance = 10.0f;
+
 		//Spotlight specific:
 		float spot_fov = glm::radians(45.0f);
 	};
@@ -147,15 +299,109 @@ struct Scene {
 	std::list< Lamp > lamps;
 
 	//The "draw" function provides a convenient way to pass all the things in a scene to OpenGL:
+	// (drawables are gathered into a render queue and sorted by pipeline state -- program, vao, textures, then front-to-back -- so redundant binds can be skipped)
 	void draw(glm::uvec2 drawable_size, Camera const &camera) const;
 
 	//..sometimes, you want to draw with a custom projection matrix and/or light space:
 	void draw(glm::uvec2 drawable_size, glm::mat4 const &world_to_clip, glm::mat4x3 const &world_to_light = glm::mat4x3(1.0f)) const;
 
+	//if set, drawables with a depth program (see Drawable::Pipeline::depth_program) are drawn depth-only first,
+	// then shaded with GL_EQUAL depth testing, so expensive fragment shaders only run on visible fragments:
+	bool depth_prepass = false;
+	//GPU time of the first pass (everything before post processing), for comparing the above:
+	mutable GLTimer first_pass_timer;
+
+	//---- level of detail ----
+	//drawables with LODs use level i+1 once their screen-space bounds shrink below lod_sizes[i] (as a fraction of the screen);
+	// a drawable only changes level once its size is lod_hysteresis (relative) past the threshold, so it doesn't pop back and forth:
+	bool lod_selection = true;
+	float lod_sizes[Drawable::MaxLods] = { 0.35f, 0.15f, 0.06f };
+	float lod_hysteresis = 0.15f;
+
+	//---- occlusion culling ----
+	//Occluders are meshes (usually simplified collision meshes) rasterized into a small CPU depth buffer
+	// each frame (see OcclusionBuffer.hpp); drawables whose bounds are hidden behind them are skipped:
+	struct Occluder {
+		Transform *transform;
+		glm::vec3 const *positions; //triangle list, e.g. from MeshBuffer::positions_of()
+		uint32_t count;
+		glm::vec3 min, max; //object-space bounds
+	};
+	std::vector< Occluder > occluders;
+	bool occlusion_culling = true;
+	uint32_t max_occluders = 8; //only the largest on screen are rasterized...
+	float min_occluder_area = 0.02f; //...and only if they cover at least this fraction of the screen
+	mutable std::shared_ptr< OcclusionBuffer > occlusion_buffer; //created on first use (shared by copies of the scene)
+	mutable std::vector< std::pair< float, Occluder const * > > occluder_candidates; //(screen area, occluder)
+
+	//---- clustered lighting ----
+	//point lamps (with non-zero energy) are binned into a LightClusters grid each frame,
+	// which programs that sample its texture buffers (like LitColorTextureProgram) use to light fragments:
+	bool clustered_lights = true;
+	mutable std::shared_ptr< LightClusters > light_clusters; //created on first use (shared by copies of the scene)
+	mutable std::vector< LightClusters::Light > cluster_lights; //kept around to avoid re-allocating
+
+	//---- impostors ----
+	//static drawables (see ImpostorCache::can_impostor) whose bounds are all farther than impostor_distance from the camera
+	// are drawn as pictures of themselves on quads, kept in an ImpostorCache and drawn with impostor_program (see ImpostorProgram.hpp):
+	GLuint impostor_program = 0;
+	bool draw_impostors = true;
+	float impostor_distance = 140.0f;
+	mutable std::shared_ptr< ImpostorCache > impostor_cache; //created on first use (shared by copies of the scene)
+
+	//---- render queue ----
+
+	//Per-frame submission counters, filled in by draw():
+	struct DrawStats {
+		uint32_t drawables = 0; //drawables submitted
+		uint32_t culled = 0; //drawables skipped because their bounds were outside the view
+		uint32_t occluded = 0; //drawables skipped because their bounds were hidden by occluders
+		uint32_t coarse_lods = 0; //drawables drawn with one of their LODs instead of the full mesh
+		uint32_t impostors = 0; //drawables drawn as impostor quads instead of their meshes
+		uint32_t triangles = 0; //triangles submitted (all passes, all instances)
+		uint32_t draw_calls = 0;
+		uint32_t instanced_draw_calls = 0; //draw calls that covered more than one drawable
+		uint32_t prepass_draw_calls = 0; //(of draw_calls) depth pre-pass draws
+		uint32_t program_binds = 0; //glUseProgram calls
+		uint32_t vao_binds = 0; //glBindVertexArray calls
+		uint32_t texture_binds = 0; //glBindTexture calls (including the final un-binds)
+		//what the old unsorted bind-everything-per-drawable loop would have issued for the same drawables:
+		uint32_t unsorted_state_changes = 0;
+
+		uint32_t state_changes() const { return program_binds + vao_binds + texture_binds; }
+	};
+	mutable DrawStats stats;
+
+	struct QueueEntry {
+		uint64_t key; //see make_sort_key() in Scene.cpp
+		Drawable const *drawable; //(first drawable, for instanced entries)
+		glm::mat4 object_to_world;
+		float depth; //view depth of the object's origin
+		uint32_t instance_begin = 0; //range in 'instances' if this entry is an instanced draw
+		uint32_t instance_count = 0; // (zero for ordinary draws)
+		GLintptr object_offset = 0; //offset of this drawable's ObjectUniforms in the ring buffer (pipeline.uniform_blocks only)
+		GLuint start = 0, count = 0; //vertex (or index) range to draw (pipeline.start/count, or the selected LOD)
+	};
+	//kept around between frames to avoid re-allocating:
+	mutable std::vector< QueueEntry > render_queue;
+	mutable std::vector< QueueEntry const * > prepass_queue; //entries with depth programs, front-to-back
+	mutable std::vector< QueueEntry > instance_candidates; //drawables with an instanced pipeline, before grouping
+	mutable std::vector< Instance > instances;
+
+	//the last draw()'s uniform uploads and queue submission, recorded while walking the queue and then executed
+	// (kept until the next draw(), so they can be dump()'d):
+	mutable RenderCommands commands;
+
 	//add transforms/objects/cameras from a scene file to this scene:
 	// the 'on_drawable' callback gives your code a chance to look up mesh data and make Drawables:
 	// throws on file format errors
 	void load(std::string const &filename,
 		std::function< void(Scene &, Transform *, std::string const &) > const &on_drawable = nullptr
 	);
+	//..or have 'resolve_mesh' turn each distinct mesh name into an id (e.g., MeshBuffer::lookup_id) and 'on_drawable' get ids:
+	// (scene files store each name once, so a big scene resolves a handful of names rather than one per object)
+	void load(std::string const &filename,
+		std::function< uint32_t(std::string const &) > const &resolve_mesh,
+		std::function< void(Scene &, Transform *, uint32_t) > const &on_drawable
+	);
 };
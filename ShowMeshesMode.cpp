@@ -28,6 +28,9 @@ ShowMeshesMode::ShowMeshesMode(MeshBuffer const &buffer_) : buffer(buffer_) {
 		scene_drawable->pipeline.type = GL_TRIANGLES;
 		scene_drawable->pipeline.start = 0;
 		scene_drawable->pipeline.count = 0;
+		scene_drawable->pipeline.index_type = 0;
+		scene_drawable->pipeline.position_offset = glm::vec3(0.0f);
+		scene_drawable->pipeline.position_scale = glm::vec3(1.0f);
 	}
 
 	//select first mesh in buffer:
@@ -152,51 +155,56 @@ void ShowMeshesMode::draw(glm::uvec2 const &drawable_size) {
 }
 
 void ShowMeshesMode::select_prev_mesh() {
-	auto f = buffer.meshes.find(current_mesh_name);
-	if (f == buffer.meshes.end()) f = buffer.meshes.begin(); // not found
-	if (f != buffer.meshes.begin()) --f;
-
-	if (f != buffer.meshes.end()) {
-		current_mesh_name = f->first;
-		scene_drawable->pipeline.type = f->second.type;
-		scene_drawable->pipeline.start = f->second.start;
-		scene_drawable->pipeline.count = f->second.count;
-		current_mesh_min = f->second.min;
-		current_mesh_max = f->second.max;
+	if (current_mesh >= buffer.meshes.size()) current_mesh = 0; // not found
+	else if (current_mesh > 0) --current_mesh;
+
+	if (current_mesh < buffer.meshes.size()) {
+		Mesh const &mesh = buffer.meshes[current_mesh];
+		current_mesh_name = buffer.mesh_names[current_mesh];
+		scene_drawable->pipeline.type = mesh.type;
+		scene_drawable->pipeline.start = mesh.start;
+		scene_drawable->pipeline.count = mesh.count;
+		scene_drawable->pipeline.index_type = mesh.index_type;
+		scene_drawable->pipeline.position_offset = mesh.position_offset;
+		scene_drawable->pipeline.position_scale = mesh.position_scale;
+		current_mesh_min = mesh.min;
+		current_mesh_max = mesh.max;
 	} else {
 		current_mesh_name = "";
 		scene_drawable->pipeline.type = GL_TRIANGLES;
 		scene_drawable->pipeline.start = 0;
 		scene_drawable->pipeline.count = 0;
+		scene_drawable->pipeline.index_type = 0;
+		scene_drawable->pipeline.position_offset = glm::vec3(0.0f);
+		scene_drawable->pipeline.position_scale = glm::vec3(1.0f);
 		current_mesh_min = glm::vec3(0.0f);
 		current_mesh_max = glm::vec3(0.0f);
 	}
 }
 
 void ShowMeshesMode::select_next_mesh() {
-	auto f = buffer.meshes.find(current_mesh_name);
-	if (f != buffer.meshes.end()) ++f;
-	if (f == buffer.meshes.end()) {
-		auto temp = buffer.meshes.rbegin();
-		if (temp != buffer.meshes.rend()) {
-			++temp;
-			f = temp.base();
-			assert(f != buffer.meshes.end());
-		}
-	}
-
-	if (f != buffer.meshes.end()) {
-		current_mesh_name = f->first;
-		scene_drawable->pipeline.type = f->second.type;
-		scene_drawable->pipeline.start = f->second.start;
-		scene_drawable->pipeline.count = f->second.count;
-		current_mesh_min = f->second.min;
-		current_mesh_max = f->second.max;
+	if (current_mesh < buffer.meshes.size()) ++current_mesh;
+	if (current_mesh >= buffer.meshes.size()) current_mesh = MeshId(buffer.meshes.size()) - 1; // stay on the last one (-1U if there are none)
+
+	if (current_mesh < buffer.meshes.size()) {
+		Mesh const &mesh = buffer.meshes[current_mesh];
+		current_mesh_name = buffer.mesh_names[current_mesh];
+		scene_drawable->pipeline.type = mesh.type;
+		scene_drawable->pipeline.start = mesh.start;
+		scene_drawable->pipeline.count = mesh.count;
+		scene_drawable->pipeline.index_type = mesh.index_type;
+		scene_drawable->pipeline.position_offset = mesh.position_offset;
+		scene_drawable->pipeline.position_scale = mesh.position_scale;
+		current_mesh_min = mesh.min;
+		current_mesh_max = mesh.max;
 	} else {
 		current_mesh_name = "";
 		scene_drawable->pipeline.type = GL_TRIANGLES;
 		scene_drawable->pipeline.start = 0;
 		scene_drawable->pipeline.count = 0;
+		scene_drawable->pipeline.index_type = 0;
+		scene_drawable->pipeline.position_offset = glm::vec3(0.0f);
+		scene_drawable->pipeline.position_scale = glm::vec3(1.0f);
 		current_mesh_min = glm::vec3(0.0f);
 		current_mesh_max = glm::vec3(0.0f);
 	}
@@ -1,9 +1,10 @@
 #include "ShowSceneMode.hpp"
 #include "DrawLines.hpp"
+#include "ShowSceneProgram.hpp"
 
 #include <iostream>
 
-ShowSceneMode::ShowSceneMode(Scene const &scene_) : scene(scene_) {
+ShowSceneMode::ShowSceneMode(Scene &scene_) : scene(scene_) {
 
 	//Set up camera-only scene:
 	{ //create a single camera:
@@ -20,6 +21,15 @@ ShowSceneMode::~ShowSceneMode() {
 }
 
 bool ShowSceneMode::handle_event(SDL_Event const &evt, glm::uvec2 const &window_size) {
+	//----- number keys pick what ShowSceneProgram shows (see ShowSceneProgram::INSPECT_MODE_int) -----
+	if (evt.type == SDL_KEYDOWN && evt.key.keysym.sym >= SDLK_0 && evt.key.keysym.sym <= SDLK_4) {
+		int32_t mode = int32_t(evt.key.keysym.sym - SDLK_0);
+		for (auto &drawable : scene.drawables) {
+			if (drawable.pipeline.material.layout != &show_scene_program->material_layout) continue;
+			drawable.pipeline.material.set(ShowSceneProgram::InspectMode, mode);
+		}
+		return true;
+	}
 	//----- trackball-style camera controls -----
 	if (evt.type == SDL_MOUSEBUTTONDOWN) {
 		if (evt.button.button == SDL_BUTTON_LEFT) {
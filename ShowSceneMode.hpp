@@ -12,7 +12,7 @@
 #include "Mesh.hpp"
 
 struct ShowSceneMode : Mode {
-	ShowSceneMode(Scene const &scene);
+	ShowSceneMode(Scene &scene);
 	virtual ~ShowSceneMode();
 
 	virtual bool handle_event(SDL_Event const &, glm::uvec2 const &window_size) override;
@@ -27,8 +27,8 @@ struct ShowSceneMode : Mode {
 		bool flip_x = false; //flip x inputs when moving? (used to handle situations where camera is upside-down)
 	} camera;
 
-	//Scene being viewed:
-	Scene const &scene;
+	//Scene being viewed (its drawables' inspect modes are changed with the number keys):
+	Scene &scene;
 
 	//mode uses a secondary Scene to hold a camera:
 	Scene camera_scene;
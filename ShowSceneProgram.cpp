@@ -13,6 +13,7 @@ Load< ShowSceneProgram > show_scene_program(LoadTagEarly, []() -> ShowSceneProgr
 	show_scene_program_pipeline.OBJECT_TO_CLIP_mat4 = ret->OBJECT_TO_CLIP_mat4;
 	show_scene_program_pipeline.OBJECT_TO_LIGHT_mat4x3 = ret->OBJECT_TO_LIGHT_mat4x3;
 	show_scene_program_pipeline.NORMAL_TO_LIGHT_mat3 = ret->NORMAL_TO_LIGHT_mat3;
+	show_scene_program_pipeline.material.layout = &ret->material_layout;
 
 	return ret;
 });
@@ -85,6 +86,10 @@ ShowSceneProgram::ShowSceneProgram() {
 	NORMAL_TO_LIGHT_mat3 = glGetUniformLocation(program, "NORMAL_TO_LIGHT");
 
 	INSPECT_MODE_int = glGetUniformLocation(program, "INSPECT_MODE");
+
+	material_layout = Scene::MaterialLayout(program, {
+		{ "INSPECT_MODE", Scene::MaterialLayout::Int }, //InspectMode
+	});
 }
 
 ShowSceneProgram::~ShowSceneProgram() {
@@ -26,6 +26,10 @@ struct ShowSceneProgram {
 
 	GLuint INSPECT_MODE_int = -1U; //0: basic lighting; 1: position only; 2: normal only; 3: color only; 4: texcoord only
 
+	//Per-drawable parameters (set through Drawable::Pipeline::material):
+	enum : uint32_t { InspectMode = 0 };
+	Scene::MaterialLayout material_layout;
+
 	//Textures:
 	//no textures used
 };
@@ -1,56 +1,36 @@
 #include "Sprite.hpp"
 
 #include "GL.hpp"
-#include "read_write_chunk.hpp"
+#include "ChunkFile.hpp"
+#include "Archive.hpp"
 #include "load_save_png.hpp"
+#include "Load.hpp"
 
-#include <fstream>
+SpriteAtlas::SpriteAtlas(std::string const &filebase) : SpriteAtlas(filebase, Deferred) {
+	upload();
+}
 
-SpriteAtlas::SpriteAtlas(std::string const &filebase) {
+SpriteAtlas::SpriteAtlas(std::string const &filebase, DeferUpload) {
 	std::string png_path = filebase + ".png";
 	atlas_path = filebase + ".atlas";
 
 	// ----- load the texture data -----
-	std::vector< glm::u8vec4 > tex_data;
-	load_png(png_path, &tex_size, &tex_data, LowerLeftOrigin);
-
-	//upload the texture data to the GPU:
-
-	//generate a new texture object name:
-	glGenTextures(1, &tex);
-
-	//bind the new texture object:
-	glBindTexture(GL_TEXTURE_2D, tex);
-
-	//upload pixel data:
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, tex_size.x, tex_size.y, 0, GL_RGBA, GL_UNSIGNED_BYTE, tex_data.data());
-
-	//set filtering and wrapping parameters:
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-
-	//If you were doing pixel art, you'd probably want to filter like this:
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-	
-	//For smoother artwork, this filtering makes more sense:
-	//glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-	//glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-	//glGenerateMipmap(GL_TEXTURE_2D);
-
-	//unbind the texture object:
-	glBindTexture(GL_TEXTURE_2D, 0);
+	//(upload() sends it to the GPU)
+	Archive::View png;
+	if (find_data_file(png_path, &png)) {
+		load_png(png_path, png.data, png.size, &tex_size, &pending_tex_data, LowerLeftOrigin);
+	} else {
+		load_png(png_path, &tex_size, &pending_tex_data, LowerLeftOrigin);
+	}
 
 	// ----- load the sprite location data -----
 
-	//read from atlas_path in binary mode:
-	std::ifstream in(atlas_path, std::ios::binary);
+	//map atlas_path into memory:
+	ChunkFile in(atlas_path);
 
 	//sprite atlas is stored as two chunks:
 	// (1) a 'str0' chunk with string data:
-	std::vector< char > strings;
-
-	read_chunk(in, "str0", &strings);
+	ChunkFile::Span< char > strings = in.read< char >("str0");
 
 	// (2) a 'spr0' chunk with sprite data:
 	struct SpriteData {
@@ -59,9 +39,7 @@ SpriteAtlas::SpriteAtlas(std::string const &filebase) {
 		glm::vec2 max_px;
 		glm::vec2 anchor_px;
 	};
-	std::vector< SpriteData > datas;
-
-	read_chunk(in, "spr0", &datas);
+	ChunkFile::Span< SpriteData > datas = in.read< SpriteData >("spr0");
 
 	//actually create Sprite objects from the data and insert into the lookup table:
 
@@ -91,6 +69,40 @@ SpriteAtlas::SpriteAtlas(std::string const &filebase) {
 	}
 }
 
+void SpriteAtlas::upload() {
+	assert(tex == 0 && "upload() goes with the Deferred constructor, once");
+
+	//generate a new texture object name:
+	glGenTextures(1, &tex);
+
+	//bind the new texture object:
+	glBindTexture(GL_TEXTURE_2D, tex);
+
+	//upload pixel data:
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, tex_size.x, tex_size.y, 0, GL_RGBA, GL_UNSIGNED_BYTE, pending_tex_data.data());
+	count_load_bytes_uploaded(pending_tex_data.size() * sizeof(glm::u8vec4));
+
+	//set filtering and wrapping parameters:
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+	//If you were doing pixel art, you'd probably want to filter like this:
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	
+	//For smoother artwork, this filtering makes more sense:
+	//glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	//glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+	//glGenerateMipmap(GL_TEXTURE_2D);
+
+	//unbind the texture object:
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	//done with the image:
+	pending_tex_data.clear();
+	pending_tex_data.shrink_to_fit();
+}
+
 SpriteAtlas::~SpriteAtlas() {
 	glDeleteTextures(1, &tex);
 	tex = 0;
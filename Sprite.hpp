@@ -13,6 +13,7 @@
 
 #include <unordered_map>
 #include <string>
+#include <vector>
 
 struct Sprite {
 	//Sprites are rectangles in an atlas texture:
@@ -32,6 +33,11 @@ struct Sprite {
 struct SpriteAtlas {
 	//load from filebase.png and filebase.atlas:
 	SpriteAtlas(std::string const &filebase);
+	//..or read them without touching OpenGL (e.g., in a background load; see Load.hpp), then upload() the texture later:
+	enum DeferUpload { Deferred };
+	SpriteAtlas(std::string const &filebase, DeferUpload);
+	//creates 'tex' from the image read by the Deferred constructor (call on the OpenGL context thread):
+	void upload();
 	~SpriteAtlas();
 
 	//look up sprite in list of loaded sprites:
@@ -49,5 +55,8 @@ struct SpriteAtlas {
 
 	//path to atlas, stored for debugging purposes:
 	std::string atlas_path;
+
+	//image waiting for upload():
+	std::vector< glm::u8vec4 > pending_tex_data;
 };
 
@@ -0,0 +1,350 @@
+#include "bake_static.hpp"
+
+#include "gl_errors.hpp"
+#include "Load.hpp"
+#include "mesh_vertex.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <tuple>
+#include <vector>
+
+//the returned buffer also owns the vertex arrays made for its batches:
+namespace {
+	struct BakedMeshBuffer : MeshBuffer {
+		std::vector< GLuint > vaos;
+		~BakedMeshBuffer() {
+			if (!vaos.empty()) glDeleteVertexArrays(GLsizei(vaos.size()), vaos.data());
+			if (buffer != 0) glDeleteBuffers(1, &buffer);
+		}
+	};
+}
+
+std::shared_ptr< MeshBuffer const > bake_static_drawables(Scene &scene, MeshBuffer const &source, std::set< GLuint > const &source_vaos, float cell_size,
+	std::function< void(Scene &, Scene::Drawable &) > const &on_batch) {
+	assert(cell_size > 0.0f);
+
+	//quantized sources (see mesh_vertex.hpp) are baked at full precision and quantized again at the end:
+	bool quantized = (source.Position.size == 3 && source.Position.type == GL_UNSIGNED_SHORT
+		&& source.Position.stride == GLsizei(sizeof(QuantizedMeshVertex)) && source.Normal.type == GL_INT_2_10_10_10_REV);
+
+	//vertex layout of the data being baked (all attributes interleaved in one buffer):
+	MeshBuffer::Attrib Position = source.Position;
+	MeshBuffer::Attrib Normal = source.Normal;
+	MeshBuffer::Attrib Color = source.Color;
+	if (quantized) {
+		Position = MeshBuffer::Attrib(3, GL_FLOAT, GL_FALSE, sizeof(MeshVertex), offsetof(MeshVertex, Position));
+		Normal = MeshBuffer::Attrib(3, GL_FLOAT, GL_FALSE, sizeof(MeshVertex), offsetof(MeshVertex, Normal));
+		Color = MeshBuffer::Attrib(4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(MeshVertex), offsetof(MeshVertex, Color));
+	}
+	GLsizei stride = Position.stride;
+	if (Position.size != 3 || Position.type != GL_FLOAT) {
+		throw std::runtime_error("bake_static_drawables expects float3 (or quantized) positions.");
+	}
+	bool has_normals = (Normal.size == 3 && Normal.type == GL_FLOAT);
+	bool has_colors = (Color.size == 4 && Color.type == GL_UNSIGNED_BYTE);
+
+	//read back the source vertices:
+	std::vector< uint8_t > source_data;
+	{
+		GLint size = 0;
+		glBindBuffer(GL_ARRAY_BUFFER, source.buffer);
+		glGetBufferParameteriv(GL_ARRAY_BUFFER, GL_BUFFER_SIZE, &size);
+		source_data.resize(size);
+		glGetBufferSubData(GL_ARRAY_BUFFER, 0, size, source_data.data());
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+		GL_ERRORS();
+	}
+	if (quantized) {
+		QuantizedBounds bounds;
+		bounds.min = source.position_offset;
+		bounds.max = source.position_offset + source.position_scale;
+		std::vector< uint8_t > decoded(source_data.size() / sizeof(QuantizedMeshVertex) * sizeof(MeshVertex));
+		for (size_t v = 0; v < source_data.size() / sizeof(QuantizedMeshVertex); ++v) {
+			QuantizedMeshVertex q;
+			std::memcpy(&q, &source_data[v * sizeof(QuantizedMeshVertex)], sizeof(q));
+			MeshVertex vertex = dequantize(q, bounds);
+			std::memcpy(&decoded[v * sizeof(MeshVertex)], &vertex, sizeof(vertex));
+		}
+		source_data = std::move(decoded);
+	}
+	GLuint total = GLuint(source_data.size() / stride);
+
+	//..and its indices, if it is indexed (batches are drawn unindexed, since their vertices are all transformed copies anyway):
+	std::vector< uint32_t > source_indices;
+	if (source.index_type != 0) {
+		GLint size = 0;
+		glBindBuffer(GL_ARRAY_BUFFER, source.index_buffer);
+		glGetBufferParameteriv(GL_ARRAY_BUFFER, GL_BUFFER_SIZE, &size);
+		if (source.index_type == GL_UNSIGNED_SHORT) {
+			std::vector< uint16_t > indices16(size / sizeof(uint16_t));
+			glGetBufferSubData(GL_ARRAY_BUFFER, 0, indices16.size() * sizeof(uint16_t), indices16.data());
+			source_indices.assign(indices16.begin(), indices16.end());
+		} else {
+			source_indices.resize(size / sizeof(uint32_t));
+			glGetBufferSubData(GL_ARRAY_BUFFER, 0, source_indices.size() * sizeof(uint32_t), source_indices.data());
+		}
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+		GL_ERRORS();
+		for (uint32_t i : source_indices) {
+			if (i >= total) throw std::runtime_error("bake_static_drawables found an out-of-range index.");
+		}
+		total = GLuint(source_indices.size());
+	}
+	//vertex drawn 'v'th:
+	auto source_vertex = [&](GLuint v) -> uint8_t const * {
+		return &source_data[(source_indices.empty() ? v : source_indices[v]) * stride];
+	};
+
+	auto can_merge = [&](Scene::Drawable const &drawable) {
+		Scene::Drawable::Pipeline const &pipeline = drawable.pipeline;
+		if (pipeline.program == 0 || pipeline.count == 0) return false;
+		if (pipeline.type != GL_TRIANGLES) return false;
+		if (!source_vaos.count(pipeline.vao)) return false;
+		if (pipeline.start + pipeline.count > total) return false;
+		for (uint32_t l = 0; l < drawable.lod_count; ++l) {
+			if (drawable.lods[l].start + drawable.lods[l].count > total) return false;
+		}
+		if (pipeline.material.layout) return false; //per-drawable uniforms can't be merged
+		for (Scene::Transform const *t = drawable.transform; t; t = t->parent) {
+			if (t->dynamic) return false;
+		}
+		return true;
+	};
+
+	//Batches are keyed by (pipeline state, cell x, cell y):
+	typedef std::tuple< GLuint, GLenum, GLuint, GLuint, GLuint, GLuint, int32_t, int32_t > BatchKey;
+	struct Batch {
+		Scene::Drawable::Pipeline pipeline; //copied from the first drawable merged into the batch
+		std::vector< uint8_t > data[1 + Scene::Drawable::MaxLods]; //baked vertices, per level of detail
+	};
+	std::map< BatchKey, Batch > batches;
+
+	//Batches get as many levels of detail as the longest LOD chain among the merged drawables
+	// (drawables with shorter chains repeat their coarsest level):
+	uint32_t levels = 1;
+	for (auto const &drawable : scene.drawables) {
+		if (can_merge(drawable)) levels = std::max(levels, 1 + drawable.lod_count);
+	}
+
+	uint32_t merged = 0;
+	std::vector< uint8_t > tri(3 * stride);
+	for (auto const &drawable : scene.drawables) {
+		if (!can_merge(drawable)) continue;
+		Scene::Drawable::Pipeline const &pipeline = drawable.pipeline;
+
+		glm::mat4 object_to_world = drawable.transform->make_local_to_world();
+		glm::mat3 normal_to_world = glm::inverse(glm::transpose(glm::mat3(object_to_world)));
+
+		glm::vec4 custom_col = (drawable.custom_col ? *drawable.custom_col : glm::vec4(1.0f, 0.0f, 1.0f, 1.0f));
+		bool bake_color = has_colors && custom_col != glm::vec4(1.0f, 0.0f, 1.0f, 1.0f);
+		glm::u8vec4 baked_color = glm::u8vec4(glm::clamp(custom_col, 0.0f, 1.0f) * 255.0f + 0.5f);
+
+		//Drawables without LODs are the same triangles at every level, so they're binned per-triangle (which cuts big meshes up by cell);
+		// drawables with LODs go to one cell, from the center of their world bounds, so all their levels land in the same batch
+		// (otherwise neighboring cells could pick levels that overlap or leave holes):
+		bool per_triangle = (drawable.lod_count == 0);
+		glm::ivec2 drawable_cell = glm::ivec2(0);
+		if (!per_triangle) {
+			glm::vec3 min = drawable.min, max = drawable.max;
+			if (!drawable.has_bounds) {
+				min = glm::vec3( std::numeric_limits< float >::infinity());
+				max = glm::vec3(-std::numeric_limits< float >::infinity());
+				for (GLuint v = pipeline.start; v < pipeline.start + pipeline.count; ++v) {
+					glm::vec3 position;
+					std::memcpy(&position, source_vertex(v) + Position.offset, sizeof(position));
+					min = glm::min(min, position);
+					max = glm::max(max, position);
+				}
+			}
+			glm::vec3 world_min = glm::vec3( std::numeric_limits< float >::infinity());
+			glm::vec3 world_max = glm::vec3(-std::numeric_limits< float >::infinity());
+			for (uint32_t c = 0; c < 8; ++c) {
+				glm::vec3 corner = glm::vec3((c & 1 ? max.x : min.x), (c & 2 ? max.y : min.y), (c & 4 ? max.z : min.z));
+				glm::vec3 world = glm::vec3(object_to_world * glm::vec4(corner, 1.0f));
+				world_min = glm::min(world_min, world);
+				world_max = glm::max(world_max, world);
+			}
+			glm::vec3 center = 0.5f * (world_min + world_max);
+			drawable_cell = glm::ivec2(int32_t(std::floor(center.x / cell_size)), int32_t(std::floor(center.y / cell_size)));
+		}
+
+		for (uint32_t level = 0; level < levels; ++level) {
+			uint32_t lod = std::min(level, drawable.lod_count);
+			GLuint start = (lod == 0 ? pipeline.start : drawable.lods[lod - 1].start);
+			GLuint count = (lod == 0 ? pipeline.count : drawable.lods[lod - 1].count);
+			for (GLuint v = start; v + 2 < start + count; v += 3) {
+				for (uint32_t i = 0; i < 3; ++i) {
+					std::memcpy(&tri[i * stride], source_vertex(v + i), stride);
+				}
+
+				glm::vec3 centroid = glm::vec3(0.0f);
+				for (uint32_t i = 0; i < 3; ++i) {
+					uint8_t *vertex = &tri[i * stride];
+
+					glm::vec3 position;
+					std::memcpy(&position, vertex + Position.offset, sizeof(position));
+					position = glm::vec3(object_to_world * glm::vec4(position, 1.0f));
+					std::memcpy(vertex + Position.offset, &position, sizeof(position));
+					centroid += position;
+
+					if (has_normals) {
+						glm::vec3 normal;
+						std::memcpy(&normal, vertex + Normal.offset, sizeof(normal));
+						normal = normal_to_world * normal;
+						//scaled transforms change the length; renormalize before it is stored (or re-quantized):
+						if (normal != glm::vec3(0.0f)) normal = glm::normalize(normal);
+						std::memcpy(vertex + Normal.offset, &normal, sizeof(normal));
+					}
+					if (bake_color) {
+						std::memcpy(vertex + Color.offset, &baked_color, sizeof(baked_color));
+					}
+				}
+				centroid /= 3.0f;
+				glm::ivec2 cell = drawable_cell;
+				if (per_triangle) cell = glm::ivec2(int32_t(std::floor(centroid.x / cell_size)), int32_t(std::floor(centroid.y / cell_size)));
+
+				BatchKey key = std::make_tuple(pipeline.program, pipeline.type,
+					pipeline.textures[0].texture, pipeline.textures[1].texture, pipeline.textures[2].texture, pipeline.textures[3].texture,
+					cell.x, cell.y);
+				auto f = batches.find(key);
+				if (f == batches.end()) {
+					f = batches.insert(std::make_pair(key, Batch())).first;
+					f->second.pipeline = pipeline;
+				}
+				f->second.data[level].insert(f->second.data[level].end(), tri.begin(), tri.end());
+			}
+		}
+
+		++merged;
+	}
+	static_assert(Scene::Drawable::Pipeline::TextureCount == 4, "BatchKey covers all textures");
+
+	//Remove the merged drawables:
+	for (auto di = scene.drawables.begin(); di != scene.drawables.end(); /* later */) {
+		if (can_merge(*di)) {
+			di = scene.drawables.erase(di);
+		} else {
+			++di;
+		}
+	}
+
+	//Gather batches into one buffer, making a drawable for each:
+	std::shared_ptr< BakedMeshBuffer > ret = std::make_shared< BakedMeshBuffer >();
+	ret->Position = source.Position;
+	ret->Normal = source.Normal;
+	ret->Color = source.Color;
+	ret->TexCoord = source.TexCoord;
+	//(quantized batches span the bounds of everything baked)
+	QuantizedBounds bounds;
+	if (quantized) {
+		bounds.min = glm::vec3(std::numeric_limits< float >::infinity());
+		bounds.max = glm::vec3(-std::numeric_limits< float >::infinity());
+		for (auto const &kv : batches) {
+			for (uint32_t level = 0; level < levels; ++level) {
+				std::vector< uint8_t > const &level_data = kv.second.data[level];
+				for (size_t v = 0; v < level_data.size() / stride; ++v) {
+					glm::vec3 position;
+					std::memcpy(&position, &level_data[v * stride + Position.offset], sizeof(position));
+					bounds.min = glm::min(bounds.min, position);
+					bounds.max = glm::max(bounds.max, position);
+				}
+			}
+		}
+		if (batches.empty()) bounds = QuantizedBounds();
+		ret->position_offset = bounds.min;
+		ret->position_scale = bounds.max - bounds.min;
+	}
+	glGenBuffers(1, &ret->buffer); //(filled below, once all batches are gathered)
+
+	std::map< GLuint, GLuint > vao_for_program;
+	std::vector< uint8_t > data;
+	for (auto const &kv : batches) {
+		Batch const &batch = kv.second;
+		Mesh mesh;
+		mesh.type = GL_TRIANGLES;
+		mesh.lod_count = levels - 1;
+		for (uint32_t level = 0; level < levels; ++level) {
+			std::vector< uint8_t > const &level_data = batch.data[level];
+			GLuint start = GLuint(data.size() / stride);
+			GLuint count = GLuint(level_data.size() / stride);
+			if (level == 0) {
+				mesh.start = start;
+				mesh.count = count;
+			} else {
+				mesh.lods[level - 1].start = start;
+				mesh.lods[level - 1].count = count;
+			}
+			//(bounds cover every level: a drawable's levels share a cell, but coarser ones needn't stay inside the finer ones' bounds)
+			for (GLuint v = 0; v < count; ++v) {
+				glm::vec3 position;
+				std::memcpy(&position, &level_data[v * stride + Position.offset], sizeof(position));
+				mesh.min = glm::min(mesh.min, position);
+				mesh.max = glm::max(mesh.max, position);
+			}
+			data.insert(data.end(), level_data.begin(), level_data.end());
+		}
+
+		std::string name = "static." + std::to_string(ret->meshes.size())
+			+ " (" + std::to_string(std::get< 6 >(kv.first)) + "," + std::to_string(std::get< 7 >(kv.first)) + ")";
+		ret->add(name, mesh);
+
+		GLuint &vao = vao_for_program[batch.pipeline.program];
+		if (vao == 0) {
+			vao = ret->make_vao_for_program(batch.pipeline.program);
+			ret->vaos.emplace_back(vao);
+		}
+
+		scene.transforms.emplace_back();
+		Scene::Transform *transform = &scene.transforms.back();
+		transform->name = name;
+
+		scene.drawables.emplace_back(transform);
+		Scene::Drawable &drawable = scene.drawables.back();
+		drawable.pipeline = batch.pipeline;
+		drawable.pipeline.vao = vao;
+		drawable.pipeline.start = mesh.start;
+		drawable.pipeline.count = mesh.count;
+		drawable.pipeline.index_type = 0;
+		drawable.pipeline.position_offset = ret->position_offset;
+		drawable.pipeline.position_scale = ret->position_scale;
+		drawable.pipeline.instanced = Scene::Drawable::Pipeline::Instanced(); //batches are unique, nothing to instance
+		drawable.has_bounds = true;
+		drawable.min = mesh.min;
+		drawable.max = mesh.max;
+		drawable.lod_count = mesh.lod_count;
+		for (uint32_t l = 0; l < mesh.lod_count; ++l) {
+			drawable.lods[l].start = mesh.lods[l].start;
+			drawable.lods[l].count = mesh.lods[l].count;
+		}
+
+		if (on_batch) on_batch(scene, drawable);
+	}
+
+	GLuint vertices = GLuint(data.size() / stride);
+	if (quantized) {
+		std::vector< uint8_t > packed(vertices * sizeof(QuantizedMeshVertex));
+		for (GLuint v = 0; v < vertices; ++v) {
+			MeshVertex vertex;
+			std::memcpy(&vertex, &data[v * sizeof(MeshVertex)], sizeof(vertex));
+			QuantizedMeshVertex q = quantize(vertex, bounds);
+			std::memcpy(&packed[v * sizeof(QuantizedMeshVertex)], &q, sizeof(q));
+		}
+		data = std::move(packed);
+	}
+
+	glBindBuffer(GL_ARRAY_BUFFER, ret->buffer);
+	glBufferData(GL_ARRAY_BUFFER, data.size(), data.data(), GL_STATIC_DRAW);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	count_load_bytes_uploaded(data.size());
+
+	std::cout << "Baked " << merged << " static drawables into " << batches.size() << " batches with "
+		<< levels << " level(s) of detail (" << vertices << " vertices)." << std::endl;
+
+	GL_ERRORS();
+	return ret;
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+/*
+ * Static batching: merges drawables that never change after load into a few
+ *  pre-transformed vertex ranges, so one draw call covers many objects.
+ *
+ * Merged geometry is grouped into cell_size x cell_size cells (in world xy),
+ *  and each cell becomes its own drawable with bounds, so it can still be culled.
+ *  Triangle meshes without LODs are split per-triangle, so big meshes are cut up by cell too.
+ *  Drawables' LODs (Scene::Drawable::lods) are baked into matching LODs of the batches; a drawable
+ *  with LODs goes whole into the cell of its bounds' center, so every level of it is in the same batch.
+ *
+ */
+
+#include "Scene.hpp"
+#include "Mesh.hpp"
+
+#include <functional>
+#include <memory>
+#include <set>
+
+//Merge drawables in 'scene' that draw from 'source' through one of 'source_vaos':
+// - drawables under dynamic transforms (or with dynamic ancestors), or with a material, are left alone
+// - drawables merge when their pipelines match (program, primitive type, textures) and their triangles fall in the same cell
+// - non-magenta Drawable::custom_col values are baked into vertex colors
+// - merged drawables are removed from scene.drawables; each batch becomes a new drawable (with a new, identity transform)
+//    and 'on_batch' (if given) is called so the caller can finish setting it up (e.g., pipeline.material)
+//Returns a new MeshBuffer holding the baked vertices; it must outlive any drawing of the scene.
+// (releasing the last reference deletes its buffer and the batches' vertex arrays)
+std::shared_ptr< MeshBuffer const > bake_static_drawables(Scene &scene, MeshBuffer const &source, std::set< GLuint > const &source_vaos, float cell_size,
+	std::function< void(Scene &, Scene::Drawable &) > const &on_batch = nullptr);
@@ -0,0 +1,198 @@
+//bench-load compares reading chunk files (.pnct, .scene, .atlas) through std::istream + read_chunk
+// with mapping them through ChunkFile, and with reading them out of an asset archive (see Archive.hpp);
+// run each way in its own process, so peak RSS is comparable:
+//   dist/bench-load stream [repeats] dist/*.pnct dist/*.scene dist/*.atlas
+//   dist/bench-load mapped [repeats] dist/*.pnct dist/*.scene dist/*.atlas
+//   dist/bench-load packed [repeats] dist/assets.pak
+// (pack the archive with and without pack-assets -z to compare compressed chunks with raw ones)
+// Both ways touch every byte and, for .pnct vertex chunks, also build the packed positions copy that MeshBuffer keeps.
+// Single runs vary by up to 40% on a busy machine, so compare medians of several alternating stream/mapped runs.
+// On the shipped assets (warm cache) the two were within noise of each other until the meshes were indexed and
+//  quantized; with the chunk data down to 253 kB, stream reads win (about 0.15 ms vs. 0.25 ms per pass), since
+//  the per-file cost of mapping (mmap, page faults, munmap) no longer has much copying to save.
+
+#include "ChunkFile.hpp"
+#include "Archive.hpp"
+#include "read_write_chunk.hpp"
+
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#define PSAPI_VERSION 2
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+//peak resident set size of this process so far, in bytes:
+static uint64_t peak_rss() {
+	#if defined(_WIN32)
+	PROCESS_MEMORY_COUNTERS counters;
+	if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) return 0;
+	return uint64_t(counters.PeakWorkingSetSize);
+	#else
+	struct rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+	#if defined(__APPLE__)
+	return uint64_t(usage.ru_maxrss); //(bytes on macOS)
+	#else
+	return uint64_t(usage.ru_maxrss) * 1024; //(kilobytes on Linux)
+	#endif
+	#endif
+}
+
+struct Vertex {
+	glm::vec3 Position;
+	glm::vec3 Normal;
+	glm::u8vec4 Color;
+	glm::vec2 TexCoord;
+};
+static_assert(sizeof(Vertex) == 3*4+3*4+4*1+2*4, "Vertex is packed.");
+
+//what loading does with the data: sum its bytes (so every page is touched), keep positions of vertex chunks:
+struct Sink {
+	uint64_t checksum = 0;
+	uint64_t bytes = 0;
+	std::vector< std::vector< glm::vec3 > > positions; //kept until the end, like MeshBuffer::positions
+
+	void bytes_of(void const *data, size_t size) {
+		unsigned char const *b = reinterpret_cast< unsigned char const * >(data);
+		for (size_t i = 0; i < size; ++i) checksum += b[i];
+		bytes += size;
+	}
+	template< typename Vertices >
+	void vertices(Vertices const &data) {
+		positions.emplace_back();
+		positions.back().reserve(data.size());
+		for (auto const &v : data) positions.back().emplace_back(v.Position);
+		bytes_of(data.data(), data.size() * sizeof(Vertex));
+	}
+};
+
+static void load_stream(std::string const &filename, Sink *sink) {
+	std::ifstream file(filename, std::ios::binary);
+	if (!file) throw std::runtime_error("Failed to open '" + filename + "'.");
+	while (file.peek() != EOF) {
+		char magic[4];
+		if (!file.read(magic, 4)) throw std::runtime_error("Failed to read chunk header");
+		file.seekg(-4, std::ios::cur);
+		if (std::string(magic, 4) == "pnct") {
+			std::vector< Vertex > data;
+			read_chunk(file, "pnct", &data);
+			sink->vertices(data);
+		} else {
+			std::vector< char > data;
+			read_chunk(file, std::string(magic, 4), &data);
+			sink->bytes_of(data.data(), data.size());
+		}
+	}
+}
+
+static void read_chunks(ChunkFile &file, Sink *sink) {
+	while (!file.at_end()) {
+		std::string magic = file.next_magic();
+		if (magic.empty()) throw std::runtime_error("Failed to read chunk header");
+		if (magic == "pnct") {
+			sink->vertices(file.read< Vertex >("pnct"));
+		} else {
+			ChunkFile::Span< char > data = file.read< char >(magic);
+			sink->bytes_of(data.data(), data.size());
+		}
+	}
+}
+
+static void load_mapped(std::string const &filename, Sink *sink) {
+	ChunkFile file(filename);
+	read_chunks(file, sink);
+}
+
+//every chunk file in the archive:
+static void load_packed(std::string const &filename, Sink *sink, uint32_t *files) {
+	Archive archive(filename);
+	for (uint32_t e = 0; e < archive.header.entry_count; ++e) {
+		Archive::Entry const &entry = archive.entries[e];
+		std::string name(archive.names + entry.name_begin, archive.names + entry.name_end);
+		std::string extension = name.substr(std::min(name.size(), name.rfind('.')));
+		if (extension != ".pnct" && extension != ".scene" && extension != ".atlas") continue;
+		ChunkFile file(name, archive.file.data + entry.offset, size_t(entry.size));
+		read_chunks(file, sink);
+		*files += 1;
+	}
+}
+
+int main(int argc, char **argv) {
+#ifdef _WIN32
+	//when compiled on windows, unhandled exceptions don't have their message printed, which can make debugging simple issues difficult.
+	try {
+#endif
+
+	auto usage = [&]() {
+		std::cerr << "Usage:\n\t" << argv[0] << " stream|mapped [repeats] <file> [file ...]\n\t" << argv[0] << " packed [repeats] <archive>\nTimes reading chunk files one way or another; run once per way to compare peak RSS." << std::endl;
+		return 1;
+	};
+	if (argc < 3) return usage();
+	std::string mode = argv[1];
+	if (mode != "stream" && mode != "mapped" && mode != "packed") return usage();
+	int first_file = 2;
+	uint32_t repeats = 1;
+	if (argv[2][0] >= '0' && argv[2][0] <= '9') {
+		repeats = uint32_t(std::max(1, std::atoi(argv[2])));
+		first_file = 3;
+	}
+	if (first_file >= argc) return usage();
+
+	uint64_t rss_before = peak_rss();
+	Sink sink;
+	uint32_t files = 0;
+	double ms = 0.0;
+	for (uint32_t r = 0; r < repeats; ++r) {
+		sink = Sink(); //(each pass holds its own positions, as if loading fresh)
+		files = 0;
+		auto before = std::chrono::high_resolution_clock::now();
+		for (int i = first_file; i < argc; ++i) {
+			if (mode == "stream") load_stream(argv[i], &sink);
+			else if (mode == "mapped") load_mapped(argv[i], &sink);
+			else load_packed(argv[i], &sink, &files);
+			if (mode != "packed") files += 1;
+		}
+		auto after = std::chrono::high_resolution_clock::now();
+		ms += std::chrono::duration< double, std::milli >(after - before).count();
+	}
+	uint64_t rss_after = peak_rss();
+
+	std::cout << mode << ": " << files << " files, " << sink.bytes / 1024 << " kB of chunk data; "
+		<< ms / repeats << " ms per pass (" << repeats << " passes); peak RSS " << rss_after / 1024 << " kB ("
+		<< (rss_after - rss_before) / 1024 << " kB over startup). [checksum " << sink.checksum << "]" << std::endl;
+	if (mode != "stream") {
+		std::cout << "  " << ChunkFile::stats.files << " files mapped, " << ChunkFile::stats.mapped_bytes / 1024 << " kB, "
+			<< ChunkFile::stats.copied_bytes << " bytes copied for alignment." << std::endl;
+		if (ChunkFile::stats.compressed_chunks) {
+			std::cout << "  " << ChunkFile::stats.compressed_chunks << " compressed chunks inflated from " << ChunkFile::stats.compressed_bytes / 1024
+				<< " kB to " << ChunkFile::stats.inflated_bytes / 1024 << " kB (" << double(ChunkFile::stats.inflated_bytes) / double(ChunkFile::stats.compressed_bytes) << ":1)." << std::endl;
+		}
+	}
+
+	return 0;
+
+#ifdef _WIN32
+	} catch (std::exception const &e) {
+		std::cerr << "Unhandled exception:\n" << e.what() << std::endl;
+		return 1;
+	} catch (...) {
+		std::cerr << "Unhandled exception (unknown type)." << std::endl;
+		throw;
+	}
+#endif
+}
@@ -0,0 +1,167 @@
+//bench-render times the CPU side of Scene::draw on generated scenes.
+// It is linked against GL-null.cpp instead of GL.cpp (see GL-null.hpp), so it needs no GPU or window;
+// run from anywhere as:
+//   dist/bench-render [drawables ...]
+// (default: 100 1000 10000 drawables)
+
+#include "Scene.hpp"
+#include "LitColorTextureProgram.hpp"
+#include "Load.hpp"
+#include "GL.hpp"
+#include "GL-null.hpp"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+//A square grid of 'count' drawables using a handful of made-up meshes, some instanced, some tinted,
+// with a point lamp for every ten drawables:
+static void generate(Scene &scene, uint32_t count) {
+	//"meshes" are just vertex ranges in a few (names of) vertex arrays -- GL-null doesn't look at the data:
+	struct FakeMesh {
+		GLuint vao;
+		GLuint start, count;
+		glm::vec3 min, max;
+	};
+	std::vector< FakeMesh > meshes;
+	for (uint32_t i = 0; i < 8; ++i) {
+		GLuint vao = 0;
+		glGenVertexArrays(1, &vao);
+		FakeMesh mesh;
+		mesh.vao = vao;
+		mesh.start = 0;
+		mesh.count = 36 * (1 + i * i); //from a cube to a couple thousand triangles
+		mesh.min = glm::vec3(-1.0f, -1.0f, 0.0f);
+		mesh.max = glm::vec3( 1.0f,  1.0f, 1.0f + i);
+		meshes.emplace_back(mesh);
+	}
+
+	uint32_t side = uint32_t(std::ceil(std::sqrt(float(count))));
+	float spacing = 4.0f;
+	for (uint32_t i = 0; i < count; ++i) {
+		scene.transforms.emplace_back();
+		Scene::Transform *transform = &scene.transforms.back();
+		transform->name = "drawable" + std::to_string(i);
+		transform->position = glm::vec3(float(i % side) * spacing, float(i / side) * spacing, 0.0f);
+
+		FakeMesh const &mesh = meshes[(i * 7) % meshes.size()];
+		scene.drawables.emplace_back(transform);
+		Scene::Drawable &drawable = scene.drawables.back();
+		drawable.pipeline = lit_color_texture_program_pipeline;
+		drawable.pipeline.vao = mesh.vao;
+		drawable.pipeline.type = GL_TRIANGLES;
+		drawable.pipeline.start = mesh.start;
+		drawable.pipeline.count = mesh.count;
+		//the small meshes are the sort of thing that gets instanced:
+		if (mesh.count < 400) drawable.pipeline.instanced.vao = mesh.vao;
+		drawable.has_bounds = true;
+		drawable.min = mesh.min;
+		drawable.max = mesh.max;
+		if (i % 3 == 0) drawable.custom_col = scene.make_custom_col(glm::vec4(0.2f, 0.4f, 0.8f, 1.0f));
+
+		if (i % 10 == 0) {
+			scene.transforms.emplace_back();
+			Scene::Transform *lamp_transform = &scene.transforms.back();
+			lamp_transform->name = "lamp" + std::to_string(i);
+			lamp_transform->position = transform->position + glm::vec3(0.0f, 0.0f, 3.0f);
+			scene.lamps.emplace_back(lamp_transform);
+			Scene::Lamp &lamp = scene.lamps.back();
+			lamp.type = Scene::Lamp::Point;
+			lamp.energy = glm::vec3(1.0f, 0.8f, 0.6f);
+			lamp.distance = 8.0f;
+		}
+	}
+}
+
+int main(int argc, char **argv) {
+#ifdef _WIN32
+	//when compiled on windows, unhandled exceptions don't have their message printed, which can make debugging simple issues difficult.
+	try {
+#endif
+
+	std::vector< uint32_t > sizes;
+	for (int i = 1; i < argc; ++i) {
+		int count = std::atoi(argv[i]);
+		if (count <= 0) {
+			std::cerr << "Usage:\n\t" << argv[0] << " [drawables ...]\nTimes Scene::draw (against null OpenGL) on generated scenes of the given sizes." << std::endl;
+			return 1;
+		}
+		sizes.emplace_back(uint32_t(count));
+	}
+	if (sizes.empty()) sizes = { 100, 1000, 10000 };
+
+	init_GL(); //(does nothing for GL-null)
+	call_load_functions();
+
+	glm::uvec2 drawable_size = glm::uvec2(1280, 720);
+	uint32_t const warmup_frames = 10;
+	uint32_t const frames = 100;
+
+	for (uint32_t size : sizes) {
+		Scene scene;
+		generate(scene, size);
+
+		//camera at one corner of the grid, looking across it (so roughly half of it is in view):
+		float extent = std::ceil(std::sqrt(float(size))) * 4.0f;
+		glm::mat4 world_to_clip =
+			glm::perspective(glm::radians(60.0f), float(drawable_size.x) / float(drawable_size.y), 0.5f, 2.0f * extent + 10.0f)
+			* glm::lookAt(glm::vec3(-5.0f, -5.0f, 15.0f), glm::vec3(0.5f * extent, 0.5f * extent, 0.0f), glm::vec3(0.0f, 0.0f, 1.0f));
+
+		for (uint32_t f = 0; f < warmup_frames; ++f) {
+			scene.draw(drawable_size, world_to_clip);
+		}
+
+		gl_null.reset();
+		auto before = std::chrono::high_resolution_clock::now();
+		for (uint32_t f = 0; f < frames; ++f) {
+			scene.draw(drawable_size, world_to_clip);
+		}
+		auto after = std::chrono::high_resolution_clock::now();
+
+		double frame_ns = std::chrono::duration< double, std::nano >(after - before).count() / frames;
+		Scene::DrawStats const &stats = scene.stats;
+		std::cout << size << " drawables (" << scene.lamps.size() << " point lamps): "
+			<< frame_ns / 1.0e6 << " ms per frame; "
+			<< frame_ns / size << " ns per drawable, "
+			<< frame_ns / std::max(stats.drawables, 1U) << " ns per submitted drawable." << std::endl;
+		std::cout << "  submitted " << stats.drawables << " (" << stats.culled << " culled) in "
+			<< stats.draw_calls << " draw calls (" << stats.instanced_draw_calls << " instanced); "
+			<< scene.commands.count << " render commands (" << scene.commands.bytes() / 1024 << " kB)." << std::endl;
+		std::cout << "  per frame: " << gl_null.total / frames << " GL calls -- "
+			<< gl_null.binds / frames << " binds, "
+			<< gl_null.uniforms / frames << " uniform uploads, "
+			<< gl_null.draws / frames << " draws (" << gl_null.vertices / frames << " vertices), "
+			<< gl_null.uploaded_bytes / frames / 1024 << " kB uploaded." << std::endl;
+
+		//most-called entry points:
+		std::vector< uint32_t > order(GLNull::FunctionCount);
+		for (uint32_t i = 0; i < order.size(); ++i) order[i] = i;
+		std::sort(order.begin(), order.end(), [](uint32_t a, uint32_t b) {
+			return gl_null.calls[a] > gl_null.calls[b];
+		});
+		std::cout << "  most called:";
+		for (uint32_t i = 0; i < 5 && gl_null.calls[order[i]] != 0; ++i) {
+			std::cout << " " << GLNull::FunctionNames[order[i]] << " (" << gl_null.calls[order[i]] / frames << ")";
+		}
+		std::cout << std::endl;
+	}
+
+	return 0;
+
+#ifdef _WIN32
+	} catch (std::exception const &e) {
+		std::cerr << "Unhandled exception:\n" << e.what() << std::endl;
+		return 1;
+	} catch (...) {
+		std::cerr << "Unhandled exception (unknown type)." << std::endl;
+		throw;
+	}
+#endif
+}
@@ -2,50 +2,62 @@
 
 in vec2 TexCoords;
 uniform sampler2D IMG;
-uniform sampler2D FRAME; // only used when TASK==2: the originally rendered frame
-uniform sampler2D HIGHLIGHT;
-uniform int TASK; // 0: blur horizontally; 1: blur vertically; 2: combine result and draw to screen
+uniform sampler2D FRAME; // only used when TASK==3: the originally rendered frame
+uniform int TASK; // 0: keep bright pixels of IMG (the first pass's bright color), at half size; 1: downsample IMG; 2: upsample IMG (added onto the target); 3: combine IMG (bloom) with FRAME and draw to screen
 out vec4 fragColor;
 
 bool is_light(vec4 col) {
   return col.a==1 && (col.r==1 || col.g==1 || col.b==1);
 }
 
-vec4 over(vec4 elem, vec4 canvas) {
-  vec4 elem_ = vec4(elem.rgb * elem.a, elem.a);
-  float ca = 1 - (1-elem_.a) * (1-canvas.a);
-  float cr = (1-elem_.a) * canvas.r + elem_.r;
-  float cg = (1-elem_.a) * canvas.g + elem_.g;
-  float cb = (1-elem_.a) * canvas.b + elem_.b;
-  return vec4(cr, cg, cb, ca);
+// the upsample passes add every level of the chain together:
+const float BLOOM_SCALE = 1.0 / 3.0;
+
+// box filter over the 4x4 source texels under a 2x smaller target texel (4 bilinear taps):
+vec4 downsample() {
+  vec2 t = 1.0 / textureSize(IMG, 0);
+  return 0.25 * (
+    texture(IMG, TexCoords + vec2(-t.x,-t.y)) + texture(IMG, TexCoords + vec2( t.x,-t.y))
+  + texture(IMG, TexCoords + vec2(-t.x, t.y)) + texture(IMG, TexCoords + vec2( t.x, t.y)) );
 }
 
-float weight[5] = float[] (0.227027, 0.1945946, 0.1216216, 0.054054, 0.016216);
+// 3x3 tent filter over the (smaller) source:
+vec4 upsample() {
+  vec2 t = 1.0 / textureSize(IMG, 0);
+  vec4 result = 4.0 * texture(IMG, TexCoords);
+  result += 2.0 * (texture(IMG, TexCoords + vec2(t.x, 0)) + texture(IMG, TexCoords - vec2(t.x, 0))
+                 + texture(IMG, TexCoords + vec2(0, t.y)) + texture(IMG, TexCoords - vec2(0, t.y)));
+  result += texture(IMG, TexCoords + t) + texture(IMG, TexCoords - t)
+          + texture(IMG, TexCoords + vec2(t.x, -t.y)) + texture(IMG, TexCoords + vec2(-t.x, t.y));
+  return result / 16.0;
+}
 
 void main() {
-  if (TASK == 0 || TASK == 1) {
-    vec2 tex_offset = 1.0 / textureSize(IMG, 0);
-    vec4 result = texture(IMG, TexCoords) * weight[0];
-    if (TASK == 0) { // horizontal blur
-      for(int i = 1; i < 5; ++i) {
-        result += texture(IMG, TexCoords + vec2(tex_offset.x * i, 0)) * weight[i];
-        result += texture(IMG, TexCoords - vec2(tex_offset.x * i, 0)) * weight[i];
-      }
-    } else if (TASK == 1) { // vertical blur
-      for(int i = 1; i < 5; ++i) {
-        result += texture(IMG, TexCoords + vec2(0, tex_offset.y * i)) * weight[i];
-        result += texture(IMG, TexCoords - vec2(0, tex_offset.y * i)) * weight[i];
-      }
-    }
-    fragColor = result;
+  if (TASK == 0) {
+    vec4 bright = downsample();
+    // nothing bright here: leave the (cleared) target alone, so the occlusion query can tell if there's any bloom at all
+    if (bright.a == 0) discard;
+    fragColor = bright;
+  } else if (TASK == 1) {
+    fragColor = downsample();
+  } else if (TASK == 2) {
+    fragColor = upsample();
   } else { // combine with first pass result
     vec4 firstpass = texture(FRAME, TexCoords);
-    vec4 highlight = texture(HIGHLIGHT, TexCoords);
-    vec4 tex = texture(IMG, TexCoords);
-    if (is_light(highlight)) {
-      fragColor = firstpass + tex * 0.5;
-    } else {
-      fragColor = firstpass + tex;
-    }
+    vec4 tex = vec4(texture(IMG, TexCoords).rgb * BLOOM_SCALE, 0); // (bloom levels have no alpha)
+    // lights themselves are drawn unfogged in the first pass, so they can be recognized there (and get half the bloom);
+    // the first pass may be smaller than the screen (see Scene::resolution_scale), and its filtered colors
+    // aren't exact, so classify the (up to) four texels the filtered read blended, weighted the same way:
+    ivec2 size = textureSize(FRAME, 0);
+    vec2 at = TexCoords * vec2(size) - 0.5;
+    ivec2 base = ivec2(floor(at));
+    vec2 f = at - vec2(base);
+    ivec2 lo = clamp(base, ivec2(0), size - 1);
+    ivec2 hi = clamp(base + 1, ivec2(0), size - 1);
+    float light = mix(
+      mix(float(is_light(texelFetch(FRAME, ivec2(lo.x, lo.y), 0))), float(is_light(texelFetch(FRAME, ivec2(hi.x, lo.y), 0))), f.x),
+      mix(float(is_light(texelFetch(FRAME, ivec2(lo.x, hi.y), 0))), float(is_light(texelFetch(FRAME, ivec2(hi.x, hi.y), 0))), f.x),
+      f.y);
+    fragColor = firstpass + tex * (1.0 - 0.5 * light);
   }
 }
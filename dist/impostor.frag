@@ -0,0 +1,72 @@
+#version 330
+
+uniform sampler2D ATLAS;
+//(must match the declaration in shader.vert)
+layout(std140) uniform Frame {
+  mat4 WORLD_TO_CLIP;
+  mat4x3 WORLD_TO_LIGHT;
+  vec4 FOG_COLOR;
+  vec4 FOG_RANGE;
+  vec4 CLUSTER_SCALE;
+  uvec4 CLUSTER_COUNTS;
+};
+in vec2 texCoord;
+in float depth;
+in float height;
+layout(location = 0) out vec4 fragColor;
+layout(location = 1) out vec4 brightColor;
+
+//(these match shader.frag)
+vec4 over(vec4 elem, vec4 canvas) {
+  vec4 elem_ = vec4(elem.rgb * elem.a, elem.a);
+  float ca = 1 - (1-elem_.a) * (1-canvas.a);
+  float cr = (1-elem_.a) * canvas.r + elem_.r;
+  float cg = (1-elem_.a) * canvas.g + elem_.g;
+  float cb = (1-elem_.a) * canvas.b + elem_.b;
+  return vec4(cr, cg, cb, ca);
+}
+
+bool is_light(vec4 col) {
+  return col.a==1 && (col.r==1 || col.g==1 || col.b==1);
+}
+
+void main() {
+  brightColor = vec4(0, 0, 0, 0);
+
+  // tiles are lit but un-fogged, on a transparent background:
+  vec4 tile = texture(ATLAS, texCoord);
+  if (tile.a < 0.5) discard;
+  // (filtering blends edges toward the transparent black background, so undo that)
+  vec4 lit = vec4(tile.rgb / tile.a, 1);
+
+  if (is_light(tile)) {
+    fragColor = tile;
+    brightColor = tile;
+    return;
+  }
+  fragColor = lit;
+
+  // overlay fog color on top (as a function of depth)
+  float depth_ = depth;
+  depth_ = min(depth_, FOG_RANGE.y);
+  depth_ = max(depth_, FOG_RANGE.x);
+  float fog_extent = (depth_-FOG_RANGE.x) / (FOG_RANGE.y-FOG_RANGE.x);
+  vec4 fog = vec4(FOG_COLOR.rgb, fog_extent);
+  fragColor = over(fog, fragColor);
+
+  // overlay height color (as a function of height and depth)
+  vec4 height_col;
+  float height_ = height;
+  height_ = min(height_, 170);
+  height_ = max(height_, 10);
+  if (height_ < 90) {
+    float height_lo = (height_ - 10) / 80;
+    height_col = vec4(0.1,0.1,0.1,1-height_lo);
+  } else {
+    float height_hi = (170 - height_) / 80;
+    height_col = vec4(0.8,0.8,0.8,1-height_hi);
+  }
+  float height_overlay_extent = min((depth_-0.1) / 40, 1);
+  height_col.a = mix(0, height_col.a, height_overlay_extent);
+  fragColor = over(height_col, fragColor);
+}
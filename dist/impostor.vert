@@ -0,0 +1,25 @@
+#version 330
+
+//(must match the declaration in shader.vert)
+layout(std140) uniform Frame {
+  mat4 WORLD_TO_CLIP;
+  mat4x3 WORLD_TO_LIGHT;
+  vec4 FOG_COLOR;
+  vec4 FOG_RANGE;
+  vec4 CLUSTER_SCALE;
+  uvec4 CLUSTER_COUNTS;
+};
+
+//quad corners, written by ImpostorCache::use():
+layout(location = 0) in vec3 Position; //world space
+layout(location = 1) in vec2 TexCoord; //in the atlas
+out vec2 texCoord;
+out float depth;
+out float height;
+
+void main() {
+  gl_Position = WORLD_TO_CLIP * vec4(Position, 1.0);
+  texCoord = TexCoord;
+  depth = gl_Position.z;
+  height = (WORLD_TO_LIGHT * vec4(Position, 1.0)).z;
+}
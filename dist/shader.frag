@@ -1,6 +1,19 @@
 #version 330
 
 uniform sampler2D TEX;
+//(must match the declaration in shader.vert)
+layout(std140) uniform Frame {
+  mat4 WORLD_TO_CLIP;
+  mat4x3 WORLD_TO_LIGHT;
+  vec4 FOG_COLOR; //rgb
+  vec4 FOG_RANGE; //x: depth where fog starts, y: depth where fog is complete
+  vec4 CLUSTER_SCALE; //xy: light grid tiles per pixel, z: slices per log2(depth), w: slice of depth 1
+  uvec4 CLUSTER_COUNTS; //xyz: light grid size (zero when there are no point lights)
+};
+//the light grid (see LightClusters.hpp):
+uniform usamplerBuffer CLUSTERS; //per cell: offset and count in LIGHT_INDICES
+uniform usamplerBuffer LIGHT_INDICES;
+uniform samplerBuffer LIGHTS; //per light: position + radius, color
 in vec3 position;
 in vec3 normal;
 in vec4 color;
@@ -23,6 +36,30 @@ bool is_light(vec4 col) {
   return col.a==1 && (col.r==1 || col.g==1 || col.b==1);
 }
 
+// light from the point lights binned into this fragment's cell of the light grid:
+vec3 point_lights(vec3 p, vec3 n) {
+  if (CLUSTER_COUNTS.x == 0u) return vec3(0);
+  ivec3 counts = ivec3(CLUSTER_COUNTS.xyz);
+  float w = 1.0 / gl_FragCoord.w; // (clip-space w, i.e., view depth)
+  ivec3 cell = ivec3(ivec2(gl_FragCoord.xy * CLUSTER_SCALE.xy), int(floor(log2(w) * CLUSTER_SCALE.z + CLUSTER_SCALE.w)));
+  cell = clamp(cell, ivec3(0), counts - 1);
+  uvec2 run = texelFetch(CLUSTERS, cell.x + counts.x * (cell.y + counts.y * cell.z)).xy;
+
+  vec3 sum = vec3(0);
+  for (uint i = 0u; i < run.y; ++i) {
+    int light = int(texelFetch(LIGHT_INDICES, int(run.x + i)).x);
+    vec4 position_radius = texelFetch(LIGHTS, 2 * light);
+    vec3 color = texelFetch(LIGHTS, 2 * light + 1).rgb;
+    vec3 to_light = position_radius.xyz - p;
+    float d2 = dot(to_light, to_light);
+    // inverse-square falloff, windowed to reach zero at the light's radius:
+    float window = clamp(1.0 - d2 / (position_radius.w * position_radius.w), 0.0, 1.0);
+    float lambert = max(dot(n, to_light * inversesqrt(max(d2, 1e-4))), 0.0);
+    sum += color * (lambert * window * window / (1.0 + d2));
+  }
+  return sum;
+}
+
 void main() {
   brightColor = vec4(0, 0, 0, 0);
 
@@ -38,14 +75,15 @@ void main() {
 
 	// simple hemispherical lighting model:
 	vec3 light = mix(vec3(0.0,0.0,0.1), vec3(1.0,1.0,0.95), dot(n,l)*0.5+0.5);
+	light += point_lights(position, n);
 	fragColor = vec4(light*albedo.rgb, albedo.a);
 
   // overlay fog color on top (as a function of depth)
   float depth_ = depth;
-  depth_ = min(depth_, 200);
-  depth_ = max(depth_, 0.1);
-  float fog_extent = (depth_-0.1) / 199.9;
-  vec4 fog = vec4(0.5, 0.56, 0.6, fog_extent);
+  depth_ = min(depth_, FOG_RANGE.y);
+  depth_ = max(depth_, FOG_RANGE.x);
+  float fog_extent = (depth_-FOG_RANGE.x) / (FOG_RANGE.y-FOG_RANGE.x);
+  vec4 fog = vec4(FOG_COLOR.rgb, fog_extent);
   fragColor = over(fog, fragColor);
   
   // overlay height color (as a function of height and depth)
@@ -1,14 +1,39 @@
 #version 330
 
-uniform mat4 OBJECT_TO_CLIP;
-uniform mat4x3 OBJECT_TO_LIGHT;
-uniform mat3 NORMAL_TO_LIGHT;
-uniform vec4 CUSTOM_COL;
-uniform vec3 ANCHOR_POS;
-in vec4 Position;
-in vec3 Normal;
-in vec4 Color;
-in vec2 TexCoord;
+//per-frame data, filled by Scene::draw (see Scene::FrameUniforms):
+layout(std140) uniform Frame {
+  mat4 WORLD_TO_CLIP;
+  mat4x3 WORLD_TO_LIGHT;
+  vec4 FOG_COLOR;
+  vec4 FOG_RANGE;
+  vec4 CLUSTER_SCALE;
+  uvec4 CLUSTER_COUNTS;
+};
+
+//INSTANCED is #define'd (by LitColorTextureProgram) for the instanced variant,
+// which reads per-object data from per-instance attributes instead of the Object block.
+#ifdef INSTANCED
+layout(location = 4) in vec4 InstanceToWorld0; //rows of object-to-world matrix
+layout(location = 5) in vec4 InstanceToWorld1;
+layout(location = 6) in vec4 InstanceToWorld2;
+layout(location = 7) in vec3 InstanceNormal0; //columns of normal-to-light matrix
+layout(location = 8) in vec3 InstanceNormal1;
+layout(location = 9) in vec3 InstanceNormal2;
+layout(location = 10) in vec4 InstanceColor;
+#else
+//per-object data, a range of Scene's ring buffer (see Scene::ObjectUniforms):
+layout(std140) uniform Object {
+  mat4 OBJECT_TO_CLIP;
+  mat4x3 OBJECT_TO_LIGHT;
+  mat3 NORMAL_TO_LIGHT;
+  vec4 CUSTOM_COL;
+};
+#endif
+//explicit locations, so the depth-only variants (which drop unused attributes) can share vaos:
+layout(location = 0) in vec4 Position;
+layout(location = 1) in vec3 Normal;
+layout(location = 2) in vec4 Color;
+layout(location = 3) in vec2 TexCoord;
 out vec3 position;
 out vec3 normal;
 out vec4 color;
@@ -16,16 +41,27 @@ out vec2 texCoord;
 out float depth;
 out float height;
 
+//depth-only and color variants must agree exactly for GL_EQUAL depth testing:
+invariant gl_Position;
+
 bool is_magenta(vec4 c) {
   return(c.x==1 && c.y==0 && c.z==1 && c.w==1);
 }
 
 void main() {
+#ifdef INSTANCED
+  vec4 world = vec4(dot(InstanceToWorld0, Position), dot(InstanceToWorld1, Position), dot(InstanceToWorld2, Position), 1.0);
+  gl_Position = WORLD_TO_CLIP * world;
+  position = WORLD_TO_LIGHT * world;
+  normal = mat3(InstanceNormal0, InstanceNormal1, InstanceNormal2) * Normal;
+  vec4 CUSTOM_COL = InstanceColor;
+#else
 	gl_Position = OBJECT_TO_CLIP * Position;
-  depth = gl_Position.z;
-  height = ANCHOR_POS.z + Position.y;
 	position = OBJECT_TO_LIGHT * Position;
 	normal = NORMAL_TO_LIGHT * Normal;
+#endif
+  depth = gl_Position.z;
+  height = position.z; //world-space height (light space == world space)
 	color = is_magenta(CUSTOM_COL) ? Color : CUSTOM_COL;
 	texCoord = TexCoord;
 }
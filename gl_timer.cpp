@@ -0,0 +1,40 @@
+#include "gl_timer.hpp"
+
+#include <cassert>
+
+void GLTimer::begin() {
+	if (queries[0] == 0) glGenQueries(2 * Depth, queries);
+
+	collect(false);
+	if (pending[next]) {
+		//all slots are in flight; wait for the oldest rather than drop it:
+		collect(true);
+	}
+	glQueryCounter(queries[2 * next + 0], GL_TIMESTAMP);
+}
+
+void GLTimer::end() {
+	assert(queries[0] != 0 && !pending[next]);
+	glQueryCounter(queries[2 * next + 1], GL_TIMESTAMP);
+	pending[next] = true;
+	next = (next + 1) % Depth;
+}
+
+void GLTimer::collect(bool wait) {
+	//slots finish in order, starting with the oldest (the one 'next' will reuse):
+	for (uint32_t i = 0; i < Depth; ++i) {
+		uint32_t slot = (next + i) % Depth;
+		if (!pending[slot]) continue;
+		if (!wait) {
+			GLuint available = 0;
+			glGetQueryObjectuiv(queries[2 * slot + 1], GL_QUERY_RESULT_AVAILABLE, &available);
+			if (!available) break;
+		}
+		GLuint64 t0 = 0, t1 = 0;
+		glGetQueryObjectui64v(queries[2 * slot + 0], GL_QUERY_RESULT, &t0);
+		glGetQueryObjectui64v(queries[2 * slot + 1], GL_QUERY_RESULT, &t1);
+		milliseconds = float(double(t1 - t0) * 1.0e-6);
+		pending[slot] = false;
+		if (wait) break;
+	}
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "GL.hpp"
+
+#include <cstdint>
+
+//measures GPU time between begin() and end() using timestamp queries.
+// results are collected a few frames later (whenever they are available), so the CPU never waits on the GPU.
+// (timestamps, unlike GL_TIME_ELAPSED, are fine to use inside another timer's begin/end)
+struct GLTimer {
+	void begin();
+	void end();
+
+	//most recently collected result (0 until one is available):
+	float milliseconds = 0.0f;
+
+	//internals:
+	enum : uint32_t { Depth = 4 }; //measurements that may be in flight at once
+	GLuint queries[2 * Depth] = { 0 }; //(begin, end) pairs; created on first use
+	bool pending[Depth] = { false };
+	uint32_t next = 0;
+	void collect(bool wait);
+};
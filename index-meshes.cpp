@@ -0,0 +1,408 @@
+#include "ChunkFile.hpp"
+#include "read_write_chunk.hpp"
+#include "mesh_vertex.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/*
+ * convert a triangle-soup mesh file (as written by export-meshes.py) into an indexed one:
+ *   scenes/index-meshes [-q] [-l mesh ...] dist/test_scene.pnct dist/test_scene.pnct
+ *
+ * Each mesh's identical vertices are welded, its triangles are reordered for the post-transform
+ *  vertex cache (Forsyth's "linear-speed vertex cache optimisation"), and its vertices are then
+ *  renumbered in order of first use (so vertex fetches walk the buffer front-to-back).
+ *
+ * The output has the same chunks as the input plus an index chunk right after the vertices:
+ *   'pnct' welded vertices
+ *   'ix16' or 'ix32' indices into them (16-bit if there are few enough vertices)
+ *   'str0' names
+ *   'idx0' index entries, whose ranges are now ranges of indices rather than of vertices
+ * MeshBuffer reads either kind of file.
+ *
+ * With -q, vertices are also quantized (see mesh_vertex.hpp), and the 'pnct' chunk is replaced by
+ *   'qnt0' the bounds quantized positions span (the whole file's, so all meshes and their LODs dequantize alike)
+ *   'pnq0' quantized vertices
+ *
+ * With -l mesh (repeatable), coarser versions of that mesh are generated by vertex clustering and added
+ *  as 'mesh.lod1' and 'mesh.lod2', which MeshBuffer links into the mesh's LOD chain (see Mesh::lods).
+ *
+ */
+
+typedef MeshVertex Vertex;
+
+struct IndexEntry {
+	uint32_t name_begin, name_end;
+	uint32_t vertex_begin, vertex_end;
+};
+static_assert(sizeof(IndexEntry) == 16, "Index entry should be packed");
+
+//---- Forsyth's vertex cache optimisation ----
+//(see https://tomforsyth1000.github.io/papers/fast_vert_cache_opt.html)
+
+static const uint32_t CacheSize = 32;
+
+static float vertex_score(int32_t cache_position, uint32_t remaining) {
+	if (remaining == 0) return -1.0f; //no triangles left to use it
+	float score = 0.0f;
+	if (cache_position >= 0) {
+		if (cache_position < 3) {
+			score = 0.75f; //used by the last triangle; fixed, so the next triangle doesn't just pick a neighbor of it
+		} else {
+			score = std::pow(1.0f - float(cache_position - 3) / float(CacheSize - 3), 1.5f);
+		}
+	}
+	//boost vertices with few triangles left, so lone triangles don't get stranded:
+	score += 2.0f * std::pow(float(remaining), -0.5f);
+	return score;
+}
+
+//reorder triangles (in place) for a post-transform cache:
+static void optimize_triangle_order(std::vector< uint32_t > *indices_, uint32_t vertex_count) {
+	std::vector< uint32_t > &indices = *indices_;
+	uint32_t triangle_count = uint32_t(indices.size() / 3);
+	if (triangle_count == 0) return;
+
+	//triangles using each vertex:
+	std::vector< uint32_t > use_begin(vertex_count + 1, 0);
+	for (uint32_t i : indices) use_begin[i + 1] += 1;
+	for (uint32_t v = 0; v < vertex_count; ++v) use_begin[v + 1] += use_begin[v];
+	std::vector< uint32_t > uses(indices.size());
+	{
+		std::vector< uint32_t > fill(use_begin.begin(), use_begin.end() - 1);
+		for (uint32_t t = 0; t < triangle_count; ++t) {
+			for (uint32_t j = 0; j < 3; ++j) uses[fill[indices[3*t+j]]++] = t;
+		}
+	}
+
+	std::vector< uint32_t > remaining(vertex_count);
+	std::vector< int32_t > cache_position(vertex_count, -1);
+	std::vector< float > score(vertex_count);
+	for (uint32_t v = 0; v < vertex_count; ++v) {
+		remaining[v] = use_begin[v + 1] - use_begin[v];
+		score[v] = vertex_score(-1, remaining[v]);
+	}
+	std::vector< float > triangle_score(triangle_count);
+	std::vector< bool > emitted(triangle_count, false);
+	for (uint32_t t = 0; t < triangle_count; ++t) {
+		triangle_score[t] = score[indices[3*t+0]] + score[indices[3*t+1]] + score[indices[3*t+2]];
+	}
+
+	std::vector< uint32_t > out;
+	out.reserve(indices.size());
+	std::vector< uint32_t > cache; //most recently used first
+	uint32_t best = 0; //start with the best-scoring triangle overall
+	for (uint32_t t = 1; t < triangle_count; ++t) {
+		if (triangle_score[t] > triangle_score[best]) best = t;
+	}
+	uint32_t scan = 0; //(for finding a fresh start when the cache runs dry)
+
+	for (uint32_t emit = 0; emit < triangle_count; ++emit) {
+		if (best == -1U) {
+			while (emitted[scan]) ++scan;
+			best = scan;
+		}
+		emitted[best] = true;
+
+		//move the triangle's vertices to the front of the cache:
+		std::vector< uint32_t > next_cache;
+		for (uint32_t j = 0; j < 3; ++j) {
+			uint32_t v = indices[3*best+j];
+			out.emplace_back(v);
+			remaining[v] -= 1;
+			if (std::find(next_cache.begin(), next_cache.end(), v) == next_cache.end()) next_cache.emplace_back(v);
+		}
+		for (uint32_t v : cache) {
+			if (std::find(next_cache.begin(), next_cache.end(), v) == next_cache.end()) next_cache.emplace_back(v);
+		}
+
+		//rescore everything that was or is in the cache, and the triangles that use them:
+		for (uint32_t i = 0; i < next_cache.size(); ++i) {
+			uint32_t v = next_cache[i];
+			cache_position[v] = (i < CacheSize ? int32_t(i) : -1);
+			score[v] = vertex_score(cache_position[v], remaining[v]);
+		}
+		if (next_cache.size() > CacheSize) next_cache.resize(CacheSize);
+		cache.swap(next_cache);
+
+		best = -1U;
+		float best_score = -1.0f;
+		for (uint32_t v : cache) {
+			for (uint32_t u = use_begin[v]; u < use_begin[v + 1]; ++u) {
+				uint32_t t = uses[u];
+				if (emitted[t]) continue;
+				triangle_score[t] = score[indices[3*t+0]] + score[indices[3*t+1]] + score[indices[3*t+2]];
+				if (triangle_score[t] > best_score) {
+					best_score = triangle_score[t];
+					best = t;
+				}
+			}
+		}
+	}
+
+	indices.swap(out);
+}
+
+//---- LOD generation ----
+
+//coarser version of a triangle soup by vertex clustering (Rossignac and Borrel):
+// positions snap to the average position in their cell of a grid 'cells_across' cells across the soup's largest extent,
+// and triangles with two corners in the same cell collapse and are dropped; other attributes are kept per-vertex.
+static std::vector< Vertex > cluster_vertices(Vertex const *soup, uint32_t count, uint32_t cells_across) {
+	glm::vec3 min = glm::vec3( std::numeric_limits< float >::infinity());
+	glm::vec3 max = glm::vec3(-std::numeric_limits< float >::infinity());
+	for (uint32_t v = 0; v < count; ++v) {
+		min = glm::min(min, soup[v].Position);
+		max = glm::max(max, soup[v].Position);
+	}
+	float extent = std::max(max.x - min.x, std::max(max.y - min.y, max.z - min.z));
+	float cell_size = (extent > 0.0f ? extent / float(cells_across) : 1.0f);
+
+	std::vector< std::array< int32_t, 3 > > cells(count);
+	std::map< std::array< int32_t, 3 >, std::pair< glm::vec3, uint32_t > > sums; //cell -> (position sum, count)
+	for (uint32_t v = 0; v < count; ++v) {
+		glm::vec3 at = (soup[v].Position - min) / cell_size;
+		for (uint32_t i = 0; i < 3; ++i) {
+			cells[v][i] = std::min(int32_t(cells_across) - 1, int32_t(std::floor(at[i])));
+		}
+		auto &sum = sums.insert(std::make_pair(cells[v], std::make_pair(glm::vec3(0.0f), 0U))).first->second;
+		sum.first = sum.first + soup[v].Position;
+		sum.second += 1;
+	}
+
+	std::vector< Vertex > out;
+	for (uint32_t v = 0; v + 2 < count; v += 3) {
+		if (cells[v] == cells[v+1] || cells[v+1] == cells[v+2] || cells[v+2] == cells[v]) continue;
+		for (uint32_t i = 0; i < 3; ++i) {
+			auto const &sum = sums[cells[v+i]];
+			out.emplace_back(soup[v+i]);
+			out.back().Position = sum.first / float(sum.second);
+		}
+	}
+	return out;
+}
+
+//average vertex shader runs per triangle through a 16-entry FIFO cache (a common hardware model):
+static float acmr(std::vector< uint32_t > const &indices) {
+	if (indices.empty()) return 0.0f;
+	std::deque< uint32_t > fifo;
+	uint32_t misses = 0;
+	for (uint32_t i : indices) {
+		if (std::find(fifo.begin(), fifo.end(), i) != fifo.end()) continue;
+		misses += 1;
+		fifo.emplace_back(i);
+		if (fifo.size() > 16) fifo.pop_front();
+	}
+	return float(misses) / float(indices.size() / 3);
+}
+
+int main(int argc, char **argv) {
+#ifdef _WIN32
+	try { //windows doesn't print nice errors for unhandled exceptions, so we need to.
+#endif
+	bool quantized = false;
+	std::vector< std::string > lod_meshes;
+	int first = 1;
+	bool usage = false;
+	while (first < argc && argv[first][0] == '-') {
+		std::string arg = argv[first];
+		if (arg == "-q") {
+			quantized = true;
+			first += 1;
+		} else if (arg == "-l" && first + 1 < argc) {
+			lod_meshes.emplace_back(argv[first + 1]);
+			first += 2;
+		} else {
+			usage = true;
+			break;
+		}
+	}
+	if (usage || argc != first + 2) {
+		std::cerr << "Usage:\n\t./index-meshes [-q] [-l mesh ...] <in.pnct> <out.pnct>\n";
+		std::cerr << " will weld, index, and reorder the meshes in in.pnct, writing them to out.pnct (which may be the same file).\n";
+		std::cerr << " -q also quantizes the vertices (to " << sizeof(QuantizedMeshVertex) << " bytes from " << sizeof(Vertex) << ").\n";
+		std::cerr << " -l mesh also generates mesh.lod1 and mesh.lod2 (coarser versions, by vertex clustering).\n";
+		std::cerr.flush();
+		return 1;
+	}
+	std::string in_path = argv[first];
+	std::string out_path = argv[first + 1];
+
+	std::vector< Vertex > in_vertices;
+	std::vector< char > strings;
+	std::vector< IndexEntry > in_index;
+	{
+		ChunkFile in(in_path);
+		ChunkFile::Span< Vertex > vertices = in.read< Vertex >("pnct");
+		if (in.next_magic() == "ix16" || in.next_magic() == "ix32") {
+			throw std::runtime_error("'" + in_path + "' is already indexed.");
+		}
+		ChunkFile::Span< char > names = in.read< char >("str0");
+		ChunkFile::Span< IndexEntry > index = in.read< IndexEntry >("idx0");
+		in_vertices.assign(vertices.begin(), vertices.end());
+		strings.assign(names.begin(), names.end());
+		in_index.assign(index.begin(), index.end());
+	} //(closes the file, so it can be overwritten)
+
+	//generate LODs (added to the soup, so they get welded and reordered like everything else):
+	for (auto const &name : lod_meshes) {
+		auto named = [&](std::string const &n) -> IndexEntry const * {
+			for (auto const &entry : in_index) {
+				if (entry.name_begin <= entry.name_end && entry.name_end <= strings.size()
+				 && std::string(strings.begin() + entry.name_begin, strings.begin() + entry.name_end) == n) return &entry;
+			}
+			return nullptr;
+		};
+		IndexEntry const *found = named(name);
+		if (!found) throw std::runtime_error("Generating LODs of mesh '" + name + "', which isn't in '" + in_path + "'.");
+		if (named(name + ".lod1")) throw std::runtime_error("Mesh '" + name + "' in '" + in_path + "' already has LODs.");
+		if (!(found->vertex_begin <= found->vertex_end && found->vertex_end <= in_vertices.size())) {
+			throw std::runtime_error("index entry has out-of-range vertex start/count");
+		}
+		IndexEntry source = *found;
+		std::cout << "LODs of '" << name << "': " << (source.vertex_end - source.vertex_begin) / 3 << " triangles";
+		const uint32_t Cells[2] = { 6, 3 }; //grid resolution per level
+		for (uint32_t level = 1; level <= 2; ++level) {
+			std::vector< Vertex > lod = cluster_vertices(in_vertices.data() + source.vertex_begin, source.vertex_end - source.vertex_begin, Cells[level - 1]);
+			if (lod.empty()) break; //(nothing left; a shorter chain will do)
+
+			std::string lod_name = name + ".lod" + std::to_string(level);
+			IndexEntry entry;
+			entry.name_begin = uint32_t(strings.size());
+			strings.insert(strings.end(), lod_name.begin(), lod_name.end());
+			entry.name_end = uint32_t(strings.size());
+			entry.vertex_begin = uint32_t(in_vertices.size());
+			in_vertices.insert(in_vertices.end(), lod.begin(), lod.end());
+			entry.vertex_end = uint32_t(in_vertices.size());
+			in_index.emplace_back(entry);
+			std::cout << ", " << lod.size() / 3 << " in " << lod_name;
+		}
+		std::cout << "." << std::endl;
+	}
+
+	std::vector< Vertex > vertices;
+	std::vector< uint32_t > indices;
+	std::vector< IndexEntry > index;
+	std::map< std::pair< uint32_t, uint32_t >, std::pair< uint32_t, uint32_t > > converted; //vertex range -> index range (names may share ranges)
+	float acmr_before = 0.0f, acmr_after = 0.0f;
+	for (auto const &entry : in_index) {
+		if (!(entry.vertex_begin <= entry.vertex_end && entry.vertex_end <= in_vertices.size())) {
+			throw std::runtime_error("index entry has out-of-range vertex start/count");
+		}
+		if ((entry.vertex_end - entry.vertex_begin) % 3 != 0) {
+			throw std::runtime_error("mesh in '" + in_path + "' isn't a triangle list");
+		}
+		auto range = std::make_pair(entry.vertex_begin, entry.vertex_end);
+		auto f = converted.find(range);
+		if (f == converted.end()) {
+			//weld identical vertices:
+			std::map< std::array< char, sizeof(Vertex) >, uint32_t > welded;
+			std::vector< Vertex > mesh_vertices;
+			std::vector< uint32_t > mesh_indices;
+			for (uint32_t v = entry.vertex_begin; v < entry.vertex_end; ++v) {
+				std::array< char, sizeof(Vertex) > key;
+				std::memcpy(key.data(), &in_vertices[v], sizeof(Vertex));
+				auto w = welded.insert(std::make_pair(key, uint32_t(mesh_vertices.size())));
+				if (w.second) mesh_vertices.emplace_back(in_vertices[v]);
+				mesh_indices.emplace_back(w.first->second);
+			}
+			acmr_before += acmr(mesh_indices) * float(mesh_indices.size() / 3);
+
+			optimize_triangle_order(&mesh_indices, uint32_t(mesh_vertices.size()));
+			acmr_after += acmr(mesh_indices) * float(mesh_indices.size() / 3);
+
+			//renumber vertices in order of first use:
+			std::vector< uint32_t > renumber(mesh_vertices.size(), -1U);
+			uint32_t base = uint32_t(vertices.size());
+			for (uint32_t &i : mesh_indices) {
+				if (renumber[i] == -1U) {
+					renumber[i] = uint32_t(vertices.size()) - base;
+					vertices.emplace_back(mesh_vertices[i]);
+				}
+				i = base + renumber[i];
+			}
+
+			f = converted.insert(std::make_pair(range, std::make_pair(uint32_t(indices.size()), uint32_t(indices.size() + mesh_indices.size())))).first;
+			indices.insert(indices.end(), mesh_indices.begin(), mesh_indices.end());
+		}
+		IndexEntry out = entry;
+		out.vertex_begin = f->second.first;
+		out.vertex_end = f->second.second;
+		index.emplace_back(out);
+	}
+
+	//write:
+	std::ofstream out(out_path, std::ios::binary);
+	size_t vertex_bytes = 0;
+	float position_error = 0.0f, normal_error = 0.0f, texcoord_error = 0.0f;
+	if (quantized) {
+		QuantizedBounds bounds;
+		bounds.min = glm::vec3( std::numeric_limits< float >::infinity());
+		bounds.max = glm::vec3(-std::numeric_limits< float >::infinity());
+		for (auto const &v : vertices) {
+			bounds.min = glm::min(bounds.min, v.Position);
+			bounds.max = glm::max(bounds.max, v.Position);
+		}
+		if (vertices.empty()) bounds = QuantizedBounds();
+		std::vector< QuantizedMeshVertex > quantized_vertices;
+		quantized_vertices.reserve(vertices.size());
+		for (auto const &v : vertices) {
+			quantized_vertices.emplace_back(quantize(v, bounds));
+			Vertex back = dequantize(quantized_vertices.back(), bounds);
+			position_error = std::max(position_error, glm::length(back.Position - v.Position));
+			normal_error = std::max(normal_error, glm::length(back.Normal - v.Normal));
+			texcoord_error = std::max(texcoord_error, glm::length(back.TexCoord - v.TexCoord));
+		}
+		write_chunk("qnt0", std::vector< QuantizedBounds >(1, bounds), &out);
+		write_chunk("pnq0", quantized_vertices, &out);
+		vertex_bytes = quantized_vertices.size() * sizeof(QuantizedMeshVertex);
+	} else {
+		write_chunk("pnct", vertices, &out);
+		vertex_bytes = vertices.size() * sizeof(Vertex);
+	}
+	size_t index_bytes = 0;
+	if (vertices.size() <= 0x10000) {
+		std::vector< uint16_t > indices16(indices.begin(), indices.end());
+		write_chunk("ix16", indices16, &out);
+		index_bytes = indices16.size() * sizeof(uint16_t);
+	} else {
+		write_chunk("ix32", indices, &out);
+		index_bytes = indices.size() * sizeof(uint32_t);
+	}
+	write_chunk("str0", strings, &out);
+	write_chunk("idx0", index, &out);
+	if (!out) {
+		throw std::runtime_error("Failed to write '" + out_path + "'.");
+	}
+
+	uint32_t triangles = uint32_t(indices.size() / 3);
+	std::cout << "Indexed '" << in_path << "': " << in_vertices.size() << " vertices (" << in_vertices.size() * sizeof(Vertex) / 1024 << " kB) became "
+		<< vertices.size() << (quantized ? " quantized" : "") << " (" << vertex_bytes / 1024 << " kB) + " << indices.size() << " "
+		<< (index_bytes == indices.size() * 2 ? 16 : 32) << "-bit indices (" << index_bytes / 1024 << " kB); "
+		<< "vertex shader runs per triangle (16-entry FIFO) went from " << (triangles ? acmr_before / triangles : 0.0f)
+		<< " welded to " << (triangles ? acmr_after / triangles : 0.0f) << " reordered (3.0 before welding)." << std::endl;
+	if (quantized) {
+		std::cout << "  largest quantization errors: position " << position_error << ", normal " << normal_error << " (as decoded by OpenGL 3.3), texcoord " << texcoord_error << "." << std::endl;
+	}
+
+	return 0;
+#ifdef _WIN32
+	} catch (std::exception const &e) {
+		std::cerr << "Unhandled exception:\n" << e.what() << std::endl;
+		return 1;
+	} catch (...) {
+		std::cerr << "Unhandled exception (unknown type)." << std::endl;
+		throw;
+	}
+#endif
+}
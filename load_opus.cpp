@@ -1,7 +1,9 @@
 #include "load_opus.hpp"
+#include "Load.hpp"
 
 #include <opusfile.h>
 
+#include <algorithm>
 #include <cassert>
 #include <memory>
 #include <cmath>
@@ -24,6 +26,7 @@ void load_opus(std::string const &filename, std::vector< float > *data_) {
 	if (err != 0) {
 		throw std::runtime_error("opusfile error " + std::to_string(err) + " opening \"" + filename + "\".");
 	}
+	count_load_bytes_read(std::max< opus_int64 >(0, op_raw_total(op.get(), -1)));
 
 	for (;;) {
 		std::vector< float > pcm(2*48000*2, 0.0f);
@@ -1,4 +1,5 @@
 #include "load_save_png.hpp"
+#include "Load.hpp"
 
 #include <png.h>
 
@@ -26,6 +27,22 @@ void load_png(std::string filename, glm::uvec2 *size, std::vector< glm::u8vec4 >
 	}
 }
 
+void load_png(std::string filename, char const *png, size_t png_size, glm::uvec2 *size, std::vector< glm::u8vec4 > *data, OriginLocation origin) {
+	assert(size);
+
+	//read straight from memory:
+	struct MemoryBuffer : std::streambuf {
+		MemoryBuffer(char const *begin, size_t count) {
+			char *at = const_cast< char * >(begin); //(only ever read through)
+			setg(at, at, at + count);
+		}
+	} buffer(png, png_size);
+	std::istream from(&buffer);
+	if (!load_png(from, &size->x, &size->y, data, origin)) {
+		throw std::runtime_error("Failed to read PNG image from '" + filename + "'.");
+	}
+}
+
 void save_png(std::string filename, glm::uvec2 size, glm::u8vec4 const *data, OriginLocation origin) {
 	std::ofstream file(filename.c_str(), std::ios::binary);
 	save_png(file, size.x, size.y, data, origin);
@@ -38,6 +55,7 @@ static void user_read_data(png_structp png_ptr, png_bytep data, png_size_t lengt
 	if (!from->read(reinterpret_cast< char * >(data), length)) {
 		png_error(png_ptr, "Error reading.");
 	}
+	count_load_bytes_read(length);
 }
 
 static void user_write_data(png_structp png_ptr, png_bytep data, png_size_t length) {
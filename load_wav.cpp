@@ -1,4 +1,5 @@
 #include "load_wav.hpp"
+#include "Load.hpp"
 
 #include <SDL.h>
 
@@ -17,6 +18,7 @@ void load_wav(std::string const &filename, std::vector< float > *data_) {
 	Uint32 audio_len = 0;
 
 	SDL_AudioSpec *have = SDL_LoadWAV(filename.c_str(), &audio_spec, &audio_buf, &audio_len);
+	count_load_bytes_read(audio_len);
 	if (!have) {
 		throw std::runtime_error("Failed to load WAV file '" + filename + "'; SDL says \"" + std::string(SDL_GetError()) + "\"");
 	}
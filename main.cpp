@@ -10,6 +10,9 @@
 //GL.hpp will include a non-namespace-polluting set of opengl prototypes:
 #include "GL.hpp"
 
+//offscreen targets, resized along with the window:
+#include "RenderTargets.hpp"
+
 //for screenshots:
 #include "load_save_png.hpp"
 
@@ -29,6 +32,9 @@ int main(int argc, char **argv) {
   try {
 #endif
 
+  //for reporting time-to-first-frame:
+  auto start_time = std::chrono::high_resolution_clock::now();
+
   //------------  initialization ------------
 
   //Initialize SDL library:
@@ -54,8 +60,8 @@ int main(int argc, char **argv) {
     SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED,
     800, 540, //TODO: modify window size if you'd like
     SDL_WINDOW_OPENGL
-    // | SDL_WINDOW_RESIZABLE //uncomment to allow resizing
-    // | SDL_WINDOW_ALLOW_HIGHDPI //uncomment for full resolution on high-DPI screens
+    | SDL_WINDOW_RESIZABLE //render targets follow the drawable size (see RenderTargets::resize)
+    | SDL_WINDOW_ALLOW_HIGHDPI //full resolution on high-DPI screens
   );
 
   //prevent exceedingly tiny windows when resizing:
@@ -90,7 +96,9 @@ int main(int argc, char **argv) {
   //SDL_ShowCursor(SDL_DISABLE);
 
   //------------ load resources --------------
+  auto load_start_time = std::chrono::high_resolution_clock::now();
   call_load_functions();
+  auto load_end_time = std::chrono::high_resolution_clock::now();
 
   //------------ create game mode + make current --------------
   assert(game_scene);
@@ -110,6 +118,7 @@ int main(int argc, char **argv) {
     SDL_GL_GetDrawableSize(window, &w, &h);
     drawable_size = glm::uvec2(w, h);
     glViewport(0, 0, drawable_size.x, drawable_size.y);
+    render_targets.resize(drawable_size);
   };
   on_resize();
 
@@ -170,10 +179,22 @@ int main(int argc, char **argv) {
     { //(3) call the current mode's "draw" function to produce output:
     
       Mode::current->draw(drawable_size);
+      render_targets.end_frame();
     }
 
     //Wait until the recently-drawn frame is shown before doing it all again:
     SDL_GL_SwapWindow(window);
+
+    static bool first_frame = true;
+    if (first_frame) {
+      first_frame = false;
+      glFinish(); //(so the time includes the GPU finishing the frame)
+      using namespace std::chrono;
+      auto ms = [](high_resolution_clock::duration d) { return duration< double, std::milli >(d).count(); };
+      std::cout << "Time to first frame: " << ms(high_resolution_clock::now() - start_time) << "ms ("
+        << ms(load_start_time - start_time) << "ms window + context, "
+        << ms(load_end_time - load_start_time) << "ms call_load_functions)." << std::endl;
+    }
   }
 
 
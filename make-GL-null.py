@@ -0,0 +1,180 @@
+#!/usr/bin/env python
+
+#Generates GL-null.cpp (see GL-null.hpp) from the prototypes in GL.hpp, as per:
+#python make-GL-null.py
+#(run from the directory containing GL.hpp; re-run whenever GL.hpp changes)
+
+import re
+
+prototype = re.compile(r'^GLAPI (.*?)\s*APIENTRY (\w+) \((.*)\);$') #1.0/1.1 entry points: prototypes everywhere
+pointer = re.compile(r'^GLAPI (.*?)\s*\(APIENTRYFP (\w+)\) \((.*)\);$') #the rest: pointers on Windows, prototypes elsewhere
+
+functions = [] #(return type, name, parameter list, is pointer on windows)
+for line in open('GL.hpp'):
+	line = line.rstrip()
+	m = prototype.match(line)
+	if m:
+		functions.append((m.group(1), m.group(2), m.group(3), False))
+		continue
+	m = pointer.match(line)
+	if m:
+		functions.append((m.group(1), m.group(2), m.group(3), True))
+
+assert len(functions) < 65536 #(trace uses 16-bit indices)
+
+#work done by particular stubs beyond counting; parameter names are as in GL.hpp:
+special = {
+	'glGetError': 'return GL_NO_ERROR;',
+	'glGetString': 'static GLubyte const null[] = "null"; return null;',
+	'glGetStringi': 'static GLubyte const empty[] = ""; return empty;',
+	'glCreateProgram': 'return ++next_name;',
+	'glCreateShader': 'return ++next_name;',
+	'glGetShaderiv': 'if (params) *params = (pname == GL_COMPILE_STATUS ? GL_TRUE : 0);',
+	'glGetProgramiv': 'if (params) *params = (pname == GL_LINK_STATUS || pname == GL_VALIDATE_STATUS ? GL_TRUE : 0);',
+	'glGetShaderInfoLog': 'if (length) *length = 0; if (bufSize > 0) infoLog[0] = \'\\0\';',
+	'glGetProgramInfoLog': 'if (length) *length = 0; if (bufSize > 0) infoLog[0] = \'\\0\';',
+	'glGetIntegerv': 'get(pname, data);',
+	'glGetBooleanv': 'GLint value[4] = { 0, 0, 0, 0 }; if (get(pname, value)) *data = GLboolean(value[0]);',
+	'glGetFloatv': 'GLint value[4] = { 0, 0, 0, 0 }; if (get(pname, value)) *data = GLfloat(value[0]);',
+	'glGetInteger64v': 'GLint value[4] = { 0, 0, 0, 0 }; if (get(pname, value)) *data = GLint64(value[0]);',
+	'glIsEnabled': 'return GL_FALSE;',
+	'glCheckFramebufferStatus': 'return GL_FRAMEBUFFER_COMPLETE;',
+	'glGetQueryObjectiv': 'if (params) *params = (pname == GL_QUERY_RESULT_AVAILABLE ? GL_TRUE : 0);',
+	'glGetQueryObjectuiv': 'if (params) *params = (pname == GL_QUERY_RESULT_AVAILABLE ? GL_TRUE : 0);',
+	'glGetQueryObjecti64v': 'if (params) *params = (pname == GL_QUERY_RESULT_AVAILABLE ? GL_TRUE : 0);',
+	'glGetQueryObjectui64v': 'if (params) *params = (pname == GL_QUERY_RESULT_AVAILABLE ? GL_TRUE : 0);',
+	'glGetBufferParameteriv': 'if (params) *params = 0;',
+	'glGetUniformLocation': 'return 0;',
+	'glGetAttribLocation': 'return 0;',
+	'glGetUniformBlockIndex': 'return 0;',
+	'glGetFragDataLocation': 'return 0;',
+	'glFenceSync': 'static int fence; return reinterpret_cast< GLsync >(&fence);',
+	'glClientWaitSync': 'return GL_ALREADY_SIGNALED;',
+	'glMapBuffer': 'return scratch(1 << 20);',
+	'glMapBufferRange': 'gl_null.uploaded_bytes += uint64_t(length); return scratch(size_t(length));',
+	'glUnmapBuffer': 'return GL_TRUE;',
+	'glBufferData': 'if (data) gl_null.uploaded_bytes += uint64_t(size);',
+	'glBufferSubData': 'gl_null.uploaded_bytes += uint64_t(size);',
+	'glDrawArrays': 'gl_null.vertices += uint64_t(count);',
+	'glDrawElements': 'gl_null.vertices += uint64_t(count);',
+	'glDrawRangeElements': 'gl_null.vertices += uint64_t(count);',
+	'glDrawElementsBaseVertex': 'gl_null.vertices += uint64_t(count);',
+	'glDrawRangeElementsBaseVertex': 'gl_null.vertices += uint64_t(count);',
+	'glDrawArraysInstanced': 'gl_null.vertices += uint64_t(count) * uint64_t(instancecount);',
+	'glDrawElementsInstanced': 'gl_null.vertices += uint64_t(count) * uint64_t(instancecount);',
+	'glDrawElementsInstancedBaseVertex': 'gl_null.vertices += uint64_t(count) * uint64_t(instancecount);',
+}
+
+def kind(name):
+	if name.startswith('glBind') or name in ['glUseProgram', 'glActiveTexture']: return 'binds'
+	if name.startswith('glUniform') and not name.startswith('glUniformBlock'): return 'uniforms'
+	if (name.startswith('glDraw') and name not in ['glDrawBuffer', 'glDrawBuffers']) or name.startswith('glMultiDraw'): return 'draws'
+	return None
+
+def zero(ret):
+	if ret.endswith('*') or ret == 'GLsync': return 'nullptr'
+	return ret + '(0)'
+
+def body(index, ret, name, params):
+	lines = ['call(' + str(index) + ');']
+	k = kind(name)
+	if k: lines.append('gl_null.' + k + ' += 1;')
+	m = re.match(r'^glGen\w+s$', name)
+	if m and params.startswith('GLsizei n, GLuint *'):
+		out = params.split('*')[1]
+		lines.append('for (GLsizei i = 0; i < n; ++i) ' + out + '[i] = ++next_name;')
+	if name in special:
+		lines.append(special[name])
+		if 'return' not in special[name] and ret != 'void':
+			lines.append('return ' + zero(ret) + ';')
+	elif ret != 'void':
+		lines.append('return ' + zero(ret) + ';')
+	return ' '.join(lines)
+
+def unused(params):
+	#names of parameters (so the ones a stub ignores can be cast to void):
+	if params == 'void': return []
+	names = []
+	for p in params.split(','):
+		names.append(re.search(r'(\w+)\s*$', p).group(1))
+	return names
+
+out = open('GL-null.cpp', 'w')
+out.write('''//This file was generated from GL.hpp by make-GL-null.py -- edit that instead.
+// (see GL-null.hpp for what it is for)
+
+#include "GL.hpp"
+#include "GL-null.hpp"
+
+#include <cstddef>
+#include <vector>
+
+char const * const GLNull::FunctionNames[] = {
+''')
+for (ret, name, params, is_pointer) in functions:
+	out.write('\t"' + name + '",\n')
+out.write('''};
+uint32_t const GLNull::FunctionCount = uint32_t(sizeof(GLNull::FunctionNames) / sizeof(GLNull::FunctionNames[0]));
+
+GLNull::GLNull() : calls(FunctionCount, 0) {
+}
+
+void GLNull::reset() {
+	calls.assign(FunctionCount, 0);
+	total = binds = uniforms = draws = vertices = uploaded_bytes = 0;
+	trace.clear();
+}
+
+GLNull gl_null;
+
+static GLuint next_name = 0; //last object name handed out by glGen* / glCreate*
+
+static void call(uint32_t function) {
+	gl_null.calls[function] += 1;
+	gl_null.total += 1;
+	if (gl_null.tracing) gl_null.trace.emplace_back(uint16_t(function));
+}
+
+//memory handed out by glMap*:
+static void *scratch(size_t bytes) {
+	static std::vector< char > memory;
+	if (memory.size() < bytes) memory.resize(bytes);
+	return memory.data();
+}
+
+//values for glGet*v (up to four of them); returns false (leaving 'data' alone) for anything else:
+static bool get(GLenum pname, GLint *data) {
+	switch (pname) {
+		case GL_VIEWPORT: case GL_SCISSOR_BOX: data[0] = data[1] = 0; data[2] = data[3] = 1; return true;
+		case GL_DEPTH_FUNC: *data = GL_LESS; return true;
+		case GL_DEPTH_WRITEMASK: *data = GL_TRUE; return true;
+		case GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT: *data = 256; return true;
+		case GL_MAX_TEXTURE_SIZE: *data = 16384; return true;
+		case GL_MAX_UNIFORM_BLOCK_SIZE: *data = 65536; return true;
+		case GL_MAX_TEXTURE_BUFFER_SIZE: *data = 1 << 27; return true;
+		case GL_DRAW_FRAMEBUFFER_BINDING: case GL_READ_FRAMEBUFFER_BINDING: *data = 0; return true;
+		default: return false;
+	}
+}
+
+void init_GL() {
+	//nothing to look up
+}
+
+extern "C" {
+
+''')
+for i, (ret, name, params, is_pointer) in enumerate(functions):
+	b = body(i, ret, name, params)
+	ignore = [n for n in unused(params) if not re.search(r'\b' + n + r'\b', b)]
+	if ignore: b = ' '.join('(void)' + n + ';' for n in ignore) + ' ' + b
+	if is_pointer:
+		out.write('#ifdef _WIN32\nstatic ' + ret + ' APIENTRY null_' + name + ' (' + params + ') { ' + b + ' }\n')
+		out.write(ret + ' (APIENTRYFP ' + name + ') (' + params + ') = null_' + name + ';\n#else\n')
+	out.write(ret + ' APIENTRY ' + name + ' (' + params + ') { ' + b + ' }\n')
+	if is_pointer:
+		out.write('#endif\n')
+
+out.write('''
+} //extern "C"
+''')
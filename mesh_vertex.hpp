@@ -0,0 +1,127 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+//Vertex formats of mesh (.pnct) files, shared by MeshBuffer, bake_static_drawables, and index-meshes:
+
+//full precision, as written by export-meshes.py ('pnct' chunk):
+struct MeshVertex {
+	glm::vec3 Position;
+	glm::vec3 Normal;
+	glm::u8vec4 Color;
+	glm::vec2 TexCoord;
+};
+static_assert(sizeof(MeshVertex) == 3*4+3*4+4*1+2*4, "MeshVertex is packed.");
+
+//quantized, as written by index-meshes -q ('pnq0' chunk), in formats OpenGL converts back to floats by itself:
+struct QuantizedMeshVertex {
+	glm::u16vec3 Position; //unsigned normalized, spanning the bounds in the file's 'qnt0' chunk (the vertex shader sees [0,1]^3)
+	uint16_t padding;
+	uint32_t Normal; //signed normalized 10-10-10-2 (GL_INT_2_10_10_10_REV), x in the low bits
+	glm::u8vec4 Color;
+	uint16_t TexCoord[2]; //half floats
+};
+static_assert(sizeof(QuantizedMeshVertex) == 3*2+2+4+4*1+2*2, "QuantizedMeshVertex is packed.");
+
+//The bounds that quantized positions span ('qnt0' chunk):
+struct QuantizedBounds {
+	glm::vec3 min = glm::vec3(0.0f);
+	glm::vec3 max = glm::vec3(1.0f);
+};
+static_assert(sizeof(QuantizedBounds) == 2*3*4, "QuantizedBounds is packed.");
+
+//---- conversions ----
+
+inline uint16_t float_to_half(float f) {
+	uint32_t x;
+	std::memcpy(&x, &f, sizeof(x));
+	uint32_t sign = (x >> 16) & 0x8000;
+	int32_t exponent = int32_t((x >> 23) & 0xff) - 127 + 15;
+	uint32_t mantissa = x & 0x7fffff;
+	if (((x >> 23) & 0xff) == 0xff) return uint16_t(sign | 0x7c00 | (mantissa ? 0x200 : 0)); //inf or nan
+	if (exponent >= 0x1f) return uint16_t(sign | 0x7c00); //too big: inf
+	if (exponent <= 0) { //denormal (or zero)
+		if (exponent < -10) return uint16_t(sign);
+		mantissa |= 0x800000;
+		uint32_t shift = uint32_t(14 - exponent);
+		uint32_t half = mantissa >> shift;
+		if ((mantissa >> (shift - 1)) & 1) half += 1; //round to nearest
+		return uint16_t(sign | half);
+	}
+	uint32_t half = sign | (uint32_t(exponent) << 10) | (mantissa >> 13);
+	if (mantissa & 0x1000) half += 1; //round to nearest (a carry correctly bumps the exponent)
+	return uint16_t(half);
+}
+
+inline float half_to_float(uint16_t h) {
+	uint32_t sign = uint32_t(h & 0x8000) << 16;
+	uint32_t exponent = (h >> 10) & 0x1f;
+	uint32_t mantissa = h & 0x3ff;
+	uint32_t x;
+	if (exponent == 0x1f) {
+		x = sign | 0x7f800000 | (mantissa << 13); //inf or nan
+	} else if (exponent != 0) {
+		x = sign | ((exponent - 15 + 127) << 23) | (mantissa << 13);
+	} else if (mantissa != 0) { //denormal: renormalize
+		exponent = 127 - 15 + 1;
+		while (!(mantissa & 0x400)) {
+			mantissa <<= 1;
+			exponent -= 1;
+		}
+		x = sign | (exponent << 23) | ((mantissa & 0x3ff) << 13);
+	} else {
+		x = sign;
+	}
+	float f;
+	std::memcpy(&f, &x, sizeof(f));
+	return f;
+}
+
+//normals are decoded the way the game's OpenGL 3.3 context does it, f = (2c + 1) / 1023
+// (OpenGL 4.2 changed this to max(c / 511, -1), which can show 0 exactly; 3.3 can't),
+// so codes are picked to be nearest under that rule, and unpack_normal() is what shaders see:
+inline uint32_t pack_normal(glm::vec3 const &n) {
+	auto snorm10 = [](float v) {
+		float c = std::round((std::max(-1.0f, std::min(1.0f, v)) * 1023.0f - 1.0f) * 0.5f);
+		return uint32_t(int32_t(std::max(-512.0f, std::min(511.0f, c)))) & 0x3ff;
+	};
+	return snorm10(n.x) | (snorm10(n.y) << 10) | (snorm10(n.z) << 20);
+}
+
+inline glm::vec3 unpack_normal(uint32_t packed) {
+	auto snorm10 = [](uint32_t bits) {
+		int32_t v = int32_t(bits << 22) >> 22; //sign-extend
+		return float(2 * v + 1) / 1023.0f;
+	};
+	return glm::vec3(snorm10(packed), snorm10(packed >> 10), snorm10(packed >> 20));
+}
+
+inline QuantizedMeshVertex quantize(MeshVertex const &v, QuantizedBounds const &bounds) {
+	QuantizedMeshVertex q;
+	for (uint32_t i = 0; i < 3; ++i) {
+		float extent = bounds.max[i] - bounds.min[i];
+		float t = (extent > 0.0f ? (v.Position[i] - bounds.min[i]) / extent : 0.0f);
+		q.Position[i] = uint16_t(std::round(std::max(0.0f, std::min(1.0f, t)) * 65535.0f));
+	}
+	q.padding = 0;
+	q.Normal = pack_normal(v.Normal);
+	q.Color = v.Color;
+	q.TexCoord[0] = float_to_half(v.TexCoord.x);
+	q.TexCoord[1] = float_to_half(v.TexCoord.y);
+	return q;
+}
+
+//what the vertex shader sees once positions are mapped back to object space:
+inline MeshVertex dequantize(QuantizedMeshVertex const &q, QuantizedBounds const &bounds) {
+	MeshVertex v;
+	v.Position = bounds.min + glm::vec3(q.Position) / 65535.0f * (bounds.max - bounds.min);
+	v.Normal = unpack_normal(q.Normal);
+	v.Color = q.Color;
+	v.TexCoord = glm::vec2(half_to_float(q.TexCoord[0]), half_to_float(q.TexCoord[1]));
+	return v;
+}
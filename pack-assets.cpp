@@ -0,0 +1,193 @@
+#include "Archive.hpp"
+#include "read_write_chunk.hpp"
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/*
+ * pack data files into one asset archive (see Archive.hpp).
+ * each file is stored under its path relative to the archive's directory, which is what data_path() looks up:
+ *   dist/pack-assets dist/assets.pak dist/shader.vert dist/shader.frag dist/test_scene.pnct ...
+ * with -z, chunks of chunk files (.pnct, .scene, .atlas) are stored compressed where that pays (see read_write_chunk.hpp):
+ *   dist/pack-assets -z dist/assets.pak ...
+ *
+ */
+
+//compress the chunks of a chunk file that shrink by at least an eighth (the rest aren't worth inflating):
+static std::vector< char > compress_chunks(std::string const &name, std::vector< char > const &in) {
+	struct ChunkHeader {
+		char magic[4] = {'\0', '\0', '\0', '\0'};
+		uint32_t size = 0;
+	};
+	static_assert(sizeof(ChunkHeader) == 8, "header is packed");
+
+	std::vector< char > out;
+	size_t at = 0;
+	while (at < in.size()) {
+		ChunkHeader header;
+		if (in.size() - at < sizeof(header)) {
+			throw std::runtime_error("Failed to read chunk header in '" + name + "'.");
+		}
+		std::memcpy(&header, in.data() + at, sizeof(header));
+		if ((header.size & ChunkCompressed) || in.size() - at - sizeof(header) < header.size) {
+			throw std::runtime_error("Chunk in '" + name + "' is already compressed or truncated.");
+		}
+		char const *raw = in.data() + at + sizeof(header);
+		at += sizeof(header) + header.size;
+
+		std::vector< char > packed(sizeof(uint32_t) + compressBound(header.size));
+		uLongf length = uLongf(packed.size() - sizeof(uint32_t));
+		if (compress2(reinterpret_cast< Bytef * >(packed.data() + sizeof(uint32_t)), &length, reinterpret_cast< Bytef const * >(raw), header.size, Z_BEST_COMPRESSION) != Z_OK) {
+			throw std::runtime_error("Failed to compress chunk in '" + name + "'.");
+		}
+		packed.resize(sizeof(uint32_t) + length);
+		std::memcpy(packed.data(), &header.size, sizeof(uint32_t));
+
+		if (packed.size() <= header.size - header.size / 8) {
+			ChunkHeader flagged = header;
+			flagged.size = ChunkCompressed | uint32_t(packed.size());
+			out.insert(out.end(), reinterpret_cast< char const * >(&flagged), reinterpret_cast< char const * >(&flagged) + sizeof(flagged));
+			out.insert(out.end(), packed.begin(), packed.end());
+		} else {
+			out.insert(out.end(), reinterpret_cast< char const * >(&header), reinterpret_cast< char const * >(&header) + sizeof(header));
+			out.insert(out.end(), raw, raw + header.size);
+		}
+	}
+	return out;
+}
+
+int main(int argc, char **argv) {
+#ifdef _WIN32
+	try { //windows doesn't print nice errors for unhandled exceptions, so we need to.
+#endif
+	bool compress = (argc >= 2 && std::string(argv[1]) == "-z");
+	int first = (compress ? 2 : 1);
+	if (argc < first + 2) {
+		std::cerr << "Usage:\n\t./pack-assets [-z] <archive> <file1> [file2] ...\n";
+		std::cerr << " will pack file1, file2, ... into archive (replacing it), each under its path relative to the archive's directory.\n";
+		std::cerr << " -z compresses chunks of .pnct, .scene, and .atlas files.\n";
+		std::cerr.flush();
+		return 1;
+	}
+	std::string archive_path = argv[first];
+	std::string base = archive_path.substr(0, archive_path.find_last_of("/\\") + 1); //(empty if archive is in the current directory)
+
+	//read files, sorted by name:
+	std::map< std::string, std::vector< char > > files;
+	uint64_t total = 0;
+	uint64_t compressed_from = 0, compressed_to = 0;
+	for (int i = first + 1; i < argc; ++i) {
+		std::string path = argv[i];
+		if (path.compare(0, base.size(), base) != 0) {
+			throw std::runtime_error("File '" + path + "' isn't in the archive's directory ('" + base + "').");
+		}
+		std::string name = path.substr(base.size());
+		std::replace(name.begin(), name.end(), '\\', '/'); //(data_path() uses '/')
+		if (files.count(name)) {
+			throw std::runtime_error("File '" + name + "' is listed more than once.");
+		}
+		std::ifstream file(path, std::ios::binary);
+		if (!file) {
+			throw std::runtime_error("Failed to open '" + path + "'.");
+		}
+		std::vector< char > &data = files[name];
+		data.assign(std::istreambuf_iterator< char >(file), std::istreambuf_iterator< char >());
+		total += data.size();
+
+		std::string extension = name.substr(std::min(name.size(), name.rfind('.')));
+		if (compress && (extension == ".pnct" || extension == ".scene" || extension == ".atlas")) {
+			compressed_from += data.size();
+			data = compress_chunks(name, data);
+			compressed_to += data.size();
+		}
+	}
+
+	//lay out index:
+	Archive::Header header;
+	header.entry_count = uint32_t(files.size());
+	header.slot_count = 2;
+	while (header.slot_count < 2 * header.entry_count) header.slot_count *= 2; //(at most half full)
+
+	std::vector< Archive::Slot > slots(header.slot_count);
+	std::vector< Archive::Entry > entries;
+	std::string names;
+	for (auto const &f : files) {
+		Archive::Entry entry;
+		entry.name_begin = uint32_t(names.size());
+		names += f.first;
+		entry.name_end = uint32_t(names.size());
+		entry.size = f.second.size();
+		entries.emplace_back(entry);
+
+		uint64_t hash = Archive::hash(f.first);
+		uint32_t s = uint32_t(hash) & (header.slot_count - 1);
+		while (slots[s].entry != Archive::EmptySlot) s = (s + 1) & (header.slot_count - 1);
+		slots[s].hash = hash;
+		slots[s].entry = uint32_t(entries.size() - 1);
+	}
+	header.names_size = uint32_t(names.size());
+
+	//lay out data:
+	auto align = [](uint64_t offset) {
+		return (offset + Archive::Alignment - 1) / Archive::Alignment * Archive::Alignment;
+	};
+	uint64_t offset = sizeof(Archive::Header) + slots.size() * sizeof(Archive::Slot) + entries.size() * sizeof(Archive::Entry) + names.size();
+	for (auto &entry : entries) {
+		offset = align(offset);
+		entry.offset = offset;
+		offset += entry.size;
+	}
+
+	//write:
+	{
+		std::ofstream out(archive_path, std::ios::binary);
+		out.write(reinterpret_cast< char const * >(&header), sizeof(header));
+		out.write(reinterpret_cast< char const * >(slots.data()), slots.size() * sizeof(Archive::Slot));
+		out.write(reinterpret_cast< char const * >(entries.data()), entries.size() * sizeof(Archive::Entry));
+		out.write(names.data(), names.size());
+		uint32_t e = 0;
+		for (auto const &f : files) {
+			std::vector< char > padding(size_t(entries[e].offset - uint64_t(out.tellp())), '\0');
+			out.write(padding.data(), padding.size());
+			out.write(f.second.data(), f.second.size());
+			++e;
+		}
+		if (!out) {
+			throw std::runtime_error("Failed to write '" + archive_path + "'.");
+		}
+	}
+
+	//check that everything reads back:
+	Archive archive(archive_path);
+	for (auto const &f : files) {
+		Archive::View view;
+		if (!archive.find(f.first, &view) || std::vector< char >(view.data, view.data + view.size) != f.second) {
+			throw std::runtime_error("File '" + f.first + "' didn't read back from '" + archive_path + "' correctly.");
+		}
+	}
+
+	std::cout << "Packed " << files.size() << " files (" << total / 1024 << " kB) into '" << archive_path << "' (" << offset / 1024 << " kB)." << std::endl;
+	if (compress) {
+		std::cout << "  chunk files compressed from " << compressed_from / 1024 << " kB to " << compressed_to / 1024 << " kB ("
+			<< (compressed_to ? double(compressed_from) / double(compressed_to) : 1.0) << ":1)." << std::endl;
+	}
+
+	return 0;
+#ifdef _WIN32
+	} catch (std::exception const &e) {
+		std::cerr << "Unhandled exception:\n" << e.what() << std::endl;
+		return 1;
+	} catch (...) {
+		std::cerr << "Unhandled exception (unknown type)." << std::endl;
+		throw;
+	}
+#endif
+}
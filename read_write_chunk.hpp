@@ -4,12 +4,22 @@
 #include <vector>
 #include <stdexcept>
 #include <cassert>
+#include <cstdint>
 
 //helper function that reads an array of structures preceded by a simple header:
 //Expected format:
 // |ma|gi|c.|..| <-- four byte "magic number"
 // |sz|sz|sz|sz| <-- four byte (native endian) size
 // |TT...TT| * (sz/sizeof(TT)) <-- enough T structures to make up sz bytes
+//
+//Chunks may also be stored compressed (e.g., by pack-assets -z), flagged by the top bit of the size:
+// |ma|gi|c.|..|
+// |sz|sz|sz|sz| <-- (ChunkCompressed | sz), sz counting everything below
+// |rs|rs|rs|rs| <-- four byte (native endian) size once inflated
+// |zz...zz| <-- zlib stream
+//read_chunk doesn't inflate these; ChunkFile (ChunkFile.hpp) does.
+
+const uint32_t ChunkCompressed = 0x80000000;
 
 template< typename T >
 void read_chunk(std::istream &from, std::string const &magic, std::vector< T > *to_) {
@@ -29,6 +39,9 @@ void read_chunk(std::istream &from, std::string const &magic, std::vector< T > *
 	if (std::string(header.magic,4) != magic) {
 		throw std::runtime_error("Unexpected magic number in chunk");
 	}
+	if (header.size & ChunkCompressed) {
+		throw std::runtime_error("Chunk is compressed (read it with ChunkFile)");
+	}
 
 	if (header.size % sizeof(T) != 0) {
 		throw std::runtime_error("Size of chunk not divisible by element size");
@@ -45,6 +58,7 @@ void read_chunk(std::istream &from, std::string const &magic, std::vector< T > *
 template< typename T >
 void write_chunk(std::string const &magic, std::vector< T > const &from, std::ostream *to_) {
 	assert(magic.size() == 4);
+	assert(from.size() * sizeof(T) < ChunkCompressed);
 	assert(to_);
 	auto &to = *to_;
 
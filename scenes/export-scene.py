@@ -64,13 +64,18 @@ mesh_data = b""
 camera_data = b""
 lamp_data = b""
 
-#write_string will add a string to the strings section and return a packed (begin,end) reference:
+string_refs = dict()
+
+#write_string will add a string to the strings section (once) and return a packed (begin,end) reference:
+# (Scene::load resolves each mesh name range just once, so repeated names should share theirs)
 def write_string(string):
 	global strings_data
+	if string in string_refs: return string_refs[string]
 	begin = len(strings_data)
 	strings_data += bytes(string, 'utf8')
 	end = len(strings_data)
-	return struct.pack('II', begin, end)
+	string_refs[string] = struct.pack('II', begin, end)
+	return string_refs[string]
 
 obj_to_xfh = dict()
 
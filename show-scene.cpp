@@ -107,9 +107,11 @@ int main(int argc, char **argv) {
 	if (scene_file != "") {
 		try {
 			scene = new Scene();
-			scene->load(scene_file, [&buffer,&buffer_vao](Scene &scene, Scene::Transform *transform, std::string const &mesh_name){
+			scene->load(scene_file, [&buffer,&buffer_vao](std::string const &mesh_name){
+				return (buffer_vao ? buffer->lookup_id(mesh_name) : -1U);
+			}, [&buffer,&buffer_vao](Scene &scene, Scene::Transform *transform, MeshId mesh_id){
 				if (!buffer_vao) return;
-				Mesh const &mesh = buffer->lookup(mesh_name);
+				Mesh const &mesh = buffer->meshes[mesh_id];
 
 				scene.drawables.emplace_back(transform);
 				Scene::Drawable &drawable = scene.drawables.back();
@@ -120,6 +122,19 @@ int main(int argc, char **argv) {
 				drawable.pipeline.type = mesh.type;
 				drawable.pipeline.start = mesh.start;
 				drawable.pipeline.count = mesh.count;
+				drawable.pipeline.index_type = mesh.index_type;
+				drawable.pipeline.position_offset = mesh.position_offset;
+				drawable.pipeline.position_scale = mesh.position_scale;
+
+				//bounds and LODs, so distant objects draw coarser versions (if the mesh file has any):
+				drawable.has_bounds = true;
+				drawable.min = mesh.min;
+				drawable.max = mesh.max;
+				drawable.lod_count = mesh.lod_count;
+				for (uint32_t l = 0; l < mesh.lod_count; ++l) {
+					drawable.lods[l].start = mesh.lods[l].start;
+					drawable.lods[l].count = mesh.lods[l].count;
+				}
 
 			});
 		} catch (std::exception &e) {